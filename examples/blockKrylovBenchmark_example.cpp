@@ -0,0 +1,126 @@
+/** @file blockKrylovBenchmark_example.cpp
+
+    @brief Compares the block Krylov space methods (gsBlockConjugateGradient,
+    gsBlockGMRes) for many right-hand sides with solving for the
+    right-hand sides one after the other.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+// Prints the number of iterations, the timings and the largest error
+void report(const std::string & name, index_t iter, double solveTime,
+            const gsSparseMatrix<> & matrix, const gsMatrix<> & rhs, const gsMatrix<> & x)
+{
+    const gsMatrix<> res = matrix * x - rhs;
+    real_t error = 0;
+    for (index_t j = 0; j < rhs.cols(); ++j)
+        error = math::max(error, res.col(j).norm() / rhs.col(j).norm());
+    gsInfo << std::setw(16) << name << std::setw(10) << iter
+           << std::setw(12) << solveTime << std::setw(14) << error << "\n";
+}
+
+// Solves for the columns of the right-hand side one after the other
+void solveSequentially(const std::string & name, gsIterativeSolver<> & solver,
+                       const gsSparseMatrix<> & matrix, const gsMatrix<> & rhs)
+{
+    gsMatrix<> x(rhs.rows(), rhs.cols()), xj;
+    index_t iter = 0;
+    gsStopwatch time;
+    for (index_t j = 0; j < rhs.cols(); ++j)
+    {
+        xj.setZero(rhs.rows(), 1);
+        solver.solve(rhs.col(j), xj);
+        x.col(j) = xj;
+        iter += solver.iterations();
+    }
+    report(name, iter, time.stop(), matrix, rhs, x);
+}
+
+// Solves for all columns of the right-hand side at once
+void solveBlock(const std::string & name, gsIterativeSolver<> & solver,
+                const gsSparseMatrix<> & matrix, const gsMatrix<> & rhs)
+{
+    gsMatrix<> x;
+    x.setZero(rhs.rows(), rhs.cols());
+    gsStopwatch time;
+    solver.solve(rhs, x);
+    report(name, solver.iterations(), time.stop(), matrix, rhs, x);
+}
+
+int main(int argc, char *argv[])
+{
+    index_t numRhs = 8;
+    index_t refinements = 4;
+    index_t degree = 2;
+    real_t tol = 1e-8;
+    index_t maxIter = 1000;
+
+    gsCmdLine cmd("Compares block Krylov space methods with solving for the right-hand sides one after the other.");
+    cmd.addInt ("k", "NumRhs",      "Number of right-hand sides", numRhs);
+    cmd.addInt ("r", "Refinements", "Number of uniform h-refinement steps", refinements);
+    cmd.addInt ("p", "Degree",      "Spline degree", degree);
+    cmd.addReal("t", "Tolerance",   "Stopping criterion for the iterative solvers", tol);
+    cmd.addInt ("",  "MaxIter",     "Maximum number of iterations", maxIter);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    gsMultiPatch<> mp(*gsNurbsCreator<>::BSplineFatQuarterAnnulus(1.0, 2.0));
+
+    gsMultiBasis<> mb(mp);
+    for (size_t i = 0; i < mb.nBases(); ++i)
+        mb[i].setDegreePreservingMultiplicity(degree);
+    for (index_t i = 0; i < refinements; ++i)
+        mb.uniformRefine();
+
+    gsFunctionExpr<> f("2*pi^2*sin(pi*x)*sin(pi*y)", 2);
+    gsFunctionExpr<> g("0", 2);
+    gsBoundaryConditions<> bc;
+    for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+        bc.addCondition(*it, condition_type::dirichlet, &g);
+    bc.setGeoMap(mp);
+
+    gsPoissonAssembler<> assembler(mp, mb, bc, f, dirichlet::elimination, iFace::glue);
+    assembler.assemble();
+    const gsSparseMatrix<> & matrix = assembler.matrix();
+
+    // The assembled right-hand side, followed by random ones
+    gsMatrix<> rhs(matrix.rows(), numRhs);
+    rhs.setRandom();
+    rhs.col(0) = assembler.rhs();
+
+    gsInfo << matrix.rows() << " dofs, " << numRhs << " right-hand sides\n\n"
+           << "          method      iter    solve[s]         error\n";
+
+    gsLinearOperator<>::Ptr prec = makeJacobiOp(matrix);
+
+    gsConjugateGradient<> cg(matrix, prec);
+    cg.setTolerance(tol);
+    cg.setMaxIterations(maxIter);
+    solveSequentially("CG", cg, matrix, rhs);
+
+    gsBlockConjugateGradient<> bcg(matrix, prec);
+    bcg.setTolerance(tol);
+    bcg.setMaxIterations(maxIter);
+    solveBlock("block CG", bcg, matrix, rhs);
+
+    gsGMRes<> gmres(matrix, prec);
+    gmres.setTolerance(tol);
+    gmres.setMaxIterations(maxIter);
+    solveSequentially("GMRes", gmres, matrix, rhs);
+
+    gsBlockGMRes<> bgmres(matrix, prec);
+    bgmres.setTolerance(tol);
+    bgmres.setMaxIterations(maxIter);
+    solveBlock("block GMRes", bgmres, matrix, rhs);
+
+    return EXIT_SUCCESS;
+}
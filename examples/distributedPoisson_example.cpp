@@ -0,0 +1,136 @@
+/** @file distributedPoisson_example.cpp
+
+    @brief Solves the Poisson equation on a multipatch domain, where the
+    patches are distributed over the MPI processes.
+
+    Execute (eg. with 4 processes):
+       mpirun -np 4 ./bin/distributedPoisson_example
+
+    Each process assembles the contributions of its patches; the
+    row-distributed system (gsDistributedMatrixOp) is solved with the
+    conjugate gradient method and with GMRes. The result is compared to
+    the solution of the serial system.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+int main(int argc, char *argv[])
+{
+    index_t splitPatches = 2;
+    index_t refinements = 2;
+    index_t degree = 2;
+    real_t tol = 1e-8;
+    index_t maxIter = 1000;
+
+    gsCmdLine cmd("Solves the Poisson equation with patches distributed over the MPI processes.\n"
+        "Execute (eg. with 4 processes):                                       "
+        "  *  mpirun -np 4 ./bin/distributedPoisson_example");
+    cmd.addInt ("",  "SplitPatches", "Split the square that many times in 4 patches", splitPatches);
+    cmd.addInt ("r", "Refinements",  "Number of uniform h-refinement steps", refinements);
+    cmd.addInt ("p", "Degree",       "Spline degree", degree);
+    cmd.addReal("t", "Tolerance",    "Stopping criterion for the iterative solvers", tol);
+    cmd.addInt ("",  "MaxIter",      "Maximum number of iterations", maxIter);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    const gsMpi & mpi = gsMpi::init(argc, argv);
+    gsMpiComm comm = mpi.worldComm();
+    const index_t rank = comm.rank();
+    const index_t nProc = comm.size();
+
+    // Every process holds the whole geometry and discretization
+    gsMultiPatch<> mp(*gsNurbsCreator<>::BSplineSquare());
+    for (index_t i = 0; i < splitPatches; ++i)
+        mp = mp.uniformSplit();
+
+    gsMultiBasis<> mb(mp);
+    for (size_t i = 0; i < mb.nBases(); ++i)
+        mb[i].setDegreePreservingMultiplicity(degree);
+    for (index_t i = 0; i < refinements; ++i)
+        mb.uniformRefine();
+
+    gsFunctionExpr<> f("2*pi^2*sin(pi*x)*sin(pi*y)", 2);
+    gsFunctionExpr<> g("0", 2);
+    gsBoundaryConditions<> bc;
+    for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+        bc.addCondition(*it, condition_type::dirichlet, &g);
+    bc.setGeoMap(mp);
+
+    // Distribute the patches
+    const std::vector<index_t> patchOwner = gsDistributedMatrixOp<>::partitionPatches(mb, nProc);
+    const std::vector<index_t> owned = gsDistributedMatrixOp<>::ownedPatches(patchOwner, rank);
+
+    if (0 == rank)
+        gsInfo << "Running on " << nProc << " processes, " << mp.nPatches() << " patches.\n";
+
+    // Assemble the contributions of the owned patches
+    gsExprAssembler<> A(1,1);
+    A.setIntegrationElements(mb);
+    gsExprAssembler<>::geometryMap G = A.getMap(mp);
+    gsExprAssembler<>::space u = A.getSpace(mb);
+    auto ff = A.getCoeff(f, G);
+    u.setup(bc, dirichlet::interpolation, 0);
+    A.initSystem();
+    A.setPatches(owned);
+    A.assemble( igrad(u, G) * igrad(u, G).tr() * meas(G), u * ff * meas(G) );
+
+    gsStopwatch time;
+    gsDistributedMatrixOp<>::Ptr op =
+        gsDistributedMatrixOp<>::make(comm, u.mapper(), patchOwner, A.matrix());
+    const gsMatrix<> rhs = op->distribute(A.rhs());
+    const double setupTime = time.stop();
+
+    gsInfo << "Process " << rank << ": " << owned.size() << " patches, "
+           << op->ownedDofs().size() << " owned dofs, " << op->ghostDofs().size() << " ghost dofs\n";
+    comm.barrier();
+
+    // Jacobi preconditioner, which only needs the owned diagonal
+    gsSparseMatrix<> ownedBlock = op->localMatrix().leftCols(op->rows());
+    gsLinearOperator<>::Ptr prec = makeJacobiOp(ownedBlock);
+
+    // Reference: serial system on every process
+    A.setPatches(std::vector<index_t>());
+    A.initSystem();
+    A.assemble( igrad(u, G) * igrad(u, G).tr() * meas(G), u * ff * meas(G) );
+    gsSparseSolver<>::CGDiagonal serialSolver(A.matrix());
+    const gsMatrix<> reference = serialSolver.solve(A.rhs());
+
+    bool success = true;
+    for (index_t s = 0; s < 2; ++s)
+    {
+        gsIterativeSolver<>::Ptr solver;
+        if (s == 0)
+            solver = gsConjugateGradient<>::make(op, prec);
+        else
+            solver = gsGMRes<>::make(op, prec);
+        solver->setCommunicator(comm);
+        solver->setTolerance(tol);
+        solver->setMaxIterations(maxIter);
+
+        gsMatrix<> x;
+        time.restart();
+        solver->solve(rhs, x);
+        const double solveTime = time.stop();
+
+        const gsMatrix<> result = op->gather(x);
+        const real_t diff = (result - reference).norm() / reference.norm();
+        const bool converged = solver->error() <= tol;
+        success &= converged;
+        if (0 == rank)
+            gsInfo << (s == 0 ? "CG:     " : "GMRes:  ") << solver->iterations() << " iterations, "
+                   << "setup " << setupTime << "s, solve " << solveTime << "s, "
+                   << "difference to serial solution " << diff
+                   << (converged ? "" : " (not converged)") << "\n";
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
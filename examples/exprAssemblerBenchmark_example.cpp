@@ -0,0 +1,114 @@
+/** @file exprAssemblerBenchmark_example.cpp
+
+    @brief Timings of the expression assembler with and without
+    batched evaluation of bilinear forms and shared subexpressions.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+// Assembles the given forms with the switch \a option turned on and
+// off and prints the timings. Returns the difference of the matrices.
+template <class... E>
+real_t benchmark(gsExprAssembler<> & A, const std::string & option,
+                 const std::string & name, index_t repeat, const E &... forms)
+{
+    gsStopwatch time;
+    gsSparseMatrix<> mat[2];
+    double t[2];
+    for (index_t i = 0; i != 2; ++i)
+    {
+        A.options().setSwitch(option, 0==i);
+        t[i] = 0;
+        for (index_t r = 0; r != repeat; ++r)
+        {
+            A.initSystem();
+            time.restart();
+            A.assemble(forms...);
+            t[i] += time.stop();
+        }
+        mat[i] = A.matrix();
+    }
+    A.options().setSwitch(option, true);
+    gsInfo << std::setw(16) << name << std::setw(10) << A.numDofs()
+           << std::setw(12) << t[0]/repeat << std::setw(12) << t[1]/repeat
+           << std::setw(10) << t[1]/t[0] << "\n";
+    return (mat[0]-mat[1]).norm() / mat[1].norm();
+}
+
+int main(int argc, char *argv[])
+{
+    index_t numRefine  = 3;
+    index_t numElevate = 1;
+    index_t repeat     = 1;
+    bool threeD = false;
+
+    gsCmdLine cmd("Timings of the expression assembler with and without batched evaluation and shared subexpressions.");
+    cmd.addInt   ("r", "uniformRefine", "Number of uniform h-refinement steps", numRefine);
+    cmd.addInt   ("e", "degreeElevation", "Number of degree elevation steps", numElevate);
+    cmd.addInt   ("n", "repeat", "Number of repetitions of each assembly", repeat);
+    cmd.addSwitch("3d", "Use a three-dimensional domain", threeD);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    gsMultiPatch<> mp;
+    if (threeD)
+        mp.addPatch( gsNurbsCreator<>::BSplineCube(2) );
+    else
+        mp.addPatch( gsNurbsCreator<>::NurbsQuarterAnnulus() );
+
+    gsMultiBasis<> mb(mp);
+    mb.degreeElevate(numElevate);
+    for (index_t i = 0; i < numRefine; ++i)
+        mb.uniformRefine();
+
+    gsExprAssembler<> A(1,1);
+    A.setIntegrationElements(mb);
+    gsExprAssembler<>::geometryMap G = A.getMap(mp);
+
+    real_t err = 0;
+    gsInfo << std::setprecision(3);
+
+    // Scalar-valued space: Poisson and mass
+    gsExprAssembler<>::space u = A.getSpace(mb);
+    u.setup(-1);
+
+    gsInfo << "\nBatched evaluation (batchedEval):\n"
+           << "            form      dofs        on[s]       off[s]   speedup\n";
+    err = math::max(err, benchmark(A, "batchedEval", "Poisson", repeat,
+                                   igrad(u, G) * igrad(u, G).tr() * meas(G)));
+    err = math::max(err, benchmark(A, "batchedEval", "mass", repeat,
+                                   u * u.tr() * meas(G)));
+
+    // Vector-valued space: the block-diagonal mass matrix of elasticity
+    gsExprAssembler<> B(1,1);
+    B.setIntegrationElements(mb);
+    gsExprAssembler<>::geometryMap G2 = B.getMap(mp);
+    gsExprAssembler<>::space v = B.getSpace(mb, mp.geoDim());
+    v.setup(-1);
+    err = math::max(err, benchmark(B, "batchedEval", "vector mass", repeat,
+                                   v * v.tr() * meas(G2)));
+
+    // Several terms sharing igrad(u,G): diffusion, anisotropic
+    // diffusion and a reaction term
+    gsMatrix<> D(mp.geoDim(), mp.geoDim());
+    D.setIdentity();
+    D(0,0) = 2;
+    gsInfo << "\nShared subexpressions (shareSubexpressions):\n"
+           << "            form      dofs        on[s]       off[s]   speedup\n";
+    err = math::max(err, benchmark(A, "shareSubexpressions", "multi-term", repeat,
+                                   igrad(u, G) * igrad(u, G).tr() * meas(G),
+                                   igrad(u, G) * D * igrad(u, G).tr() * meas(G),
+                                   u * u.tr() * meas(G)));
+
+    gsInfo << "Maximal relative difference: " << err << "\n";
+    return err < 1e-10 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
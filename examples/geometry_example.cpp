@@ -169,6 +169,12 @@ int main(int argc, char* argv[])
                   << "\n" << "\n";
 
         gsWriteParaview(mesh, out);
+
+        out = output + "Bezier";
+        gsInfo << "Writing the geometry as Bezier cells to a paraview file: " << out
+                  << "\n" << "\n";
+
+        gsWriteParaviewBezier(*pGeom, out);
         //! [write to paraview]
     }
     else
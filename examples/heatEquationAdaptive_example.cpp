@@ -0,0 +1,148 @@
+/** @file heatEquationAdaptive_example.cpp
+
+    @brief Solves the heat equation with adaptive time stepping and
+    compares the work with fixed time stepping for the same accuracy
+
+    The error is the maximum relative error at the output times, with
+    respect to the exact solution of the semi-discrete problem.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+int main(int argc, char *argv[])
+{
+    index_t numRefine = 3;
+    real_t endTime = 0.5;
+    real_t tol = 1e-4;
+    real_t theta = 0.5;
+    index_t numOut = 10;
+    gsCmdLine cmd("Adaptive time stepping for the heat equation.");
+    cmd.addInt ("r", "refine", "Number of uniform h-refinement steps", numRefine);
+    cmd.addReal("T", "endTime", "End time", endTime);
+    cmd.addReal("t", "tol", "Relative tolerance of the adaptive methods", tol);
+    cmd.addReal("", "theta", "Theta of the fixed step size scheme", theta);
+    cmd.addInt ("o", "outputs", "Number of (equidistant) output times", numOut);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    // The setting of heatEquation_example: zero initial value, heat
+    // flux through the west side, zero temperature on the others
+    gsConstantFunction<> f(0,2);
+    gsMultiPatch<> patches(*gsNurbsCreator<>::BSplineSquareDeg(2));
+    patches.computeTopology();
+
+    gsBoundaryConditions<> bcInfo;
+    gsConstantFunction<> g_N(1,2);
+    gsConstantFunction<> g_D(0,2);
+    bcInfo.addCondition(0, boundary::west,  condition_type::neumann  , &g_N);
+    bcInfo.addCondition(0, boundary::east,  condition_type::dirichlet, &g_D);
+    bcInfo.addCondition(0, boundary::north, condition_type::dirichlet, &g_D);
+    bcInfo.addCondition(0, boundary::south, condition_type::dirichlet, &g_D);
+
+    gsMultiBasis<> bases( patches );
+    for (index_t i = 0; i < numRefine; ++i)
+        bases.uniformRefine();
+
+    gsPoissonPde<> pde(patches, bcInfo, f);
+    gsPoissonAssembler<> stationary(pde, bases);
+    stationary.options().setInt("DirichletStrategy", dirichlet::elimination);
+    gsHeatEquation<real_t> heat(stationary);
+    heat.setTheta(theta);
+
+    // The matrices are assembled once and used by all methods below
+    gsStopwatch clock;
+    heat.assemble();
+    gsInfo << "Assembled "<< heat.numDofs() <<" DoFs in "<< clock.stop() <<" s.\n";
+
+    const gsSparseMatrix<> & M = heat.mass(), & K = heat.stationaryMatrix();
+    const gsMatrix<> & F = heat.stationaryRhs();
+    const index_t ndof = heat.numDofs();
+    gsMatrix<> u0;
+    u0.setZero(ndof, 1);
+
+    // Reference: u(t) = u_inf + V exp(-Lambda t) V^T M (u0 - u_inf),
+    // with the generalized eigenpairs K V = M V Lambda, V^T M V = I
+    std::vector<gsMatrix<> > uRef(numOut);
+    {
+        gsMatrix<> Md = M.toDense(), Kd = K.toDense();
+        gsEigen::GeneralizedSelfAdjointEigenSolver<gsMatrix<>::Base> ges(Kd, Md);
+        const gsMatrix<> uInf = Kd.partialPivLu().solve(F);
+        const gsMatrix<> c0 = ges.eigenvectors().transpose() * (Md * (u0 - uInf));
+        for (index_t k = 0; k != numOut; ++k)
+        {
+            const real_t t = endTime * (k + 1) / numOut;
+            gsMatrix<> c = c0.array() * (-t * ges.eigenvalues().array()).exp();
+            uRef[k] = uInf + ges.eigenvectors() * c;
+        }
+    }
+
+    gsInfo << "\n  method     steps  rejected  factorizations    solves    max. rel. error    time [s]\n";
+    std::vector<real_t> errors;
+    const char * names[] = {"ROS2", "BDF2"};
+    for (index_t m = 0; m != 2; ++m)
+    {
+        gsLinearTimeIntegrator<real_t> integrator(heat);
+        integrator.options().setInt ("Method", m);
+        integrator.options().setReal("RelTol", tol);
+        integrator.options().setReal("AbsTol", tol * 1e-2);
+        gsMatrix<> u = u0;
+        real_t error = 0;
+        clock.restart();
+        for (index_t k = 0; k != numOut; ++k)
+        {
+            integrator.integrate(u, endTime * k / numOut, endTime * (k + 1) / numOut);
+            error = math::max(error, (u - uRef[k]).norm() / uRef[k].norm());
+        }
+        const real_t time = clock.stop();
+        errors.push_back(error);
+        gsInfo << std::setw(8) << names[m] << std::setw(10) << integrator.numSteps()
+               << std::setw(10) << integrator.numRejected()
+               << std::setw(16) << integrator.numFactorizations()
+               << std::setw(10) << integrator.numSolves()
+               << std::setw(19) << error << std::setw(12) << time << "\n";
+    }
+
+    // Fixed step size theta scheme, doubling the number of steps
+    // until it is as accurate as the adaptive methods
+    const real_t target = *std::max_element(errors.begin(), errors.end());
+    gsSparseSolver<>::LU solver;
+    real_t error = 1;
+    for (index_t numSteps = numOut; numSteps <= 65536 && error > target; numSteps *= 2)
+    {
+        const real_t Dt = endTime / numSteps;
+        index_t numFact = 0;
+        gsMatrix<> u = u0;
+        error = 0;
+        clock.restart();
+        for (index_t i = 0; i != numSteps; ++i)
+        {
+            heat.nextTimeStep(u, Dt);
+            if (heat.systemChanged()) // constant step size: factorize once
+            {
+                solver.compute(heat.matrix());
+                ++numFact;
+            }
+            u = solver.solve(heat.rhs());
+            if ( 0 == (i + 1) % (numSteps / numOut) )
+            {
+                const index_t k = (i + 1) / (numSteps / numOut) - 1;
+                error = math::max(error, (u - uRef[k]).norm() / uRef[k].norm());
+            }
+        }
+        const real_t time = clock.stop();
+        gsInfo << " theta=" << std::setw(3) << theta << std::setw(8) << numSteps
+               << std::setw(10) << 0 << std::setw(16) << numFact << std::setw(10) << numSteps
+               << std::setw(19) << error << std::setw(12) << time << "\n";
+    }
+
+    return EXIT_SUCCESS;
+}
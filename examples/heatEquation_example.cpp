@@ -99,6 +99,7 @@ int main(int argc, char *argv[])
     gsParaviewCollection collection(baseName);
     collection.options().setInt("numPoints", 1000);
     collection.options().setInt("precision", 5);
+    collection.options().setSwitch("asyncWrite", true); // overlap writing with the next time steps
 
     if ( plot )
     {
@@ -0,0 +1,122 @@
+/** @file krylovBenchmark_example.cpp
+
+    @brief Compares the time per iteration of the standard Krylov space
+    methods with their pipelined and communication-avoiding variants.
+
+    The Poisson equation is discretized on a multipatch domain, whose
+    patches are distributed over the MPI processes (see
+    gsDistributedMatrixOp). Execute, e.g., with 4 processes and 2 threads:
+       OMP_NUM_THREADS=2 mpirun -np 4 ./bin/krylovBenchmark_example
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+// Solves the system and prints the number of iterations and the timings
+void solve(const std::string & name, gsIterativeSolver<> & solver, const gsMpiComm & comm,
+           const gsMatrix<> & rhs, real_t tol, index_t maxIter)
+{
+    solver.setCommunicator(comm);
+    solver.setTolerance(tol);
+    solver.setMaxIterations(maxIter);
+
+    gsMatrix<> x;
+    comm.barrier();
+    gsStopwatch time;
+    solver.solve(rhs, x);
+    comm.barrier();
+    const double solveTime = time.stop();
+
+    if (0 == comm.rank())
+        gsInfo << std::setw(12) << name << std::setw(8) << solver.iterations()
+               << std::setw(12) << solveTime
+               << std::setw(14) << solveTime / math::max<index_t>(1, solver.iterations())
+               << std::setw(12) << solver.error() << "\n";
+}
+
+int main(int argc, char *argv[])
+{
+    index_t splitPatches = 2;
+    index_t refinements = 3;
+    index_t degree = 2;
+    index_t stepSize = 4;
+    real_t tol = 1e-8;
+    index_t maxIter = 500;
+
+    gsCmdLine cmd("Compares standard, pipelined and s-step Krylov space methods.");
+    cmd.addInt ("",  "SplitPatches", "Split the square that many times in 4 patches", splitPatches);
+    cmd.addInt ("r", "Refinements",  "Number of uniform h-refinement steps", refinements);
+    cmd.addInt ("p", "Degree",       "Spline degree", degree);
+    cmd.addInt ("s", "StepSize",     "Number of basis vectors generated at once by s-step GMRes", stepSize);
+    cmd.addReal("t", "Tolerance",    "Stopping criterion for the iterative solvers", tol);
+    cmd.addInt ("",  "MaxIter",      "Maximum number of iterations", maxIter);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    const gsMpi & mpi = gsMpi::init(argc, argv);
+    gsMpiComm comm = mpi.worldComm();
+    const index_t rank = comm.rank();
+
+    gsMultiPatch<> mp(*gsNurbsCreator<>::BSplineSquare());
+    for (index_t i = 0; i < splitPatches; ++i)
+        mp = mp.uniformSplit();
+
+    gsMultiBasis<> mb(mp);
+    for (size_t i = 0; i < mb.nBases(); ++i)
+        mb[i].setDegreePreservingMultiplicity(degree);
+    for (index_t i = 0; i < refinements; ++i)
+        mb.uniformRefine();
+
+    gsFunctionExpr<> f("2*pi^2*sin(pi*x)*sin(pi*y)", 2);
+    gsFunctionExpr<> g("0", 2);
+    gsBoundaryConditions<> bc;
+    for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+        bc.addCondition(*it, condition_type::dirichlet, &g);
+    bc.setGeoMap(mp);
+
+    const std::vector<index_t> patchOwner = gsDistributedMatrixOp<>::partitionPatches(mb, comm.size());
+
+    gsExprAssembler<> A(1,1);
+    A.setIntegrationElements(mb);
+    gsExprAssembler<>::geometryMap G = A.getMap(mp);
+    gsExprAssembler<>::space u = A.getSpace(mb);
+    auto ff = A.getCoeff(f, G);
+    u.setup(bc, dirichlet::interpolation, 0);
+    A.initSystem();
+    A.setPatches(gsDistributedMatrixOp<>::ownedPatches(patchOwner, rank));
+    A.assemble( igrad(u, G) * igrad(u, G).tr() * meas(G), u * ff * meas(G) );
+
+    gsDistributedMatrixOp<>::Ptr op =
+        gsDistributedMatrixOp<>::make(comm, u.mapper(), patchOwner, A.matrix());
+    const gsMatrix<> rhs = op->distribute(A.rhs());
+    gsSparseMatrix<> ownedBlock = op->localMatrix().leftCols(op->rows());
+    gsLinearOperator<>::Ptr prec = makeJacobiOp(ownedBlock);
+
+    if (0 == rank)
+        gsInfo << "Processes: " << comm.size() << ", threads: " << omp_get_max_threads()
+               << ", dofs: " << op->globalSize() << "\n\n"
+               << "      method    iter    solve[s]    per iter[s]       error\n";
+
+    gsConjugateGradient<> cg(op, prec);
+    solve("CG", cg, comm, rhs, tol, maxIter);
+
+    gsPipelinedConjugateGradient<> pcg(op, prec);
+    solve("pipelined CG", pcg, comm, rhs, tol, maxIter);
+
+    gsGMRes<> gmres(op, prec);
+    solve("GMRes", gmres, comm, rhs, tol, maxIter);
+
+    gsSStepGMRes<> sgmres(op, prec);
+    sgmres.setStepSize(stepSize);
+    solve("s-step GMRes", sgmres, comm, rhs, tol, maxIter);
+
+    return EXIT_SUCCESS;
+}
@@ -178,6 +178,25 @@ int main(int argc, char *argv[])
     gsInfo << "done.\n";
     gsIterativeSolverInfo(CGSolver, (mat*x0-rhs).norm()/rhs.norm(), clock.stop(), succeeded);
 
+    //Initialize the CG solver with an algebraic multigrid preconditioner
+    gsOptionList amgOpt = gsAlgebraicMultiGridOp<>::defaultOptions();
+    amgOpt.setInt("CoarseSize", 10);
+    clock.restart();
+    gsAlgebraicMultiGridOp<>::Ptr amg = gsAlgebraicMultiGridOp<>::make(mat, amgOpt);
+    gsInfo << "\nAMG: Setup with " << amg->numLevels() << " levels took " << clock.stop() << "s.";
+    gsConjugateGradient<> CGAMGSolver(mat,amg);
+    CGAMGSolver.setOptions(opt);
+
+    //Set the initial guess to zero
+    x0.setZero(N,1);
+
+    //Solve system with given preconditioner (solution is stored in x0)
+    gsInfo << "\nCG + AMG: Started solving... ";
+    clock.restart();
+    CGAMGSolver.solve(rhs,x0);
+    gsInfo << "done.\n";
+    gsIterativeSolverInfo(CGAMGSolver, (mat*x0-rhs).norm()/rhs.norm(), clock.stop(), succeeded);
+
     //Initialize the MINRES-QLP solver
     gsMinResQLP<> MRQLPSolver(mat,preConMat);
     MRQLPSolver.setOptions(opt);
@@ -38,6 +38,7 @@ int main(int argc, char *argv[])
     index_t presmooth = 1;
     index_t postsmooth = 1;
     bool extrasmooth = false;
+    bool amg = false;
     std::string smoother("GaussSeidel");
     real_t damping = -1;
     real_t scaling = 0.12;
@@ -63,6 +64,7 @@ int main(int argc, char *argv[])
     cmd.addInt   ("",  "MG.NumPreSmooth",       "Number of pre-smoothing steps", presmooth);
     cmd.addInt   ("",  "MG.NumPostSmooth",      "Number of post-smoothing steps", postsmooth);
     cmd.addSwitch("",  "MG.Extrasmooth",        "Doubles the number of smoothing steps for each coarser level", extrasmooth);
+    cmd.addSwitch("",  "AMG",                   "Use algebraic multigrid instead of the geometric grid hierarchy", amg);
     cmd.addString("s", "MG.Smoother",           "Smoothing method", smoother);
     cmd.addReal  ("",  "MG.Damping",            "Damping factor for the smoother", damping);
     cmd.addReal  ("",  "MG.Scaling",            "Scaling factor for the subspace corrected mass smoother", scaling);
@@ -257,81 +259,102 @@ int main(int argc, char *argv[])
 
     gsInfo << "Setup solver and solve... " << std::flush;
 
-    //! [Define vectors]
-    std::vector< gsSparseMatrix<real_t,RowMajor> > transferMatrices;
-    std::vector< gsMultiBasis<real_t> > multiBases;  // Needed for setupSubspaceCorrectedMassSmoother
-    std::vector<real_t> patchLocalDampingParameters; // Needed for setupSubspaceCorrectedMassSmoother
-    //! [Define vectors]
-
-    // Setup grid hiearachy by coarsening of the given matrix
-    // We move the constructed hiearchy of multi bases into a variable (only required for the subspace smoother)
-    // Then we move the transfer matrices into a variable
-    //! [Setup grid hierarchy]
-    gsGridHierarchy<>::buildByCoarsening(give(mb), bc, cmd.getGroup("MG"))
-        .moveMultiBasesTo(multiBases)
-        .moveTransferMatricesTo(transferMatrices);
-    //! [Setup grid hierarchy]
-
-    // Setup the multigrid solver
-    //! [Setup multigrid]
-    gsMultiGridOp<>::Ptr mg = gsMultiGridOp<>::make( assembler.matrix(), transferMatrices );
-    mg->setOptions( cmd.getGroup("MG") );
-    //! [Setup multigrid]
-
-    // Since we are solving a symmetric positive definite problem,we can use a Cholesky solver
-    // (instead of the LU solver that would be created by default).
-    //
-    // mg->matrix(0) gives the matrix for the coarsest grid level (=level 0).
-    //! [Define coarse solver]
-    mg->setCoarseSolver( makeSparseCholeskySolver( mg->matrix(0) ) );
-    //! [Define coarse solver]
-
-    // Set up of the smoothers
-    // This has to be done for each grid level separately
-    //! [Define smoothers]
-    for (index_t i = 1; i < mg->numLevels(); ++i)
+    gsPreconditionerOp<>::Ptr prec;
+
+    if (amg)
     {
-        gsPreconditionerOp<>::Ptr smootherOp;
-        if ( smoother == "Richardson" || smoother == "r" )
-            smootherOp = makeRichardsonOp(mg->matrix(i));
-        else if ( smoother == "Jacobi" || smoother == "j" )
-            smootherOp = makeJacobiOp(mg->matrix(i));
-        else if ( smoother == "GaussSeidel" || smoother == "gs" )
-            smootherOp = makeGaussSeidelOp(mg->matrix(i));
-        else if ( smoother == "IncompleteLU" || smoother == "ilu" )
-            smootherOp = makeIncompleteLUOp(mg->matrix(i));
-        else if ( smoother == "SubspaceCorrectedMassSmoother" || smoother == "scms" )
-            smootherOp = setupSubspaceCorrectedMassSmoother( i, mg->numLevels(), mg->matrix(i),
-                multiBases[i], bc, cmd.getGroup("MG"), patchLocalDampingParameters );
-        else if ( smoother == "Hybrid" || smoother == "hyb" )
-            smootherOp = gsCompositePrecOp<>::make(
-                makeGaussSeidelOp(mg->matrix(i)),
-                setupSubspaceCorrectedMassSmoother( i, mg->numLevels(), mg->matrix(i),
-                    multiBases[i], bc, cmd.getGroup("MG"), patchLocalDampingParameters )
-                );
+        // Algebraic multigrid: the hierarchy is built from the matrix only
+        gsOptionList amgOpt = gsAlgebraicMultiGridOp<>::defaultOptions();
+        amgOpt.update( cmd.getGroup("MG"), gsOptionList::addIfUnknown );
+        gsAlgebraicMultiGridOp<>::Ptr amgOp = gsAlgebraicMultiGridOp<>::make( assembler.matrix(), amgOpt );
+        gsInfo << "AMG with " << amgOp->numLevels() << " levels... " << std::flush;
+        prec = amgOp;
+    }
+    else
+    {
+        //! [Define vectors]
+        std::vector< gsSparseMatrix<real_t,RowMajor> > transferMatrices;
+        std::vector< gsMultiBasis<real_t> > multiBases;  // Needed for setupSubspaceCorrectedMassSmoother
+        std::vector<real_t> patchLocalDampingParameters; // Needed for setupSubspaceCorrectedMassSmoother
+        //! [Define vectors]
+
+        // Setup grid hiearachy by coarsening of the given matrix
+        // We move the constructed hiearchy of multi bases into a variable (only required for the subspace smoother)
+        // Then we move the transfer matrices into a variable
+        //! [Setup grid hierarchy]
+        gsGridHierarchy<>::buildByCoarsening(give(mb), bc, cmd.getGroup("MG"))
+            .moveMultiBasesTo(multiBases)
+            .moveTransferMatricesTo(transferMatrices);
+        //! [Setup grid hierarchy]
+
+        // Setup the multigrid solver
+        //! [Setup multigrid]
+        gsMultiGridOp<>::Ptr mg = gsMultiGridOp<>::make( assembler.matrix(), transferMatrices );
+        mg->setOptions( cmd.getGroup("MG") );
+        //! [Setup multigrid]
+
+        // Since we are solving a symmetric positive definite problem,we can use a Cholesky solver
+        // (instead of the LU solver that would be created by default).
+        //
+        // mg->matrix(0) gives the matrix for the coarsest grid level (=level 0).
+        //! [Define coarse solver]
+        mg->setCoarseSolver( makeSparseCholeskySolver( mg->matrix(0) ) );
+        //! [Define coarse solver]
+
+        // Set up of the smoothers
+        // This has to be done for each grid level separately
         //! [Define smoothers]
-        else
+        for (index_t i = 1; i < mg->numLevels(); ++i)
         {
-            gsInfo << "\n\nThe chosen smoother is unknown.\n\nKnown are:\n  Richardson (r)\n  Jacobi (j)\n  GaussSeidel (gs)"
-                      "\n  IncompleteLU (ilu)\n  SubspaceCorrectedMassSmoother (scms)\n  Hybrid (hyb)\n\n";
-            return EXIT_FAILURE;
-        }
+            gsPreconditionerOp<>::Ptr smootherOp;
+            if ( smoother == "Richardson" || smoother == "r" )
+                smootherOp = makeRichardsonOp(mg->matrix(i));
+            else if ( smoother == "Jacobi" || smoother == "j" )
+                smootherOp = makeJacobiOp(mg->matrix(i));
+            else if ( smoother == "GaussSeidel" || smoother == "gs" )
+                smootherOp = makeGaussSeidelOp(mg->matrix(i));
+            else if ( smoother == "MulticolorGaussSeidel" || smoother == "mgs" )
+                smootherOp = makeMulticolorGaussSeidelOp(mg->matrix(i));
+            else if ( smoother == "Chebyshev" || smoother == "cheb" )
+                smootherOp = makeChebyshevOp(mg->matrix(i));
+            else if ( smoother == "IncompleteLU" || smoother == "ilu" )
+                smootherOp = makeIncompleteLUOp(mg->matrix(i));
+            else if ( smoother == "SubspaceCorrectedMassSmoother" || smoother == "scms" )
+                smootherOp = setupSubspaceCorrectedMassSmoother( i, mg->numLevels(), mg->matrix(i),
+                    multiBases[i], bc, cmd.getGroup("MG"), patchLocalDampingParameters );
+            else if ( smoother == "Hybrid" || smoother == "hyb" )
+                smootherOp = gsCompositePrecOp<>::make(
+                    makeGaussSeidelOp(mg->matrix(i)),
+                    setupSubspaceCorrectedMassSmoother( i, mg->numLevels(), mg->matrix(i),
+                        multiBases[i], bc, cmd.getGroup("MG"), patchLocalDampingParameters )
+                    );
+            //! [Define smoothers]
+            else
+            {
+                gsInfo << "\n\nThe chosen smoother is unknown.\n\nKnown are:\n  Richardson (r)\n  Jacobi (j)\n  GaussSeidel (gs)"
+                          "\n  MulticolorGaussSeidel (mgs)\n  Chebyshev (cheb)"
+                          "\n  IncompleteLU (ilu)\n  SubspaceCorrectedMassSmoother (scms)\n  Hybrid (hyb)\n\n";
+                return EXIT_FAILURE;
+            }
 
-        //! [Define smoothers2]
-        smootherOp->setOptions( cmd.getGroup("MG") );
-        //! [Define smoothers2]
+            //! [Define smoothers2]
+            smootherOp->setOptions( cmd.getGroup("MG") );
+            //! [Define smoothers2]
 
-        // Handle the extra-smooth option. On the finest grid level, there is nothing to handle.
-        if (extrasmooth && i < mg->numLevels()-1)
-        {
-            smootherOp->setNumOfSweeps( 1 << (mg->numLevels()-1-i) );
-            smootherOp = gsPreconditionerFromOp<>::make(mg->underlyingOp(i),smootherOp);
-        }
+            // Handle the extra-smooth option. On the finest grid level, there is nothing to handle.
+            if (extrasmooth && i < mg->numLevels()-1)
+            {
+                smootherOp->setNumOfSweeps( 1 << (mg->numLevels()-1-i) );
+                smootherOp = gsPreconditionerFromOp<>::make(mg->underlyingOp(i),smootherOp);
+            }
 
-    //! [Define smoothers3]
-        mg->setSmoother(i, smootherOp);
-    } // end for
-    //! [Define smoothers3]
+        //! [Define smoothers3]
+            mg->setSmoother(i, smootherOp);
+        } // end for
+        //! [Define smoothers3]
+
+        prec = mg;
+    }
 
     gsMatrix<> errorHistory;
 
@@ -342,11 +365,11 @@ int main(int argc, char *argv[])
 
     //! [Solve]
     if (iterativeSolver=="cg")
-        gsConjugateGradient<>( assembler.matrix(), mg )
+        gsConjugateGradient<>( assembler.matrix(), prec )
             .setOptions( cmd.getGroup("Solver") )
             .solveDetailed( assembler.rhs(), x, errorHistory );
     else if (iterativeSolver=="d")
-        gsGradientMethod<>( assembler.matrix(), mg )
+        gsGradientMethod<>( assembler.matrix(), prec )
             .setOptions( cmd.getGroup("Solver") )
             .solveDetailed( assembler.rhs(), x, errorHistory );
     //! [Solve]
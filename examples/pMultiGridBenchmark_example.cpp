@@ -0,0 +1,123 @@
+/** @file pMultiGridBenchmark_example.cpp
+
+    @brief Compares the p-multigrid preconditioner (gsPMultiGridOp) with
+    h-multigrid for high-degree discretizations of the Poisson equation.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): R. Tielen, S. Takacs
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+// Solves the system with BiCGStab, preconditioned with the given operator,
+// and prints the number of iterations and the timings
+bool solve(const std::string & name, const gsSparseMatrix<> & matrix, const gsMatrix<> & rhs,
+           const gsPreconditionerOp<>::Ptr & prec, double setupTime, real_t tol, index_t maxIter)
+{
+    gsBiCgStab<> solver(matrix, prec);
+    solver.setTolerance(tol);
+    solver.setMaxIterations(maxIter);
+    gsMatrix<> x;
+    x.setZero(matrix.rows(), 1);
+    gsStopwatch time;
+    solver.solve(rhs, x);
+    const double solveTime = time.stop();
+    const bool success = solver.error() <= solver.tolerance();
+    gsInfo << std::setw(10) << name << std::setw(10) << solver.iterations()
+           << std::setw(12) << setupTime << std::setw(12) << solveTime
+           << (success ? "" : "  (not converged)") << "\n";
+    return success;
+}
+
+int main(int argc, char *argv[])
+{
+    index_t degree = 3;
+    index_t refinements = 3;
+    index_t splitPatches = 0;
+    bool threeD = false;
+    std::string smoother("BlockILUT");
+    real_t tol = 1e-8;
+    index_t maxIter = 100;
+
+    gsCmdLine cmd("Compares p-multigrid and h-multigrid for high-degree discretizations of the Poisson equation.");
+    cmd.addInt   ("p", "Degree",       "Spline degree", degree);
+    cmd.addInt   ("r", "Refinements",  "Number of uniform h-refinement steps", refinements);
+    cmd.addInt   ("",  "SplitPatches", "Split every patch that many times in 2^d patches", splitPatches);
+    cmd.addSwitch("3d",                "Use the unit cube instead of the quarter annulus", threeD);
+    cmd.addString("s", "Smoother",     "Smoother for p-multigrid: BlockILUT, ILUT or GaussSeidel", smoother);
+    cmd.addReal  ("t", "Tolerance",    "Stopping criterion for BiCGStab", tol);
+    cmd.addInt   ("",  "MaxIter",      "Maximum number of iterations", maxIter);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    gsMultiPatch<> mp;
+    if (threeD)
+        mp = gsMultiPatch<>(*gsNurbsCreator<>::BSplineCube());
+    else
+        mp = gsMultiPatch<>(*gsNurbsCreator<>::BSplineFatQuarterAnnulus(1.0, 2.0));
+    for (index_t i = 0; i < splitPatches; ++i)
+        mp = mp.uniformSplit();
+
+    gsFunctionExpr<> f(threeD ? "3*pi^2*sin(pi*x)*sin(pi*y)*sin(pi*z)" : "2*pi^2*sin(pi*x)*sin(pi*y)", mp.geoDim());
+    gsFunctionExpr<> g("0", mp.geoDim());
+    gsBoundaryConditions<> bc;
+    for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+        bc.addCondition(*it, condition_type::dirichlet, &g);
+    bc.setGeoMap(mp);
+
+    gsMultiBasis<> mb(mp);
+    for (size_t i = 0; i < mb.nBases(); ++i)
+        mb[i].setDegreePreservingMultiplicity(degree);
+    for (index_t i = 0; i < refinements; ++i)
+        mb.uniformRefine();
+
+    gsOptionList opt = gsPMultiGridOp<>::defaultOptions();
+    opt.setInt("DirichletStrategy", dirichlet::elimination);
+    opt.setInt("InterfaceStrategy", iFace::glue);
+    opt.setString("Smoother", smoother);
+
+    gsPoissonAssembler<> assembler(mp, mb, bc, f, dirichlet::elimination, iFace::glue);
+    assembler.assemble();
+    const gsSparseMatrix<> & matrix = assembler.matrix();
+    const gsMatrix<> & rhs = assembler.rhs();
+
+    gsInfo << "Degree " << degree << ", " << mp.nPatches() << " patches, "
+           << matrix.rows() << " dofs\n\n"
+           << "    method     iter    setup[s]    solve[s]\n";
+
+    gsStopwatch time;
+    bool success = true;
+
+    // h-multigrid with Gauss-Seidel smoothing on all levels
+    {
+        time.restart();
+        gsOptionList hopt = opt;
+        hopt.setInt("Levels", refinements+1);
+        std::vector< gsSparseMatrix<real_t,RowMajor> > transferMatrices;
+        gsGridHierarchy<>::buildByCoarsening(mb, bc, hopt).moveTransferMatricesTo(transferMatrices);
+        gsMultiGridOp<>::Ptr mg = gsMultiGridOp<>::make(matrix, transferMatrices);
+        for (index_t i = 1; i < mg->numLevels(); ++i)
+            mg->setSmoother(i, makeGaussSeidelOp(mg->matrix(i)));
+        success &= solve("h-MG", matrix, rhs, mg, time.stop(), tol, maxIter);
+    }
+
+    // p-multigrid: reduce the degree to 1, then coarsen the grid (such
+    // that the coarsest grid still has interior dofs)
+    {
+        time.restart();
+        gsOptionList popt = opt;
+        popt.setInt("Levels", degree+refinements-1);
+        gsPMultiGridOp<>::Ptr pmg = gsPMultiGridOp<>::make(mp, mb, bc, matrix, popt);
+        success &= solve("p-MG", matrix, rhs, pmg, time.stop(), tol, maxIter);
+        gsInfo << "p-multigrid levels: " << pmg->numLevels()
+               << " (coarsening " << pmg->coarsening() << ")\n";
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -23,13 +23,6 @@ gsPreconditionerOp<>::Ptr setupSubspaceCorrectedMassSmoother(
     const gsOptionList&
 );
 
-gsPreconditionerOp<>::Ptr setupBlockILUT(
-    const gsSparseMatrix<>&,
-    const gsMultiBasis<>&,
-    const gsBoundaryConditions<>&,
-    const gsOptionList&
-);
-
 gsMatrix<> assembleLumpedMass(
     const gsMultiPatch<>& mp,
     const gsMultiBasis<>& basis,
@@ -535,7 +528,7 @@ int main(int argc, char* argv[])
                 gsInfo << "Smoother for level " << i << ": Subspace corrected mass smoother (damping = "<<dampingSCMS<<")\n";
                 break;
             case 4:
-                mg->setSmoother(i,setupBlockILUT(matrices[i], bases[i], bcInfo, opt));
+                mg->setSmoother(i,gsBlockILUTOp<>::make(memory::make_shared_not_owned(&matrices[i]), bases[i], bcInfo, opt));
                 gsInfo << "Smoother for level " << i << ": Blockwise Incomplete LU\n";
                 break;
             default:
@@ -698,106 +691,6 @@ gsPreconditionerOp<>::Ptr setupSubspaceCorrectedMassSmoother(
     return give(result);
 }
 
-gsPreconditionerOp<>::Ptr setupBlockILUT(
-    const gsSparseMatrix<>& A,
-    const gsMultiBasis<>& mb,
-    const gsBoundaryConditions<>& bc,
-    const gsOptionList& opt
-)
-{
-    const index_t nPatches = mb.nPieces();
-
-    // Setup dof mapper
-    gsDofMapper dm;
-    mb.getMapper(
-       (dirichlet::strategy)opt.getInt("DirichletStrategy"),
-       iFace::glue,
-       bc,
-       dm,
-       0
-    );
-    // Subdivide the overal dofs into
-    //   a) the patch-local dofs (l=0,...,nPatches-1)
-    //   b) the coupled dofs (l=nPatches)
-    std::vector<index_t> sizes(nPatches+1);
-    std::vector<index_t> shifts(nPatches+1);
-    shifts[0] = 0;
-    for (index_t k=0; k<nPatches; k++)
-    {
-        sizes[k] = dm.findFreeUncoupled(k).rows();
-        shifts[k+1] = shifts[k] + sizes[k];
-    }
-    sizes[nPatches] = A.rows() - shifts[nPatches];
-
-    // Vector of factorized operators
-    std::vector< gsEigen::PermutationMatrix<Dynamic,Dynamic,index_t> > P(nPatches+1);
-    // Vector of factorized operators
-    std::vector< gsEigen::PermutationMatrix<Dynamic,Dynamic,index_t> > Pinv(nPatches+1);
-    // Define the A_aprox matrix
-    // Inefficient since it does not use a sparse matrix
-    gsMatrix<> A_aprox(A.rows(),A.cols());
-    A_aprox.setZero();
-
-    gsSparseMatrix<> S = A.block(shifts[nPatches],shifts[nPatches],sizes[nPatches],sizes[nPatches]);
-
-    for (index_t k=0 ; k<nPatches; k++)
-    {
-        // Diagonal entries
-        gsSparseMatrix<> block = A.block(shifts[k],shifts[k],sizes[k],sizes[k]);
-        gsEigen::IncompleteLUT<real_t> ilu;
-        ilu.setFillfactor(1);
-        ilu.compute(block);
-        P[k] = ilu.fillReducingPermutation();
-        Pinv[k] = ilu.inversePermutation();
-        A_aprox.block(shifts[k],shifts[k],sizes[k],sizes[k]) = ilu.factors();
-
-        // Schur complement and off-diagonal contributions
-        if (sizes[nPatches]>0)
-        {
-            gsMatrix<> ddB = A.block(shifts[nPatches],shifts[k],sizes[nPatches],sizes[k]);
-            gsMatrix<> ddC = A.block(shifts[k],shifts[nPatches],sizes[k],sizes[nPatches]);
-            gsMatrix<> ddBtilde = ilu.factors().triangularView<gsEigen::Upper>().transpose().solve((ddB*P[k]).transpose()).transpose();
-            gsMatrix<> ddCtilde = ilu.factors().triangularView<gsEigen::UnitLower>().solve(Pinv[k]*ddC);
-
-            S -= (ddBtilde*ddCtilde).sparseView();
-            A_aprox.block(shifts[k],shifts[nPatches],sizes[k],sizes[nPatches]) = ddCtilde;
-            A_aprox.block(shifts[nPatches],shifts[k],sizes[nPatches],sizes[k]) = ddBtilde;
-        }
-    }
-
-    // If there is no coupling (for example if there is only one patch), the work
-    // is done. We should not try to compute the ilu factorization then.
-    if (sizes[nPatches]>0)
-    {
-        // Preform ILUT on the S-matrix.
-        gsEigen::IncompleteLUT<real_t> ilu;
-        ilu.setFillfactor(1);
-        ilu.compute(S);
-        P[nPatches] = ilu.fillReducingPermutation();
-        Pinv[nPatches] = ilu.inversePermutation();
-        A_aprox.block(shifts[nPatches],shifts[nPatches],sizes[nPatches],sizes[nPatches]) = ilu.factors();
-    }
-
-    return gsPreconditionerFromOp<>::make(
-        makeMatrixOp(A),
-        makeLinearOp(
-            [m_A_aprox=give(A_aprox), m_P=give(P), m_Pinv=give(Pinv),m_shifts=give(shifts),m_sizes=give(sizes),
-                m_nPatches=nPatches](const gsMatrix<>& rhs, gsMatrix<>& x)
-            {
-                x.setZero(rhs.rows(),rhs.cols());
-                for (index_t k=0; k<=m_nPatches; ++k)
-                    x.block(m_shifts[k],0,m_sizes[k],1) = m_Pinv[k]*rhs.block(m_shifts[k],0,m_sizes[k],1);
-                x = m_A_aprox.template triangularView<gsEigen::UnitLower>().solve(x);
-                x = m_A_aprox.template triangularView<gsEigen::Upper>().solve(x);
-                for (index_t k=0; k<=m_nPatches; ++k)
-                    x.block(m_shifts[k],0,m_sizes[k],1) = m_P[k]*x.block(m_shifts[k],0,m_sizes[k],1);
-            },
-            A.rows(),
-            A.cols()
-        )
-    );
-}
-
 /// @brief Determine \f$ \int_\Omega p_i dx \f$ with basis functions \f$ p_i \f$ as vector
 /// The entries of this vector are the row-sums of the mass matrix
 gsMatrix<> assembleLumpedMass(
@@ -0,0 +1,88 @@
+/** @file parametrizationBenchmark_example.cpp
+
+    @brief Timings of the Floater parametrization (gsParametrization)
+    for triangle meshes of increasing size.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): D. Mokris
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+// Triangulation of a curved square patch with n x n cells
+void makeMesh(gsMesh<> & mesh, index_t n)
+{
+    mesh = gsMesh<>();
+    mesh.reserve((n+1)*(n+1), 2*n*n, 0);
+    std::vector<gsMesh<>::VertexHandle> v;
+    v.reserve((n+1)*(n+1));
+    for (index_t j = 0; j <= n; ++j)
+        for (index_t i = 0; i <= n; ++i)
+        {
+            const real_t x = (real_t)i/n, y = (real_t)j/n;
+            v.push_back( mesh.addVertex(x, y, math::sin(3*x) * math::cos(2*y) / 4) );
+        }
+    for (index_t j = 0; j < n; ++j)
+        for (index_t i = 0; i < n; ++i)
+        {
+            const index_t k = j*(n+1) + i;
+            mesh.addFace(v[k], v[k+1], v[k+n+2]);
+            mesh.addFace(v[k], v[k+n+2], v[k+n+1]);
+        }
+}
+
+int main(int argc, char *argv[])
+{
+    index_t nMin = 10;
+    index_t nMax = 40;
+    index_t parametrizationMethod = 1; // 1:shape, 2:uniform, 3:distance
+
+    gsCmdLine cmd("Timings of the Floater parametrization for meshes of increasing size.\n"
+                  "The meshes have (n+1)^2 vertices, where n is doubled from the minimal to the maximal value;"
+                  " use -N 1000 for meshes with up to 10^6 vertices.");
+    cmd.addInt("n", "min", "Minimal number of cells per direction", nMin);
+    cmd.addInt("N", "max", "Maximal number of cells per direction", nMax);
+    cmd.addInt("m", "parametrizationMethod", "Parametrization method {1: shape, 2: uniform, 3: distance}", parametrizationMethod);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    gsOptionList opt = gsParametrization<real_t>::defaultOptions();
+    opt.setInt("parametrizationMethod", parametrizationMethod);
+    opt.setInt("boundaryMethod", 4);
+
+    gsInfo << "  vertices   setup[s]   compute[s]\n";
+    bool ok = true;
+    gsMesh<> mesh;
+    gsStopwatch time;
+    for (index_t n = nMin; n <= nMax; n *= 2)
+    {
+        makeMesh(mesh, n);
+
+        time.restart();
+        gsParametrization<real_t> pm(mesh, opt);
+        const double setup = time.stop();
+
+        time.restart();
+        pm.compute();
+        const double compute = time.stop();
+
+        gsInfo << std::setw(10) << mesh.numVertices() << std::setw(11) << setup
+               << std::setw(13) << compute << "\n";
+
+        // All parameters lie in the unit square
+        const gsMatrix<> uv = pm.createUVmatrix();
+        if ( uv.minCoeff() < -1e-10 || uv.maxCoeff() > 1 + 1e-10 )
+        {
+            gsWarn << "Parameters outside of the unit square.\n";
+            ok = false;
+        }
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,123 @@
+/** @file smootherBenchmark_example.cpp
+
+    @brief Compares the parallel multigrid smoothers (multicolor
+    Gauss-Seidel, Chebyshev) with the sequential Gauss-Seidel sweeps for
+    the Poisson equation.
+
+    Execute, e.g., with 4 threads:
+       OMP_NUM_THREADS=4 ./bin/smootherBenchmark_example
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+int main(int argc, char *argv[])
+{
+    index_t degree = 2;
+    index_t refinements = 5;
+    bool threeD = false;
+    index_t numSteps = 10;
+    real_t tol = 1e-8;
+    index_t maxIter = 100;
+
+    gsCmdLine cmd("Compares parallel and sequential multigrid smoothers for the Poisson equation.");
+    cmd.addInt   ("p", "Degree",      "Spline degree", degree);
+    cmd.addInt   ("r", "Refinements", "Number of uniform h-refinement steps", refinements);
+    cmd.addSwitch("3d",               "Use the unit cube instead of the quarter annulus", threeD);
+    cmd.addInt   ("s", "Steps",       "Number of smoothing steps for measuring the time per step", numSteps);
+    cmd.addReal  ("t", "Tolerance",   "Stopping criterion for the conjugate gradient method", tol);
+    cmd.addInt   ("",  "MaxIter",     "Maximum number of iterations", maxIter);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    gsMultiPatch<> mp;
+    if (threeD)
+        mp = gsMultiPatch<>(*gsNurbsCreator<>::BSplineCube());
+    else
+        mp = gsMultiPatch<>(*gsNurbsCreator<>::BSplineFatQuarterAnnulus(1.0, 2.0));
+
+    gsFunctionExpr<> f(threeD ? "3*pi^2*sin(pi*x)*sin(pi*y)*sin(pi*z)" : "2*pi^2*sin(pi*x)*sin(pi*y)", mp.geoDim());
+    gsFunctionExpr<> g("0", mp.geoDim());
+    gsBoundaryConditions<> bc;
+    for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+        bc.addCondition(*it, condition_type::dirichlet, &g);
+    bc.setGeoMap(mp);
+
+    gsMultiBasis<> mb(mp);
+    for (size_t i = 0; i < mb.nBases(); ++i)
+        mb[i].setDegreePreservingMultiplicity(degree);
+    for (index_t i = 0; i < refinements; ++i)
+        mb.uniformRefine();
+
+    gsPoissonAssembler<> assembler(mp, mb, bc, f, dirichlet::elimination, iFace::glue);
+    assembler.assemble();
+    const gsSparseMatrix<> & matrix = assembler.matrix();
+    const gsMatrix<> & rhs = assembler.rhs();
+
+    gsOptionList opt;
+    opt.addInt("DirichletStrategy", "", dirichlet::elimination);
+    opt.addInt("InterfaceStrategy", "", iFace::glue);
+    opt.addInt("Levels", "", refinements+1);
+    std::vector< gsSparseMatrix<real_t,RowMajor> > transferMatrices;
+    gsGridHierarchy<>::buildByCoarsening(mb, bc, opt).moveTransferMatricesTo(transferMatrices);
+    gsMultiGridOp<>::Ptr mg = gsMultiGridOp<>::make(matrix, transferMatrices);
+    mg->setCoarseSolver(makeSparseCholeskySolver(mg->matrix(0)));
+
+    gsInfo << "Degree " << degree << ", " << matrix.rows() << " dofs, "
+           << mg->numLevels() << " levels, threads: " << omp_get_max_threads() << "\n\n"
+           << "      smoother    setup[s]   per step[s]    iter    solve[s]\n";
+
+    const char * names[] = { "GS", "symm. GS", "mc. GS", "symm. mc. GS", "Chebyshev" };
+    gsStopwatch time;
+    bool success = true;
+    for (index_t s = 0; s < 5; ++s)
+    {
+        time.restart();
+        for (index_t i = 1; i < mg->numLevels(); ++i)
+        {
+            gsPreconditionerOp<>::Ptr sm;
+            switch (s)
+            {
+                case 0: sm = makeGaussSeidelOp(mg->matrix(i)); break;
+                case 1: sm = makeSymmetricGaussSeidelOp(mg->matrix(i)); break;
+                case 2: sm = makeMulticolorGaussSeidelOp(mg->matrix(i)); break;
+                case 3: sm = makeSymmetricMulticolorGaussSeidelOp(mg->matrix(i)); break;
+                default: sm = makeChebyshevOp(mg->matrix(i));
+            }
+            mg->setSmoother(i, sm);
+        }
+        const double setupTime = time.stop();
+
+        // Time of the smoothing on the finest grid
+        gsMatrix<> x;
+        x.setZero(matrix.rows(), 1);
+        time.restart();
+        for (index_t k = 0; k < numSteps; ++k)
+            mg->smoother(mg->numLevels()-1)->step(rhs, x);
+        const double stepTime = time.stop() / numSteps;
+
+        gsConjugateGradient<> solver(matrix, mg);
+        solver.setTolerance(tol);
+        solver.setMaxIterations(maxIter);
+        x.setZero(matrix.rows(), 1);
+        time.restart();
+        solver.solve(rhs, x);
+        const double solveTime = time.stop();
+        success &= solver.error() <= tol;
+
+        gsInfo << std::setw(14) << names[s] << std::setw(12) << setupTime
+               << std::setw(14) << stepTime << std::setw(8) << solver.iterations()
+               << std::setw(12) << solveTime
+               << (solver.error() <= tol ? "" : "  (not converged)") << "\n";
+    }
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
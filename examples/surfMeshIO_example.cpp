@@ -0,0 +1,124 @@
+/** @file surfMeshIO_example.cpp
+
+    @brief Compares the memory-mapped mesh readers of gsSurfMesh with
+    the stdio-based readers (throughput benchmark).
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#include <gismo.h>
+#include <gsMesh2/IO.h>
+
+using namespace gismo;
+
+typedef bool (*meshReader)(gsSurfMesh&, const std::string&);
+
+// Triangulation of a wavy square with n x n cells
+void makeMesh(gsSurfMesh & mesh, index_t n)
+{
+    mesh.clear();
+    mesh.reserve((n+1)*(n+1), 3*n*n + 2*n, 2*n*n);
+    for (index_t j = 0; j <= n; ++j)
+        for (index_t i = 0; i <= n; ++i)
+            mesh.add_vertex( Point((real_t)i/n, (real_t)j/n,
+                                   math::sin(6.0*i/n) * math::cos(6.0*j/n) / 10) );
+    for (index_t j = 0; j < n; ++j)
+        for (index_t i = 0; i < n; ++i)
+        {
+            const int v = j*(n+1) + i;
+            mesh.add_triangle(gsSurfMesh::Vertex(v), gsSurfMesh::Vertex(v+1),
+                              gsSurfMesh::Vertex(v+n+2));
+            mesh.add_triangle(gsSurfMesh::Vertex(v), gsSurfMesh::Vertex(v+n+2),
+                              gsSurfMesh::Vertex(v+n+1));
+        }
+}
+
+// Binary STL writer (write_stl writes ASCII files)
+void writeBinaryStl(const gsSurfMesh & mesh, const std::string & fn)
+{
+    std::ofstream out(fn.c_str(), std::ios::binary);
+    char header[80] = "binary STL written by G+Smo";
+    out.write(header, 80);
+    const uint32_t nT = mesh.n_faces();
+    out.write(reinterpret_cast<const char*>(&nT), 4);
+    auto points = mesh.get_vertex_property<Point>("v:point");
+    float rec[12] = {0};
+    const uint16_t attr = 0;
+    for (auto f : mesh.faces())
+    {
+        int k = 3;
+        for (auto v : mesh.vertices(f))
+            for (int c = 0; c < 3; ++c)
+                rec[k++] = static_cast<float>(points[v][c]);
+        out.write(reinterpret_cast<const char*>(rec), sizeof(rec));
+        out.write(reinterpret_cast<const char*>(&attr), 2);
+    }
+}
+
+// Reads fn with the given reader, returns the time per read
+double timeReader(meshReader read, const std::string & fn, index_t reps,
+                  gsSurfMesh & mesh)
+{
+    gsStopwatch time;
+    for (index_t r = 0; r < reps; ++r)
+        read(mesh, fn);
+    return time.stop() / reps;
+}
+
+int main(int argc, char *argv[])
+{
+    index_t n = 100;
+    index_t reps = 3;
+    gsCmdLine cmd("Compares the memory-mapped mesh readers with the stdio-based ones.");
+    cmd.addInt("n", "cells", "Number of cells per direction of the test mesh (2n^2 triangles)", n);
+    cmd.addInt("r", "reps", "Number of repetitions of each read", reps);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    gsSurfMesh mesh;
+    makeMesh(mesh, n);
+    mesh.update_face_normals();
+    gsInfo << "Test mesh: " << mesh.n_vertices() << " vertices, "
+           << mesh.n_faces() << " triangles.\n";
+
+    const std::string path = gsFileManager::getTempPath();
+    const std::string fn[4] = { path + "surfMeshIO.off", path + "surfMeshIO.obj",
+                                path + "surfMeshIO_ascii.stl", path + "surfMeshIO_bin.stl" };
+    write_off(mesh, fn[0]);
+    write_obj(mesh, fn[1]);
+    write_stl(mesh, fn[2]);
+    writeBinaryStl(mesh, fn[3]);
+
+    const meshReader oldReader[4] = { read_off_stdio, read_obj_stdio, read_stl_stdio, read_stl_stdio };
+    const meshReader newReader[4] = { read_off, read_obj, read_stl, read_stl };
+
+    bool ok = true;
+    gsSurfMesh m0, m1;
+    gsInfo << "file                    MB    stdio[s]    mmap[s]    speedup   mmap[MB/s]  mmap[Mtri/s]\n";
+    for (int k = 0; k < 4; ++k)
+    {
+        const double mb = gsFileManager::fileExists(fn[k]) ?
+            (double)std::ifstream(fn[k].c_str(), std::ios::ate | std::ios::binary).tellg() / 1e6 : 0;
+        const double t0 = timeReader(oldReader[k], fn[k], reps, m0);
+        const double t1 = timeReader(newReader[k], fn[k], reps, m1);
+        gsInfo << std::setw(20) << gsFileManager::getFilename(fn[k])
+               << std::setw(8)  << std::setprecision(3) << mb
+               << std::setw(12) << t0 << std::setw(11) << t1
+               << std::setw(11) << t0/t1 << std::setw(13) << mb/t1
+               << std::setw(14) << m1.n_faces()/t1/1e6 << "\n";
+
+        if ( m1.n_vertices() != mesh.n_vertices() || m1.n_faces() != mesh.n_faces() )
+        {
+            gsWarn << "Reading " << fn[k] << " gave " << m1.n_vertices() << " vertices and "
+                   << m1.n_faces() << " faces.\n";
+            ok = false;
+        }
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
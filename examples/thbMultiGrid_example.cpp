@@ -0,0 +1,142 @@
+/** @file thbMultiGrid_example.cpp
+
+    @brief Multigrid solver for a Poisson problem discretized with
+    locally refined THB-splines.
+
+    The grid hierarchy is given by the levels of the THB-spline basis
+    (see gsGridHierarchy::buildByHierarchy) and the smoothing is
+    restricted to the degrees of freedom affected by the refinement.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): S. Takacs
+*/
+
+#include <gismo.h>
+
+using namespace gismo;
+
+int main(int argc, char *argv[])
+{
+    /************** Define command line options *************/
+
+    index_t refinements = 3;
+    index_t degree = 2;
+    index_t levels = 4;
+    index_t cycles = 1;
+    index_t presmooth = 1;
+    index_t postsmooth = 1;
+    bool global = false;
+    real_t tolerance = 1.e-8;
+    index_t maxIterations = 100;
+
+    gsCmdLine cmd("Solves a Poisson problem on a locally refined THB-spline space with multigrid.");
+    cmd.addInt   ("r", "Refinements",           "Number of uniform h-refinement steps of the initial grid", refinements);
+    cmd.addInt   ("p", "Degree",                "Degree of the THB-spline discretization space", degree);
+    cmd.addInt   ("l", "Levels",                "Number of local refinement steps towards the corner (0,0)", levels);
+    cmd.addInt   ("c", "MG.NumCycles",          "Number of multi-grid cycles", cycles);
+    cmd.addInt   ("",  "MG.NumPreSmooth",       "Number of pre-smoothing steps", presmooth);
+    cmd.addInt   ("",  "MG.NumPostSmooth",      "Number of post-smoothing steps", postsmooth);
+    cmd.addSwitch("",  "Global",                "Smooth on all degrees of freedom instead of the changed ones", global);
+    cmd.addReal  ("t", "Solver.Tolerance",      "Stopping criterion for linear solver", tolerance);
+    cmd.addInt   ("",  "Solver.MaxIterations",  "Stopping criterion for linear solver", maxIterations);
+    try { cmd.getValues(argc,argv); } catch (int rv) { return rv; }
+
+    cmd.addInt( "MG.InterfaceStrategy", "", (index_t)iFace::conforming      );
+    cmd.addInt( "MG.DirichletStrategy", "", (index_t)dirichlet::elimination );
+
+    /*********** Define geometry and basis *************/
+
+    gsMultiPatch<> mp( *gsNurbsCreator<>::BSplineSquare(1, 0, 0) );
+
+    gsTensorBSplineBasis<2> tbasis( gsKnotVector<>(0, 1, (1<<refinements)-1, degree+1),
+                                    gsKnotVector<>(0, 1, (1<<refinements)-1, degree+1) );
+    gsTHBSplineBasis<2> thb(tbasis);
+
+    // Refine the region [0,2^-lvl]^2 to level lvl
+    std::vector<index_t> boxes(5);
+    for (index_t lvl = 1; lvl <= levels; ++lvl)
+    {
+        boxes[0] = lvl;
+        boxes[1] = boxes[2] = 0;
+        boxes[3] = boxes[4] = 1<<refinements;
+        thb.refineElements(boxes);
+    }
+
+    gsMultiBasis<> mb(thb);
+    gsInfo << "THB-spline basis with " << thb.maxLevel()+1 << " levels and "
+           << thb.size() << " functions.\n";
+
+    /************ Boundary conditions and assembling ************/
+
+    gsConstantFunction<> f(1., 2);
+    gsConstantFunction<> g(0., 2);
+    gsBoundaryConditions<> bc;
+    for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+        bc.addCondition(*it, condition_type::dirichlet, &g);
+
+    gsPoissonAssembler<> assembler(
+        mp,
+        mb,
+        bc,
+        f,
+        (dirichlet::strategy) cmd.getInt("MG.DirichletStrategy"),
+        (iFace::strategy)     cmd.getInt("MG.InterfaceStrategy")
+    );
+    assembler.assemble();
+    gsInfo << "Number of degrees of freedom: " << assembler.matrix().rows() << "\n";
+
+    /**************** Setup solver and solve ****************/
+
+    gsStopwatch time;
+    std::vector< gsSparseMatrix<real_t,RowMajor> > transferMatrices;
+    gsGridHierarchy<>::buildByHierarchy(give(mb), bc, cmd.getGroup("MG"))
+        .moveTransferMatricesTo(transferMatrices);
+
+    gsMultiGridOp<>::Ptr mg = gsMultiGridOp<>::make( assembler.matrix(), transferMatrices );
+    mg->setOptions( cmd.getGroup("MG") );
+    mg->setCoarseSolver( makeSparseCholeskySolver( mg->matrix(0) ) );
+
+    index_t smoothed = 0;
+    for (index_t i = 1; i < mg->numLevels(); ++i)
+    {
+        gsPreconditionerOp<>::Ptr smootherOp;
+        if (global)
+        {
+            smootherOp = makeGaussSeidelOp(mg->matrix(i));
+            smoothed += mg->matrix(i).rows();
+        }
+        else
+        {
+            std::vector<index_t> dofs = gsGridHierarchy<>::changedDofs(transferMatrices[i-1]);
+            smoothed += dofs.size();
+            smootherOp = makeLocalGaussSeidelOp(mg->matrix(i), give(dofs));
+        }
+        mg->setSmoother(i, smootherOp);
+    }
+    const double setupTime = time.stop();
+
+    gsInfo << "Multigrid with " << mg->numLevels() << " levels, the smoothers act on "
+           << smoothed << " degrees of freedom in total.\n";
+
+    gsMatrix<> x;
+    x.setZero( assembler.matrix().rows(), 1 );
+    gsMatrix<> errorHistory;
+
+    time.restart();
+    gsConjugateGradient<>( assembler.matrix(), mg )
+        .setOptions( cmd.getGroup("Solver") )
+        .solveDetailed( assembler.rhs(), x, errorHistory );
+    const double solveTime = time.stop();
+
+    const index_t iter = errorHistory.rows()-1;
+    const bool success = errorHistory(iter,0) < tolerance;
+    gsInfo << (success ? "Reached" : "Did not reach") << " desired tolerance after "
+           << iter << " iterations (setup: " << setupTime << "s, solve: " << solveTime << "s).\n";
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
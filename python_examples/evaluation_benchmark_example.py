@@ -0,0 +1,70 @@
+#!/usr/bin/python
+
+""""
+    @file Evaluation benchmark example
+
+    @brief Evaluates a B-spline surface at many points, serially and
+    from several Python threads
+
+    The evaluation functions release the GIL, so the threads run in
+    parallel. The results are written directly into (slices of) one
+    NumPy array by eval_into.
+
+    Usage: python evaluation_benchmark_example.py [numPoints] [numThreads]
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): M. Moller
+"""
+
+import os, sys, time
+gismo_path=os.path.join(os.path.dirname(__file__), "../build/lib")
+print("G+Smo path:",gismo_path,"(change if needed).")
+sys.path.append(gismo_path)
+
+import pygismo as gs
+import numpy as np
+from concurrent.futures import ThreadPoolExecutor
+
+numPoints  = int(sys.argv[1]) if len(sys.argv) > 1 else 1000000
+numThreads = int(sys.argv[2]) if len(sys.argv) > 2 else os.cpu_count()
+
+# Bi-cubic B-spline surface with 16 x 16 elements
+knots = np.concatenate(([0.]*3, np.linspace(0., 1., 17), [1.]*3))
+kv = gs.nurbs.gsKnotVector(knots, 3)
+basis = gs.nurbs.gsTensorBSplineBasis2(kv, kv)
+rng = np.random.default_rng(0)
+coefs = rng.random((basis.size(), 3))
+surf = gs.nurbs.gsTensorBSpline2(basis, coefs)
+
+# The coefficients are a view of the memory of the geometry
+print("coefs() shares memory with the geometry:", np.shares_memory(surf.coefs(), surf.coefs()))
+
+# Points are columns; Fortran order matches the memory layout of gsMatrix
+u = np.asfortranarray(rng.random((2, numPoints)))
+
+start = time.perf_counter()
+serial = surf.eval(u)
+serialTime = time.perf_counter() - start
+print(f"Serial evaluation at {numPoints} points: {serialTime:.3f} s")
+
+# Each thread evaluates a block of columns into the corresponding slice of the result
+result = np.empty((3, numPoints), order='F')
+blocks = np.array_split(np.arange(numPoints), numThreads)
+
+def evaluate(block):
+    if len(block) > 0:
+        surf.eval_into(np.asfortranarray(u[:, block[0]:block[-1]+1]),
+                       result[:, block[0]:block[-1]+1])
+
+start = time.perf_counter()
+with ThreadPoolExecutor(max_workers=numThreads) as pool:
+    list(pool.map(evaluate, blocks))
+threadTime = time.perf_counter() - start
+print(f"Evaluation with {numThreads} threads: {threadTime:.3f} s (speedup {serialTime/threadTime:.2f})")
+
+assert np.allclose(serial, result)
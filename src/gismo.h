@@ -69,6 +69,7 @@ namespace internal
 #include <gsCore/gsBoxTopology.h>
 #include <gsCore/gsMultiPatch.h>
 #include <gsCore/gsField.h>
+#include <gsCore/gsPointLocator.h>
 
 #include <gsCore/gsBasis.h>
 
@@ -149,6 +150,8 @@ namespace internal
 /* ----------- MultiGrid ----------- */
 #include <gsMultiGrid/gsMultiGrid.h>
 #include <gsMultiGrid/gsGridHierarchy.h>
+#include <gsMultiGrid/gsAlgebraicMultiGrid.h>
+#include <gsMultiGrid/gsPMultiGrid.h>
 
 /* ----------- Quadrature ----------- */
 #include <gsAssembler/gsQuadRule.h>
@@ -160,6 +163,7 @@ namespace internal
 #include <gsAssembler/gsPoissonAssembler.h>
 #include <gsAssembler/gsCDRAssembler.h>
 #include <gsAssembler/gsHeatEquation.h>
+#include <gsAssembler/gsLinearTimeIntegrator.h>
 
 #include <gsAssembler/gsExprHelper.h>
 #include <gsAssembler/gsExprAssembler.h>
@@ -172,8 +176,12 @@ namespace internal
 #include <gsSolver/gsLinearOperator.h>
 #include <gsSolver/gsMinimalResidual.h>
 #include <gsSolver/gsGMRes.h>
+#include <gsSolver/gsSStepGMRes.h>
+#include <gsSolver/gsBlockGMRes.h>
 #include <gsSolver/gsGradientMethod.h>
 #include <gsSolver/gsConjugateGradient.h>
+#include <gsSolver/gsPipelinedConjugateGradient.h>
+#include <gsSolver/gsBlockConjugateGradient.h>
 #include <gsSolver/gsBiCgStab.h>
 #include <gsSolver/gsPreconditioner.h>
 #include <gsSolver/gsAdditiveOp.h>
@@ -186,6 +194,7 @@ namespace internal
 #include <gsSolver/gsPatchPreconditionersCreator.h>
 #include <gsSolver/gsLanczosMatrix.h>
 #include <gsSolver/gsMinResQLP.h>
+#include <gsSolver/gsDistributedMatrixOp.h>
 
 /* ----------- Ieti ----------- */
 #include <gsIeti/gsIetiMapper.h>
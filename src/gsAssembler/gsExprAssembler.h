@@ -42,6 +42,8 @@ private:
     std::vector<gsFeSpaceData<T>*> m_vrow;
     std::vector<gsFeSpaceData<T>*> m_vcol;
 
+    std::vector<index_t> m_patches;
+
     typedef typename gsExprHelper<T>::nullExpr    nullExpr;
 
 public:
@@ -141,6 +143,20 @@ public:
     void setGeometryMap(const gsMultiPatch<T> & gMap)
     { m_gmap = &gMap;}
 
+    /// \brief Restricts the assembly to the given patches, e.g., to the
+    /// patches owned by a process (see gsDistributedMatrixOp). Interface
+    /// terms are assembled if the first patch of the interface is given.
+    /// An empty list means all patches (default).
+    void setPatches(const std::vector<index_t> & patches)
+    { m_patches = patches; }
+
+    /// \brief Returns true iff the patch \a k takes part in the assembly
+    bool isActivePatch(index_t k) const
+    {
+        return m_patches.empty() ||
+            std::find(m_patches.begin(), m_patches.end(), k) != m_patches.end();
+    }
+
     const gsMultiPatch<T>& getGeometryMap() const
     {
         return (nullptr == m_gmap ? m_exprdata->multiPatch() : *m_gmap); 
@@ -455,17 +471,20 @@ private:
         gsMatrix<T>       & m_rhs;
         const gsVector<T> & m_quWeights;
         bool m_elim;
+        bool m_batched;
         gsMatrix<T>         localMat;
         gsMatrix<T>         aux;
+        gsMatrix<T>         m_L, m_R; // workspace for batched evaluation
 
         _eval(gsSparseMatrix<T> & _matrix,
               gsMatrix<T>       & _rhs,
               const gsVector<>  & _quWeights)
         : m_matrix(_matrix), m_rhs(_rhs),
-          m_quWeights(_quWeights), m_elim(true)
+          m_quWeights(_quWeights), m_elim(true), m_batched(true)
         { }
 
         void setElim(bool elim) {m_elim = elim;}
+        void setBatched(bool batched) {m_batched = batched;}
 
         template <typename E> void operator() (const gismo::expr::_expr<E> & ee)
         {
@@ -487,9 +506,26 @@ private:
 
         }// operator()
 
+        // Outer products (e.g. bilinear forms) are evaluated for all
+        // quadrature points at once, see expr::outer_product_traits
+        template <typename E>
+        inline typename util::enable_if<expr::outer_product_traits<E>::value>::type
+        quadrature(const gismo::expr::_expr<E> & ee, gsMatrix<T> & lm)
+        {
+            if (m_batched)
+                expr::batchedQuadrature(ee.derived(), m_quWeights, lm, m_L, m_R);
+            else
+                quadraturePointwise(ee, lm);
+        }
+
         template <typename E>
-        inline void quadrature(const gismo::expr::_expr<E> & ee,
-                               gsMatrix<T> & lm)
+        inline typename util::enable_if<!expr::outer_product_traits<E>::value>::type
+        quadrature(const gismo::expr::_expr<E> & ee, gsMatrix<T> & lm)
+        { quadraturePointwise(ee, lm); }
+
+        template <typename E>
+        inline void quadraturePointwise(const gismo::expr::_expr<E> & ee,
+                                        gsMatrix<T> & lm)
         {
             // ------- Compute  -------
             const T * w = m_quWeights.data();
@@ -642,6 +678,9 @@ gsOptionList gsExprAssembler<T>::defaultOptions()
     opt.addSwitch("overInt", "Apply over-integration on boundary elements or not?", false);
     opt.addSwitch("flipSide", "Flip side of interface where integration is performed.", false);
     opt.addSwitch("movingInterface", "Used in interface assembly when interface is not stationary.", false);
+    opt.addSwitch("batchedEval", "Evaluate outer products (bilinear forms) for all quadrature points of an element at once", true);
+    opt.addSwitch("shareSubexpressions", "Evaluate subexpressions that appear in several terms (e.g. igrad(u,G)) once per element", true);
+    opt.addInt ("elementCache", "Memory (MB) for keeping the values of the geometry maps and spaces at the quadrature nodes across assemblies (0: off)", 0);
     return opt;
 
     /// dirichlet treatment? elimination ????
@@ -752,6 +791,8 @@ void gsExprAssembler<T>::assemble(const expr &... args)
     GISMO_ASSERT(matrix().cols()==numDofs(), "System not initialized, matrix().cols() = "<<matrix().cols()<<"!="<<numDofs()<<" = numDofs()");
 
     bool failed = false;
+    m_exprdata->setShareCache(m_options.askSwitch("shareSubexpressions", true));
+    m_exprdata->setElementCache((size_t)m_options.askInt("elementCache", 0) * 1048576);
 #pragma omp parallel shared(failed)
 {
 #   ifdef _OPENMP
@@ -768,6 +809,7 @@ void gsExprAssembler<T>::assemble(const expr &... args)
 
     gsVector<T> quWeights; // quadrature weights
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
     const index_t elim = m_options.getInt("DirichletStrategy");
     ee.setElim(dirichlet::elimination==elim);
 
@@ -775,6 +817,8 @@ void gsExprAssembler<T>::assemble(const expr &... args)
     // elements, where Ep is the elements on the patch.
     for (unsigned patchInd = 0; patchInd < m_exprdata->multiBasis().nBases() && (!failed); ++patchInd) //todo: distribute in parallel somehow?
     {
+        if (!isActivePatch(patchInd)) continue;
+
         QuRule = gsQuadrature::getPtr(m_exprdata->multiBasis().basis(patchInd), m_options);
 
         // Initialize domain element iterator for current patch
@@ -799,8 +843,7 @@ void gsExprAssembler<T>::assemble(const expr &... args)
             // Perform required pre-computations on the quadrature nodes
             try
             {
-            m_exprdata->precompute(patchInd);
-            //m_exprdata->precompute(patchInd, QuRule, *domIt); // todo
+            m_exprdata->precompute(patchInd, boundary::none, domIt->id());
             }
             catch (...)
             {
@@ -837,6 +880,7 @@ void gsExprAssembler<T>::assembleBdr(const bcRefList & BCs, expr&... args)
 //     const int nt  = omp_get_num_threads();
 // #   endif
     auto arg_tpl = std::make_tuple(args...);
+    m_exprdata->setShareCache(m_options.askSwitch("shareSubexpressions", true));
     m_exprdata->parse(arg_tpl);
     m_exprdata->activateFlags(SAME_ELEMENT);
 
@@ -844,11 +888,13 @@ void gsExprAssembler<T>::assembleBdr(const bcRefList & BCs, expr&... args)
     gsVector<T> quWeights;               // quadrature weights
 
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
 
 //#   pragma omp parallel for
     for (typename bcRefList::const_iterator iit = BCs.begin(); iit!= BCs.end(); ++iit)
     {
         const boundary_condition<T> * it = &iit->get();
+        if (!isActivePatch(it->patch())) continue;
 
         QuRule = gsQuadrature::getPtr(m_exprdata->multiBasis().basis(it->patch()), m_options, it->side().direction());
 
@@ -893,18 +939,21 @@ void gsExprAssembler<T>::assembleBdr(const bContainer & bnd, expr&... args)
     if ( bnd.size()==0 || 0==numDofs() ) return;
 
     auto arg_tpl = std::make_tuple(args...);
+    m_exprdata->setShareCache(m_options.askSwitch("shareSubexpressions", true));
     m_exprdata->parse(arg_tpl);
 
     typename gsQuadRule<T>::uPtr QuRule; // Quadrature rule  ---->OUT
     gsVector<T> quWeights;               // quadrature weights
 
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
 
 //#   pragma omp parallel for
 
     for (gsBoxTopology::const_biterator it = bnd.begin();
          it != bnd.end(); ++it )
     {
+        if (!isActivePatch(it->patch)) continue;
         QuRule = gsQuadrature::getPtr(m_exprdata->multiBasis().basis(it->patch),
                                     m_options, it->side().direction());
 
@@ -947,12 +996,14 @@ void gsExprAssembler<T>::assembleIfc(const ifContainer & iFaces, expr... args)
 
     auto arg_tpl = std::make_tuple(args...);
 
+    m_exprdata->setShareCache(m_options.askSwitch("shareSubexpressions", true));
     m_exprdata->parse(arg_tpl);
     m_exprdata->activateFlags(SAME_ELEMENT); //note: SAME_ELEMENT is 0 at the opposite/mirrored patch
 
     typename gsQuadRule<T>::uPtr QuRule;
     gsVector<T> quWeights;// quadrature weights
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
 
     const bool flipSide = m_options.askSwitch("flipSide", false);
 
@@ -966,6 +1017,7 @@ void gsExprAssembler<T>::assembleIfc(const ifContainer & iFaces, expr... args)
         const boundaryInterface & iFace =  flipSide ? it->getInverse() : *it;
         const index_t patch1 = iFace.first() .patch;
         const index_t patch2 = iFace.second().patch;
+        if (!isActivePatch(patch1)) continue;
 
         if (iFace.type() == interaction::conforming)
             interfaceMap = gsAffineFunction<T>::make( iFace.dirMap(), iFace.dirOrientation(),
@@ -1018,6 +1070,7 @@ void gsExprAssembler<T>::assembleJacobian(const expr residual, solution & u)
     clearMatrix();
     clearRhs();
 
+    m_exprdata->setShareCache(m_options.askSwitch("shareSubexpressions", true));
 #pragma omp parallel
 {
 #   ifdef _OPENMP
@@ -1034,6 +1087,7 @@ void gsExprAssembler<T>::assembleJacobian(const expr residual, solution & u)
     gsVector<T> quWeights; // quadrature weights
 
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
 
     // Note: omp thread will loop over all patches and will work on Ep/nt
     // elements, where Ep is the elements on the patch.
@@ -1085,6 +1139,7 @@ void gsExprAssembler<T>::assembleJacobianIfc(const ifContainer & iFaces,
 
     // clearMatrix();
 
+    m_exprdata->setShareCache(m_options.askSwitch("shareSubexpressions", true));
     m_exprdata->parse(residual, u);
     m_exprdata->activateFlags(SAME_ELEMENT);
     //op_tuple(__printExpr(), arg_tpl);
@@ -1093,6 +1148,7 @@ void gsExprAssembler<T>::assembleJacobianIfc(const ifContainer & iFaces,
     gsVector<T> quWeights; // quadrature weights
 
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
     const bool flipSide = m_options.askSwitch("flipSide", false);
     const bool movingInterface = m_options.askSwitch("movingInterface", false);
 
@@ -1217,6 +1273,7 @@ void gsExprAssembler<T>::quPointsWeights(std::vector<gsMatrix<T> >&  cPoints, st
 
     gsVector<T> quWeights; // quadrature weights
     _eval ee(m_matrix, m_rhs, quWeights);
+    ee.setBatched(m_options.askSwitch("batchedEval", true));
     const index_t elim = m_options.getInt("DirichletStrategy");
     ee.setElim(dirichlet::elimination==elim);
 
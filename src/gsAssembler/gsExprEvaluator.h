@@ -426,7 +426,7 @@ T gsExprEvaluator<T>::compute_impl(const expr::_expr<E> & expr)
                           m_exprdata->points(), quWeights);
 
             // Perform required pre-computations on the quadrature nodes
-            m_exprdata->precompute(patchInd);
+            m_exprdata->precompute(patchInd, boundary::none, domIt->id());
 
             // Compute on element
             elVal = _op::init();
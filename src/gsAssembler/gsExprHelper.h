@@ -28,12 +28,14 @@ class gsExprHelper
 private:
     gsExprHelper(const gsExprHelper &);
 
-    gsExprHelper() : m_mirror(nullptr), mesh_ptr(nullptr),
-                     mutSrc(nullptr), mutMap(nullptr)
+    gsExprHelper() : m_shareCache(true), m_elLimit(0), m_elBytes(0),
+                     m_elHits(0), m_elMisses(0), m_mirror(nullptr),
+                     mesh_ptr(nullptr), mutSrc(nullptr), mutMap(nullptr)
     { }
 
     explicit gsExprHelper(gsExprHelper * m)
-    : m_mirror(memory::make_shared_not_owned(m)),
+    : m_shareCache(m->m_shareCache), m_elLimit(0), m_elBytes(0),
+      m_elHits(0), m_elMisses(0), m_mirror(memory::make_shared_not_owned(m)),
       mesh_ptr(m->mesh_ptr), mutSrc(nullptr), mutMap(nullptr)
     { }
 
@@ -45,14 +47,33 @@ private:
     typedef std::pair<const gsFunctionSet<T>*,thMapData*> CFuncKey;
     typedef std::map<CFuncKey,thFuncData>  CFuncData;
 
+    typedef util::gsThreaded<expr::expr_cache<T> > thCache;
+    typedef std::pair<const void*,const void*> CacheKey;
+    typedef std::map<CacheKey,thCache> CacheData;
+
     typedef typename FuncData::iterator FuncDataIt;
     typedef typename MapData ::iterator MapDataIt;
     typedef typename CFuncData ::iterator CFuncDataIt;
+    typedef typename CacheData ::iterator CacheDataIt;
+
+    // Element cache: source, patch, side and element index
+    typedef std::tuple<const gsFunctionSet<T>*,index_t,index_t,index_t> ElKey;
+    typedef std::map<ElKey,gsMapData<T> > ElData;
+    struct ElCache
+    {
+        ElData mdata;///< maps
+        ElData fdata;///< bases, with the points in gsMapData::points
+    };
 
     util::gsThreaded<gsMatrix<T> > m_points;
     FuncData  m_fdata;///< functions
     MapData   m_mdata;///< maps
     CFuncData m_cdata;///< compositions
+    CacheData m_cache;///< shared subexpressions
+    bool m_shareCache;
+
+    util::gsThreaded<ElCache> m_elCache;///< data kept across parse()
+    size_t m_elLimit, m_elBytes, m_elHits, m_elMisses;
 
     memory::shared_ptr<gsExprHelper> m_mirror;
 
@@ -102,6 +123,7 @@ public:
             m_mdata.clear();
             m_fdata.clear();
             m_cdata.clear();
+            m_cache.clear();
             //mutSrc = nullptr;
             mutMap = nullptr;
             mutData.mine().flags = 0;
@@ -110,6 +132,7 @@ public:
                 m_mirror->m_mdata.clear();
                 m_mirror->m_fdata.clear();
                 m_mirror->m_cdata.clear();
+                m_mirror->m_cache.clear();
                 //m_mirror->mutSrc = nullptr;
                 m_mirror->mutMap = nullptr;
                 m_mirror->mutData.mine().flags = 0;
@@ -119,6 +142,60 @@ public:
 
     void setMultiBasis(const gsMultiBasis<T> & mesh) { mesh_ptr = &mesh; }
 
+    /// If true (default), identical subexpressions of all parsed
+    /// expressions share one cache, see cache()
+    void setShareCache(bool share)
+    {
+        m_shareCache = share;
+        if (isMirrored()) m_mirror->m_shareCache = share;
+    }
+
+    /// Keeps the data of the geometry maps and of the bases (spaces)
+    /// at the quadrature nodes of the elements in memory, up to
+    /// (approximately) \a maxBytes bytes, such that repeated
+    /// assemblies on the same mesh, e.g. in Newton iterations or time
+    /// stepping, only evaluate the remaining functions.
+    ///
+    /// The data are re-used by precompute() calls with an element
+    /// index, if the quadrature nodes coincide and the data were
+    /// computed with (at least) the requested flags. Other functions,
+    /// e.g. given as a gsMultiPatch, are always evaluated, since they
+    /// might change. The caller has to clearElementCache() after
+    /// modifying a cached geometry or basis in place.
+    ///
+    /// Zero (default) disables and clears the cache.
+    void setElementCache(size_t maxBytes)
+    {
+        m_elLimit = maxBytes;
+        if (0==maxBytes) clearElementCache();
+    }
+
+    /// Removes all data from the element cache and resets the counters
+    void clearElementCache()
+    {
+        m_elCache = util::gsThreaded<ElCache>();
+        m_elBytes = m_elHits = m_elMisses = 0;
+    }
+
+    /// Number of data re-used from the element cache
+    size_t elementCacheHits() const { return m_elHits; }
+
+    /// Number of data computed while the element cache was enabled
+    size_t elementCacheMisses() const { return m_elMisses; }
+
+    /// Approximate memory used by the element cache, in bytes
+    size_t elementCacheBytes() const { return m_elBytes; }
+
+    /// Prints the hit rate and the memory of the element cache
+    std::ostream & printElementCache(std::ostream & os) const
+    {
+        const size_t n = m_elHits + m_elMisses;
+        os << "Element cache: " << m_elHits << " hits, " << m_elMisses
+           << " misses (" << (0==n ? 0. : 100. * m_elHits / n) << "% hit rate), "
+           << m_elBytes / 1048576. << " / " << m_elLimit / 1048576. << " MB\n";
+        return os;
+    }
+
     bool multiBasisSet() { return NULL!=mesh_ptr;}
 
     const gsMultiBasis<T> & multiBasis()
@@ -387,24 +464,131 @@ public:
         }
     }
 
+    /// Returns the cache for a subexpression depending on the space
+    /// \a u and the map \a G. Expressions calling this with the same
+    /// sources during parsing share the cached values, which are
+    /// invalidated by precompute().
+    expr::expr_cache<T> & cache(const expr::gsFeSpace<T> & u,
+                                const expr::gsGeometryMap<T> & G)
+    {
+        gsExprHelper & eh = (G.isAcross() ? iface() : *this);
+        CacheKey k = ( m_shareCache && u.isAcross()==G.isAcross() ?
+                       std::make_pair((const void*)&u.source(), (const void*)&G.source()) :
+                       std::make_pair((const void*)&u, (const void*)&G) );
+        expr::expr_cache<T> * res;
+#       pragma omp critical (m_cache_first_touch)
+        res = &eh.m_cache[k].mine();
+        return *res;
+    }
+
+private:
+
+    static size_t _elBytes(const gsMapData<T> & d)
+    {
+        size_t s = d.actives.size() * sizeof(index_t);
+        for (size_t i = 0; i != d.values.size(); ++i)
+            s += d.values[i].size() * sizeof(T);
+        return s + sizeof(T) *
+            ( d.curls.size() + d.divs.size() + d.laplacians.size() + d.points.size()
+              + d.measures.size() + d.fundForms.size() + d.jacInvTr.size()
+              + d.normals.size() + d.outNormals.size() );
+    }
+
+    // Copies the cached data of \a k to \a d if they were computed on
+    // the current points with (at least) the flags of \a d
+    template<class Data>
+    bool _fromElCache(const ElData & c, const ElKey & k, Data & d)
+    {
+        typename ElData::const_iterator it = c.find(k);
+        const gsMatrix<T> & pts = m_points.mine();
+        const bool hit = c.end()!=it && 0==(d.flags & ~it->second.flags) &&
+            it->second.points.cols()==pts.cols() && it->second.points==pts;
+        if (hit)
+        {
+            const unsigned flags = d.flags;
+            d = static_cast<const Data&>(it->second);
+            d.flags = flags;
+#           pragma omp atomic
+            ++m_elHits;
+        }
+        else
+        {
+#           pragma omp atomic
+            ++m_elMisses;
+        }
+        return hit;
+    }
+
+    // Stores \a d under \a k, unless the memory limit is reached
+    void _toElCache(ElData & c, const ElKey & k, const gsMapData<T> & d)
+    {
+        typename ElData::iterator it = c.find(k);
+        const size_t old = ( c.end()==it ? 0 : _elBytes(it->second) );
+        const size_t add = _elBytes(d);
+        size_t cur;
+#       pragma omp atomic read
+        cur = m_elBytes;
+        if (cur + add > m_elLimit + old) return;
+
+        if (c.end()==it) it = c.insert(std::make_pair(k, d)).first;
+        else it->second = d;
+#       pragma omp atomic
+        m_elBytes += add - old;
+    }
+
+public:
+
+    /// Evaluates the parsed functions at points() on the patch \a
+    /// patchIndex (or its side \a bs). If \a element is given (an
+    /// index of the element on the patch, e.g. gsDomainIterator::id())
+    /// the element cache is used, see setElementCache().
     void precompute(const index_t patchIndex = 0,
-                    boundary::side bs = boundary::none)
+                    boundary::side bs = boundary::none,
+                    const index_t element = -1)
     {
+        // The shared subexpressions are computed on demand
+        for (CacheDataIt it = m_cache.begin(); it != m_cache.end(); ++it)
+            it->second.mine().valid = false;
+
+        const bool useElCache = 0!=m_elLimit && -1!=element;
+        ElCache & elc = m_elCache.mine();
+
         //First compute the maps
         for (MapDataIt it = m_mdata.begin(); it != m_mdata.end(); ++it)
         {
-            it->second.mine().points.swap(m_points.mine());//swap
-            it->second.mine().side    = bs;
-            it->second.mine().patchId = patchIndex;
-            it->first->function(patchIndex).computeMap(it->second.mine());
-            it->second.mine().points.swap(m_points.mine());
+            gsMapData<T> & md = it->second.mine();
+            const ElKey k(it->first, patchIndex, bs, element);
+            if ( useElCache && _fromElCache(elc.mdata, k, md) )
+                continue;
+
+            md.points.swap(m_points.mine());//swap
+            md.side    = bs;
+            md.patchId = patchIndex;
+            it->first->function(patchIndex).computeMap(md);
+            if ( useElCache ) _toElCache(elc.mdata, k, md);
+            md.points.swap(m_points.mine());
         }
 
+        gsMapData<T> fd;
         for (FuncDataIt it = m_fdata.begin(); it != m_fdata.end(); ++it)
         {
+            // Only the bases are cached, the values of other functions may change
+            const bool cached = useElCache &&
+                ( nullptr!=dynamic_cast<const gsMultiBasis<T>*>(it->first) ||
+                  nullptr!=dynamic_cast<const gsBasis<T>*>(it->first) );
+            const ElKey k(it->first, patchIndex, bs, element);
+            if ( cached && _fromElCache(elc.fdata, k, it->second.mine()) )
+                continue;
+
             it->second.mine().patchId = patchIndex;
             it->first->piece(patchIndex)
                 .compute(m_points, it->second.mine());
+            if ( cached )
+            {
+                static_cast<gsFuncData<T>&>(fd) = it->second.mine();
+                fd.points = m_points.mine();
+                _toElCache(elc.fdata, k, fd);
+            }
         }
 
         for (CFuncDataIt it = m_cdata.begin(); it != m_cdata.end(); ++it)
@@ -1640,6 +1640,9 @@ public:
 
     index_t cardinality_impl() const { return _u.cardinality_impl(); }
 
+    /// Returns the transposed expression
+    const E & arg() const { return _u; }
+
     void print(std::ostream &os) const { os<<"("; _u.print(os); os <<")\u1D40"; }
 private:
 /*
@@ -2100,20 +2103,105 @@ GISMO_EXPR_VECTOR_EXPRESSION(norm,norm,1);
 GISMO_EXPR_VECTOR_EXPRESSION(sqNorm,squaredNorm,1);
 /// Normalization of a vector to unit measure
 GISMO_EXPR_VECTOR_EXPRESSION(normalized,normalized,0);
-/// Inverse of a matrix expression
-GISMO_EXPR_VECTOR_EXPRESSION(inv,cramerInverse,0);
 // GISMO_EXPR_VECTOR_EXPRESSION(cwSqr,array().square,0)
 // GISMO_EXPR_VECTOR_EXPRESSION(sum,array().sum,1)
 // GISMO_EXPR_VECTOR_EXPRESSION(sqrt,array().sqrt,0)
 //GISMO_EXPR_VECTOR_EXPRESSION(abs,array().abs,0)
 
-//Determinant
-GISMO_EXPR_VECTOR_EXPRESSION(det,determinant,1);
-
 //GISMO_EXPR_VECTOR_EXPRESSION(replicate,replicate,0);
 
 #undef GISMO_EXPR_VECTOR_EXPRESSION
 
+/*
+  Inverse and determinant of the small matrices appearing in geometric
+  expressions (Jacobians, metric tensors). The sizes 1 to 3 are
+  dispatched to fixed-size matrices with closed-form formulas, so that
+  no temporaries are allocated on the heap.
+*/
+template<class T>
+struct small_matrix
+{
+    template<class M> static T determinant(const M & m)
+    {
+        GISMO_ASSERT(m.rows() == m.cols(), "The matrix is not square");
+        switch (m.rows())
+        {
+        case 0: return 1;
+        case 1: return m(0,0);
+        case 2: return m(0,0)*m(1,1) - m(0,1)*m(1,0);
+        case 3: return gsMatrix<T,3,3>(m).determinant();
+        default: return m.determinant();
+        }
+    }
+
+    template<class M, class R> static void inverse(const M & m, R & res)
+    {
+        GISMO_ASSERT(m.rows() == m.cols(), "The matrix is not square");
+        switch (m.rows())
+        {
+        case 1: res.resize(1,1); res(0,0) = 1 / m(0,0); break;
+        case 2:
+        {
+            const T d = m(0,0)*m(1,1) - m(0,1)*m(1,0);
+            res.resize(2,2);
+            res(0,0) =  m(1,1) / d; res(0,1) = -m(0,1) / d;
+            res(1,0) = -m(1,0) / d; res(1,1) =  m(0,0) / d;
+            break;
+        }
+        case 3: res = gsMatrix<T,3,3>(m).inverse(); break;
+        default: res = m.cramerInverse(); break;
+        }
+    }
+};
+
+/// Inverse of a matrix expression
+template<class E>
+class inv_expr : public _expr<inv_expr<E> >
+{
+    typename E::Nested_t _u;
+public:
+    typedef typename E::Scalar Scalar;
+    enum {Space= E::Space, ScalarValued= 0, ColBlocks= E::ColBlocks};
+
+    inv_expr(_expr<E> const& u) : _u(u) { }
+
+    mutable Temporary_t tmp;
+    const Temporary_t & eval(const index_t k) const
+    {
+        small_matrix<Scalar>::inverse(_u.eval(k), tmp);
+        return tmp;
+    }
+
+    index_t rows() const { return _u.rows(); }
+    index_t cols() const { return _u.cols(); }
+    void parse(gsExprHelper<Scalar> & evList) const { _u.parse(evList); }
+    const gsFeSpace<Scalar> & rowVar() const {return gsNullExpr<Scalar>::get();}
+    const gsFeSpace<Scalar> & colVar() const {return gsNullExpr<Scalar>::get();}
+    void print(std::ostream &os) const { os << "inv("; _u.print(os); os <<")"; }
+};
+
+/// Determinant of a matrix expression
+template<class E>
+class det_expr : public _expr<det_expr<E> >
+{
+    typename E::Nested_t _u;
+public:
+    typedef typename E::Scalar Scalar;
+    enum {Space= E::Space, ScalarValued= 1, ColBlocks= E::ColBlocks};
+
+    det_expr(_expr<E> const& u) : _u(u) { }
+
+    Scalar eval(const index_t k) const
+    { return small_matrix<Scalar>::determinant(_u.eval(k)); }
+
+    index_t rows() const { return 0; }
+    index_t cols() const { return 0; }
+    void parse(gsExprHelper<Scalar> & evList) const { _u.parse(evList); }
+    const gsFeSpace<Scalar> & rowVar() const {return gsNullExpr<Scalar>::get();}
+    const gsFeSpace<Scalar> & colVar() const {return gsNullExpr<Scalar>::get();}
+    void print(std::ostream &os) const { os << "det("; _u.print(os); os <<")"; }
+};
+
 /**
    Expression for turning a vector into a diagonal matrix
 */
@@ -3446,6 +3534,89 @@ public:
     void print(std::ostream &os) const { os << "\u2207("; _G.print(os); os <<")"; }
 };
 
+/*
+  Storage of a subexpression that is evaluated once per element for
+  all evaluation points and shared between expressions, see
+  gsExprHelper::cache
+*/
+template<class T>
+struct expr_cache
+{
+    expr_cache() : valid(false) { }
+    gsMatrix<T> values; ///< values on all evaluation points
+    bool valid;         ///< false if the element has changed
+};
+
+/*
+  Expression for the physical gradient of a FE space,
+  i.e. grad(u)*jac(G).ginv()
+
+  All expressions with the same space and map parsed together share
+  one cache, so the gradients are transformed only once per element,
+  even if igrad(u,G) appears in several terms.
+*/
+template<class T>
+class igrad_expr : public _expr<igrad_expr<T> >
+{
+    typename gsFeSpace<T>::Nested_t _u;
+    typename gsGeometryMap<T>::Nested_t _G;
+    mutable expr_cache<T> * m_cache;
+
+public:
+    typedef T Scalar;
+    enum {Space = 1, ScalarValued = 0, ColBlocks = 0};
+
+    igrad_expr(const gsFeSpace<T> & u, const gsGeometryMap<T> & G)
+    : _u(u), _G(G), m_cache(nullptr)
+    { GISMO_ASSERT(1==u.dim(),"igrad(.) requires 1D variable, use ijac(.) instead.");}
+
+    MatExprType eval(const index_t k) const
+    {
+        GISMO_ASSERT(nullptr!=m_cache, "igrad(u,G) is not parsed");
+        if (!m_cache->valid)
+            compute();
+        return m_cache->values.middleCols(k*cols(), cols());
+    }
+
+    index_t rows() const { return 1; }
+
+    index_t cols() const { return _G.source().targetDim(); }
+
+    index_t cardinality_impl() const
+    { return _u.data().values[1].rows() / _u.source().domainDim(); }
+
+    void parse(gsExprHelper<Scalar> & evList) const
+    {
+        evList.add(_u);
+        _u.data().flags |= NEED_GRAD;
+        evList.add(_G);
+        _G.data().flags |= NEED_GRAD_TRANSFORM;
+        m_cache = &evList.cache(_u, _G);
+    }
+
+    const gsFeSpace<Scalar> & rowVar() const { return _u.rowVar(); }
+    const gsFeSpace<Scalar> & colVar() const { return gsNullExpr<Scalar>::get(); }
+
+    void print(std::ostream &os) const
+    { os << "igrad("; _u.print(os); os <<","; _G.print(os); os <<")"; }
+
+private:
+    void compute() const
+    {
+        const index_t pd = _u.source().domainDim();
+        const index_t td = cols();
+        const index_t nb = cardinality_impl();
+        const index_t np = _u.data().values[1].cols();
+        gsMatrix<T> & res = m_cache->values;
+        res.resize(nb, td*np);
+        for (index_t k = 0; k != np; ++k)
+            res.middleCols(k*td, td).noalias() =
+                _u.data().values[1].reshapeCol(k, pd, nb).transpose() *
+                _G.data().jacInvTr.reshapeCol(k, td, pd).transpose();
+        m_cache->valid = true;
+    }
+};
+
 template<class E>
 class hess_expr : public _expr<hess_expr<E> >
 {
@@ -3730,6 +3901,11 @@ public:
     const gsFeSpace<Scalar> & colVar() const
     { return 0==E2::Space ? _u.colVar() : _v.colVar(); }
 
+    /// Returns the left operand
+    const E1 & first()  const { return _u; }
+    /// Returns the right operand
+    const E2 & second() const { return _v; }
+
     void print(std::ostream &os) const { _u.print(os); os<<"*"; _v.print(os); }
 };
 
@@ -3876,9 +4052,106 @@ public:
     const gsFeSpace<Scalar> & rowVar() const { return _v.rowVar(); }
     const gsFeSpace<Scalar> & colVar() const { return _v.colVar(); }
 
+    /// Returns the scalar factor
+    const Scalar & first()  const { return _c; }
+    /// Returns the scaled expression
+    const E2 & second() const { return _v; }
+
     void print(std::ostream &os) const { os << _c <<"*";_v.print(os); }
 };
 
+/*
+  Traits for the batched evaluation of outer products
+
+  An expression is an outer product if it has the form c * L * R^T,
+  where L and R are not ColBlocks and c is a (possibly absent)
+  scalar-valued factor, e.g. igrad(u,G) * igrad(u,G).tr() * meas(G).
+  The weighted sum over the evaluation points
+
+    sum_k w_k c_k L_k R_k^T = [L_0 .. L_n] diag(w c) [R_0 .. R_n]^T
+
+  is then computed with one matrix product, see batchedQuadrature.
+*/
+template <class E, class = void> struct outer_product_traits
+{ enum {value = 0}; };
+
+// L * R^T
+template <class E1, class E2>
+struct outer_product_traits<mult_expr<E1,tr_expr<E2,false>,false>,
+                            typename util::enable_if<!E1::ScalarValued && !E2::ScalarValued
+                                                     && !E1::ColBlocks && !E2::ColBlocks>::type>
+{
+    enum {value = 1};
+    typedef mult_expr<E1,tr_expr<E2,false>,false> E;
+    typedef E1 Left;
+    typedef E2 Right;
+    typedef typename E1::Scalar Scalar;
+    static const E1 & left (const E & e) { return e.first(); }
+    static const E2 & right(const E & e) { return e.second().arg(); }
+    static Scalar factor(const E &, const index_t) { return 1; }
+};
+
+// (L * R^T) * c(k)
+template <class M, class S>
+struct outer_product_traits<mult_expr<M,S,false>,
+                            typename util::enable_if<outer_product_traits<M>::value
+                                                     && S::ScalarValued>::type>
+{
+    enum {value = 1};
+    typedef mult_expr<M,S,false> E;
+    typedef outer_product_traits<M> Base;
+    typedef typename Base::Left  Left;
+    typedef typename Base::Right Right;
+    typedef typename Base::Scalar Scalar;
+    static const Left  & left (const E & e) { return Base::left (e.first()); }
+    static const Right & right(const E & e) { return Base::right(e.first()); }
+    static Scalar factor(const E & e, const index_t k)
+    { return Base::factor(e.first(),k) * e.second().eval(k); }
+};
+
+// c * (L * R^T)
+template <class M>
+struct outer_product_traits<mult_expr<real_t,M,false>,
+                            typename util::enable_if<outer_product_traits<M>::value>::type>
+{
+    enum {value = 1};
+    typedef mult_expr<real_t,M,false> E;
+    typedef outer_product_traits<M> Base;
+    typedef typename Base::Left  Left;
+    typedef typename Base::Right Right;
+    typedef typename Base::Scalar Scalar;
+    static const Left  & left (const E & e) { return Base::left (e.second()); }
+    static const Right & right(const E & e) { return Base::right(e.second()); }
+    static Scalar factor(const E & e, const index_t k)
+    { return e.first() * Base::factor(e.second(),k); }
+};
+
+/// Computes the weighted sum of the outer product expression \a e
+/// over all evaluation points as one matrix product. The matrices
+/// \a L and \a R are used as workspace.
+template <class E, class T>
+void batchedQuadrature(const E & e, const gsVector<T> & w, gsMatrix<T> & res,
+                       gsMatrix<T> & L, gsMatrix<T> & R)
+{
+    typedef outer_product_traits<E> traits;
+    const typename traits::Left  & l = traits::left (e);
+    const typename traits::Right & r = traits::right(e);
+    const index_t nq = w.rows();
+
+    // The sizes of the factors are the same on all points; note that
+    // rows() is the size per basis function for spaces
+    const index_t d = l.eval(0).cols();
+    GISMO_ASSERT(d == r.eval(0).cols(), "Wrong dimensions "<<d<<"!="<<r.eval(0).cols()<<" in outer product");
+    L.resize(l.eval(0).rows(), d*nq);
+    R.resize(r.eval(0).rows(), d*nq);
+    for (index_t k = 0; k != nq; ++k)
+    {
+        L.middleCols(k*d,d) = l.eval(k);
+        R.middleCols(k*d,d) = (w[k] * traits::factor(e,k)) * r.eval(k);
+    }
+    res.noalias() = L * R.transpose();
+}
+
 
 template <typename E1, typename E2>
 class collapse_expr : public _expr<collapse_expr<E1, E2> >
@@ -4662,6 +4935,10 @@ GISMO_SHORTCUT_MAP_EXPRESSION(unv, nv(G).normalized()   )
 GISMO_SHORTCUT_MAP_EXPRESSION(usn, sn(G).normalized()   )
 
 GISMO_SHORTCUT_PHY_EXPRESSION(igrad, grad(u)*jac(G).ginv() ) // transpose() problem ??
+/// Physical gradient of a space, shared between the parsed expressions
+template<class T> EIGEN_STRONG_INLINE
+igrad_expr<T> igrad(const gsFeSpace<T> & u, const gsGeometryMap<T> & G)
+{ return igrad_expr<T>(u, G); }
 GISMO_SHORTCUT_VAR_EXPRESSION(igrad, grad(u) ) // u is presumed to be defined over G
 
 GISMO_SHORTCUT_PHY_EXPRESSION( ijac, jac(u) * jac(G).ginv())
@@ -42,6 +42,7 @@ public:
     :  Base(stationary),  // note: unnecessary sliced copy here
        m_stationary(&stationary), m_theta(0.5)
     {
+        resetSystem();
         m_options.addReal("theta",
         "Theta parameter determining the time integration scheme [0..1]", m_theta);
     }
@@ -98,9 +99,14 @@ public:
                               const gsMatrix<T> & curSolution,
                               const T Dt);
 
+    /// Returns true if the last call of nextTimeStep() changed the
+    /// system matrix; otherwise, e.g. for a constant time step, a
+    /// factorization of matrix() can be re-used.
+    bool systemChanged() const { return m_sysChanged; }
+
     const gsSparseMatrix<T> & mass() const { return m_mass; }
     const gsSparseMatrix<T> & stationaryMatrix() const { return m_stationary->matrix(); }
-    const gsSparseMatrix<T> & stationaryRhs() const { return m_stationary->rhs(); }
+    const gsMatrix<T> & stationaryRhs() const { return m_stationary->rhs(); }
     
     /// Mass assembly routine
     void assembleMass();
@@ -119,10 +125,39 @@ protected:
     
     /// Theta parameter determining the scheme
     T m_theta;
+
+    /// The matrices and the coefficient the system matrix was formed with
+    const gsSparseMatrix<T> * m_sysMatrix, * m_massMatrix;
+    T m_sysCoef;
+    bool m_sysChanged;
     
     using Base::m_pde_ptr;
     using Base::m_bases;
 
+private:
+
+    /// Forms the system matrix M + c1 K, unless it is the current one
+    void updateSystem(const gsSparseMatrix<T> & sysMatrix,
+                      const gsSparseMatrix<T> & massMatrix, const T c1)
+    {
+        m_sysChanged = ( &sysMatrix != m_sysMatrix || &massMatrix != m_massMatrix
+                         || c1 != m_sysCoef );
+        if ( m_sysChanged )
+        {
+            m_system.matrix() = massMatrix + c1 * sysMatrix;
+            m_sysMatrix  = &sysMatrix;
+            m_massMatrix = &massMatrix;
+            m_sysCoef    = c1;
+        }
+    }
+
+    void resetSystem()
+    {
+        m_sysMatrix = m_massMatrix = nullptr;
+        m_sysCoef = -1;
+        m_sysChanged = true;
+    }
+
 };// end class definition
 
 
@@ -169,7 +204,7 @@ void gsHeatEquation<T>::nextTimeStep(const gsSparseMatrix<T> & sysMatrix,
                   "Wrong size in current solution vector.");
 
     const T c1 = Dt * m_theta;
-    m_system.matrix() = massMatrix + c1 * sysMatrix;
+    updateSystem(sysMatrix, massMatrix, c1);
 
     const T c2 = Dt * (1.0 - m_theta);
     m_system.rhs().noalias() = c1 * rhs1 + c2 * rhs0 + (massMatrix - c2 * sysMatrix) * curSolution;
@@ -186,7 +221,7 @@ void gsHeatEquation<T>::nextTimeStepFixedRhs(const gsSparseMatrix<T> & sysMatrix
                   "Wrong size in current solution vector.");
 
     const T c1 = Dt * m_theta;
-    m_system.matrix() = massMatrix + c1 * sysMatrix;
+    updateSystem(sysMatrix, massMatrix, c1);
 
     const T c2 = Dt * (1.0 - m_theta);
     m_system.rhs().noalias() = Dt * rhs + (massMatrix - c2 * sysMatrix) * curSolution;
@@ -223,6 +258,7 @@ void gsHeatEquation<T>::assembleMass()
 
     // Store the mass matrix once and for all
     m_system.matrix().swap(m_mass);
+    resetSystem();
 }
 
 } // namespace gismo
@@ -0,0 +1,189 @@
+/** @file gsLinearTimeIntegrator.h
+
+    @brief Adaptive time integration of linear systems of ODEs, as
+    obtained from gsHeatEquation.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#pragma once
+
+#include <gsAssembler/gsHeatEquation.h>
+#include <gsMatrix/gsSparseSolver.h>
+
+namespace gismo
+{
+
+/** \brief Adaptive time integration of the linear system
+    \f[ M \dot u + K u = f \f]
+    with constant matrices \f$M\f$, \f$K\f$ and load \f$f\f$, as
+    obtained from the method of lines, e.g. by gsHeatEquation.
+
+    Two methods with error-based step size control are available
+    (option "Method"):
+
+    - ROS2 (0): the two-stage, second order, L-stable Rosenbrock
+      method of Verwer et al. (1999), the first stage giving the
+      embedded first order solution;
+    - BDF2 (1): the variable step size BDF2 method, started with two
+      ROS2 steps. The error is estimated from the difference to the
+      quadratic extrapolation of the last three solutions (Milne's
+      device).
+
+    The step size is controlled such that a weighted RMS norm (with
+    the tolerances "AbsTol" and "RelTol") of the error estimate is at
+    most one.
+
+    Each step solves linear systems with the matrix \f$M + c\,\tau K\f$
+    only, where \f$\tau\f$ is the step size and \f$c\f$ depends on the
+    method (for BDF2 also on the ratio of the last two step sizes).
+    The factorizations of the last "KeepFactorizations" such matrices
+    are kept. To re-use them, the step size is only changed by powers
+    of two: after an accepted step it is increased if the error
+    estimate allows at least a factor of two (like the fixed step band
+    of CVODE) and kept otherwise; it is decreased after a rejected step.
+
+    The matrices are referenced, not copied; they are assembled once
+    (e.g. by gsHeatEquation::assemble()) and have to stay alive as
+    long as the integrator is used. A call of integrate() starting
+    with the result of the previous one continues with its step size
+    (and BDF2 history), e.g. for output at several times.
+
+    The stages are solved one after the other, since each stage
+    depends on the previous ones; all of them share the factorization.
+
+    \ingroup Assembler
+*/
+template <class T>
+class gsLinearTimeIntegrator
+{
+public:
+
+    /// Shared pointer for gsLinearTimeIntegrator
+    typedef memory::shared_ptr<gsLinearTimeIntegrator> Ptr;
+
+    /// Unique pointer for gsLinearTimeIntegrator
+    typedef memory::unique_ptr<gsLinearTimeIntegrator> uPtr;
+
+    /// Time integration methods
+    enum method
+    {
+        ROS2 = 0, ///< Rosenbrock method of order 2 with embedded order 1
+        BDF2 = 1  ///< Variable step size BDF2 method
+    };
+
+public:
+
+    /// Constructor using the mass matrix \a mass, the stiffness
+    /// matrix \a stiffness and the (constant) right-hand side \a rhs
+    gsLinearTimeIntegrator(const gsSparseMatrix<T> & mass,
+                           const gsSparseMatrix<T> & stiffness,
+                           const gsMatrix<T> & rhs)
+    : m_mass(&mass), m_stiff(&stiffness), m_rhs(&rhs),
+      m_options(defaultOptions())
+    { resetStatistics(); }
+
+    /// Constructor using the matrices of the heat equation \a heat,
+    /// which has to be assembled before
+    explicit gsLinearTimeIntegrator(const gsHeatEquation<T> & heat)
+    : m_mass(&heat.mass()), m_stiff(&heat.stationaryMatrix()),
+      m_rhs(&heat.stationaryRhs()), m_options(defaultOptions())
+    { resetStatistics(); }
+
+    /// Returns the default options
+    static gsOptionList defaultOptions();
+
+    /// Returns a reference to the options
+    gsOptionList & options() { return m_options; }
+
+    /// Integrates from time \a t0 to \a t1. On input, \a u is the
+    /// initial value; on output the solution at \a t1. Returns the
+    /// number of accepted steps.
+    index_t integrate(gsMatrix<T> & u, const T t0, const T t1);
+
+    /// Resets the counters, the step size and removes the factorizations
+    void resetStatistics()
+    {
+        m_factors.clear();
+        m_solver = nullptr;
+        m_useCount = 0;
+        m_h = 0;
+        m_history = 0;
+        m_steps.clear();
+        m_numRejected = m_numFactorizations = m_numSolves = 0;
+    }
+
+    /// Number of accepted steps
+    index_t numSteps() const { return m_steps.size(); }
+
+    /// Number of rejected steps
+    index_t numRejected() const { return m_numRejected; }
+
+    /// Number of factorizations of the system matrix
+    index_t numFactorizations() const { return m_numFactorizations; }
+
+    /// Number of linear solves (with an existing factorization)
+    index_t numSolves() const { return m_numSolves; }
+
+    /// The sizes of the accepted steps
+    const std::vector<T> & stepSizes() const { return m_steps; }
+
+private:
+
+    /// Selects the factorization of \f$M + c K\f$, computing it if
+    /// it is not kept
+    void factorize(const T c);
+
+    /// Solves with the current factorization
+    void solve(const gsMatrix<T> & rhs, gsMatrix<T> & x)
+    {
+        x = m_solver->solve(rhs);
+        ++m_numSolves;
+    }
+
+    /// Weighted RMS norm of the error estimate \a err of the step from \a u0 to \a u1
+    T errorNorm(const gsMatrix<T> & err, const gsMatrix<T> & u0,
+                const gsMatrix<T> & u1) const;
+
+private:
+
+    const gsSparseMatrix<T> * m_mass;
+    const gsSparseMatrix<T> * m_stiff;
+    const gsMatrix<T>       * m_rhs;
+
+    gsOptionList m_options;
+
+    /// A factorization of M + coef K
+    struct factorization
+    {
+        T coef;
+        index_t lastUse;
+        typename gsSparseSolver<T>::uPtr solver;
+    };
+    std::vector<factorization> m_factors;
+    gsSparseSolver<T> * m_solver; ///< The current factorization
+    index_t m_useCount;
+    gsSparseMatrix<T> m_sys;
+
+    T m_h; ///< The next step size
+
+    // The last result and the history of the last integration
+    T m_tLast, m_hOld, m_hOld2;
+    gsMatrix<T> m_uLast, m_uOld, m_uOld2;
+    index_t m_history;
+
+    std::vector<T> m_steps;
+    index_t m_numRejected, m_numFactorizations, m_numSolves;
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsLinearTimeIntegrator.hpp)
+#endif
@@ -0,0 +1,209 @@
+/** @file gsLinearTimeIntegrator.hpp
+
+    @brief Adaptive time integration of linear systems of ODEs, as
+    obtained from gsHeatEquation.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#pragma once
+
+namespace gismo
+{
+
+template<class T>
+gsOptionList gsLinearTimeIntegrator<T>::defaultOptions()
+{
+    gsOptionList opt;
+    opt.addInt   ("Method", "Time integration method: (0) ROS2, (1) BDF2", ROS2);
+    opt.addReal  ("AbsTol", "Absolute tolerance for the local error", 1e-6);
+    opt.addReal  ("RelTol", "Relative tolerance for the local error", 1e-4);
+    opt.addReal  ("InitialStep", "Initial step size (0: 2^-14 times the time interval)", 0);
+    opt.addReal  ("MaxStep", "Maximum step size (0: the time interval)", 0);
+    opt.addReal  ("MinStep", "Minimum step size (0: 1e-12 times the time interval)", 0);
+    opt.addReal  ("Safety", "Safety factor of the step size controller", 0.9);
+    opt.addReal  ("MaxIncrease", "Maximum factor for increasing the step size", 5);
+    opt.addInt   ("KeepFactorizations", "Number of factorizations kept for re-use", 6);
+    opt.addString("Solver", "Sparse solver for the systems, see gsSparseSolver::get", "LU");
+    return opt;
+}
+
+template<class T>
+void gsLinearTimeIntegrator<T>::factorize(const T c)
+{
+    ++m_useCount;
+    for (size_t i = 0; i != m_factors.size(); ++i)
+        if (c == m_factors[i].coef)
+        {
+            m_factors[i].lastUse = m_useCount;
+            m_solver = m_factors[i].solver.get();
+            return;
+        }
+
+    // Replace the least recently used factorization
+    const size_t keep = math::max<index_t>(1, m_options.getInt("KeepFactorizations"));
+    size_t k = m_factors.size();
+    if (k < keep)
+    {
+        m_factors.resize(k + 1);
+        m_factors[k].solver = gsSparseSolver<T>::get(m_options.getString("Solver"));
+    }
+    else
+    {
+        k = 0;
+        for (size_t i = 1; i != m_factors.size(); ++i)
+            if (m_factors[i].lastUse < m_factors[k].lastUse) k = i;
+    }
+
+    m_sys = *m_mass + c * (*m_stiff);
+    m_factors[k].solver->compute(m_sys);
+    GISMO_ENSURE(m_factors[k].solver->succeed(), "gsLinearTimeIntegrator: The factorization failed.");
+    m_factors[k].coef = c;
+    m_factors[k].lastUse = m_useCount;
+    m_solver = m_factors[k].solver.get();
+    ++m_numFactorizations;
+}
+
+template<class T>
+T gsLinearTimeIntegrator<T>::errorNorm(const gsMatrix<T> & err, const gsMatrix<T> & u0,
+                                       const gsMatrix<T> & u1) const
+{
+    const T atol = m_options.getReal("AbsTol");
+    const T rtol = m_options.getReal("RelTol");
+    if (0 == err.size()) return 0;
+    const gsMatrix<T> scale = ( rtol * u0.cwiseAbs().cwiseMax(u1.cwiseAbs()) ).array() + atol;
+    return math::sqrt( err.cwiseQuotient(scale).squaredNorm() / err.size() );
+}
+
+template<class T>
+index_t gsLinearTimeIntegrator<T>::integrate(gsMatrix<T> & u, const T t0, const T t1)
+{
+    GISMO_ASSERT( u.rows() == m_mass->cols() && m_mass->rows() == m_stiff->rows()
+                  && m_rhs->rows() == m_mass->rows(), "gsLinearTimeIntegrator: Wrong sizes." );
+    GISMO_ASSERT( t1 > t0, "gsLinearTimeIntegrator: Empty time interval." );
+
+    const index_t meth  = m_options.getInt("Method");
+    const T interval    = t1 - t0;
+    const T safety      = m_options.getReal("Safety");
+    // Zero-stability of variable step size BDF2 requires step ratios below 1+sqrt(2)
+    const T maxIncrease = ( BDF2 == meth ? math::min<T>(2, m_options.getReal("MaxIncrease"))
+                            : m_options.getReal("MaxIncrease") );
+    const T maxStep = ( 0 < m_options.getReal("MaxStep") ? m_options.getReal("MaxStep") : interval );
+    const T minStep = ( 0 < m_options.getReal("MinStep") ? m_options.getReal("MinStep") : 1e-12 * interval );
+    // By default, the steps are the interval divided by powers of two
+    T h = ( 0 < m_options.getReal("InitialStep") ? m_options.getReal("InitialStep")
+            : math::ldexp(interval, -14) );
+    h = math::min(h, maxStep);
+
+    // Continue the last integration, if u is its result
+    const bool resume = ( 0 < m_h && t0 == m_tLast && u.rows() == m_uLast.rows()
+                          && u == m_uLast );
+    if (resume)
+        h = m_h;
+
+    const gsSparseMatrix<T> & M = *m_mass, & K = *m_stiff;
+    const gsMatrix<T> & f = *m_rhs;
+    const T gamma = 1 + 1 / math::sqrt((T)(2));
+
+    // Solutions and step sizes of the last steps, for BDF2
+    gsMatrix<T> rhs, k1, k2, uNew, err;
+    if (!resume)
+    {
+        m_history = 0;
+        m_hOld = m_hOld2 = 0;
+    }
+    gsMatrix<T> & uOld = m_uOld, & uOld2 = m_uOld2;
+    T & hOld = m_hOld, & hOld2 = m_hOld2;
+
+    index_t accepted = 0;
+    T t = t0;
+    while (t < t1)
+    {
+        // The last step ends exactly at t1
+        const bool last = ( t + h >= t1 - 1e-12 * interval );
+        const T tau = ( last ? t1 - t : h );
+        T errNorm, order;
+
+        if (BDF2 == meth && m_history >= 2)
+        {
+            // (M + c tau K) u_{n+1} = M ((1+w) u_n - w^2/(1+w) u_{n-1}) c + c tau f,
+            // with w = tau/hOld and c = (1+w)/(1+2w)
+            const T w = tau / hOld, c = (1 + w) / (1 + 2 * w);
+            factorize(c * tau);
+            rhs.noalias() = c * ( M * ( (1 + w) * u - (w * w / (1 + w)) * uOld ) );
+            rhs.noalias() += (c * tau) * f;
+            solve(rhs, uNew);
+
+            // Quadratic extrapolation of the last three solutions
+            const T l0 = tau * (tau + hOld) / (hOld2 * (hOld + hOld2));
+            const T l1 = - tau * (tau + hOld + hOld2) / (hOld * hOld2);
+            const T l2 = (tau + hOld + hOld2) * (tau + hOld) / ((hOld + hOld2) * hOld);
+            err.noalias() = uNew - ( l0 * uOld2 + l1 * uOld + l2 * u );
+
+            // The error constants of BDF2 and of the extrapolation
+            const T cCorr = (1 + w) * (1 + w) * tau * tau * tau / (6 * w * (1 + 2 * w));
+            const T cPred = tau * (tau + hOld) * (tau + hOld + hOld2) / 6;
+            err *= cCorr / (cPred + cCorr);
+            order = 2;
+        }
+        else
+        {
+            // ROS2: (M + gamma tau K) k1 = f - K u,
+            //       (M + gamma tau K) k2 = f - K (u + tau k1) - 2 M k1
+            factorize(gamma * tau);
+            rhs.noalias() = f - K * u;
+            solve(rhs, k1);
+            uNew.noalias() = u + tau * k1;
+            rhs.noalias() = f - K * uNew;
+            rhs.noalias() -= 2 * (M * k1);
+            solve(rhs, k2);
+            // Difference to the embedded solution u + tau k1
+            err.noalias() = (tau / 2) * (k1 + k2);
+            uNew += err;
+            order = 1;
+        }
+
+        errNorm = errorNorm(err, u, uNew);
+        T fac = ( 0 == errNorm ? maxIncrease :
+                  safety * math::pow(errNorm, -1 / (order + 1)) );
+        fac = math::max<T>(0.2, math::min(fac, maxIncrease));
+
+        if (errNorm <= 1)
+        {
+            // Accept the step
+            uOld2.swap(uOld);
+            uOld.swap(u);
+            u.swap(uNew);
+            hOld2 = hOld;
+            hOld = tau;
+            t = ( last ? t1 : t + tau );
+            m_steps.push_back(tau);
+            ++accepted;
+            ++m_history;
+
+            // Increase the step size by powers of two, to re-use the factorizations
+            if (fac >= 2)
+                h = math::min(h * math::pow((T)(2), math::floor(math::log(fac) / math::log((T)(2)))),
+                              maxStep);
+        }
+        else
+        {
+            ++m_numRejected;
+            h *= math::pow((T)(2), math::floor(math::log(fac) / math::log((T)(2))));
+            GISMO_ENSURE(h >= minStep, "gsLinearTimeIntegrator: The step size "
+                         << h << " at time " << t << " is below the minimum.");
+        }
+    }
+    m_h = h;
+    m_tLast = t1;
+    m_uLast = u;
+    return accepted;
+}
+
+} // namespace gismo
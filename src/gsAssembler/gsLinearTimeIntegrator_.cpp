@@ -0,0 +1,11 @@
+#include <gsCore/gsTemplateTools.h>
+
+#include <gsAssembler/gsLinearTimeIntegrator.h>
+#include <gsAssembler/gsLinearTimeIntegrator.hpp>
+
+namespace gismo
+{
+
+CLASS_TEMPLATE_INST gsLinearTimeIntegrator<real_t>;
+
+} // namespace gismo
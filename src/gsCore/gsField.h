@@ -17,6 +17,7 @@
 #include <gsCore/gsGeometry.h>
 #include <gsCore/gsMultiPatch.h>
 #include <gsCore/gsMultiBasis.h>
+#include <gsCore/gsPointLocator.h>
 #include <gsUtils/gsPointGrid.h>
 
 namespace gismo
@@ -134,6 +135,31 @@ public:
         return ( m_fields->piece(i).eval(u) );
     }
 
+    /**
+     * @brief Evaluation of the field at points \a points of the physical domain.
+     *
+     * The points are located on the patches with a gsPointLocator,
+     * see gsPointLocator::locate.
+     *
+     * @param[in] points Evaluation points as gsMatrix of size <em>geoDim()</em> x <em>n</em>.
+     * @param[out] pids For each point the patch it belongs to, or -1 if it is not in the domain.
+     * @param[in] accuracy Tolerance for the inversion of the geometry map.
+     * @returns The <em>j</em>-th column contains the value of the field at the
+     * <em>j</em>-th point, or NaN if the point is not in the domain.
+     */
+    gsMatrix<T> evalAtPhysicalPoints(const gsMatrix<T>& points, gsVector<index_t>& pids,
+                                     const T accuracy = 1e-6) const
+    {
+        return evalAtPhysicalPoints(gsPointLocator<T>(*m_patches), points, pids, accuracy);
+    }
+
+    /// @brief Evaluation of the field at points \a points of the physical
+    /// domain, using the given \a locator, which has to be set up for patches().
+    ///
+    /// This avoids setting up the search structure for repeated evaluations.
+    gsMatrix<T> evalAtPhysicalPoints(const gsPointLocator<T>& locator, const gsMatrix<T>& points,
+                                     gsVector<index_t>& pids, const T accuracy = 1e-6) const;
+
     /// Computes the L2-distance between the two fields, on the physical domain
     T distanceL2(gsField<T> const & field, int numEvals= 1000) const;
 
@@ -20,6 +20,41 @@
 namespace gismo
 {
 
+template <class T>
+gsMatrix<T> gsField<T>::evalAtPhysicalPoints(const gsPointLocator<T>& locator,
+                                             const gsMatrix<T>& points,
+                                             gsVector<index_t>& pids,
+                                             const T accuracy) const
+{
+    GISMO_ASSERT( &locator.domain() == m_patches,
+                  "gsField: The locator is not set up for the domain of the field." );
+    gsMatrix<T> preim;
+    locator.locate(points, pids, preim, accuracy);
+
+    // Evaluate patch-wise at all points of the patch at once
+    const index_t n = points.cols();
+    gsMatrix<T> result(dim(), n);
+    result.setConstant( std::numeric_limits<T>::quiet_NaN() );
+    std::vector< std::vector<index_t> > onPatch(nPieces());
+    for (index_t i = 0; i < n; ++i)
+        if (-1 != pids[i])
+            onPatch[pids[i]].push_back(i);
+
+    gsMatrix<T> u, val;
+    for (index_t p = 0; p < nPieces(); ++p)
+    {
+        const std::vector<index_t> & pts = onPatch[p];
+        if (pts.empty()) continue;
+        u.resize(preim.rows(), pts.size());
+        for (size_t j = 0; j < pts.size(); ++j)
+            u.col(j) = preim.col(pts[j]);
+        val = value(u, p);
+        for (size_t j = 0; j < pts.size(); ++j)
+            result.col(pts[j]) = val.col(j);
+    }
+    return result;
+}
+
 template <class T>
 T gsField<T>::distanceL2(gsFunctionSet<T> const & func,
                          gsMultiBasis<T> const & B,
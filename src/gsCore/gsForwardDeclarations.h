@@ -207,6 +207,7 @@ template <class T=real_t>                class gsExprEvaluator;
 template <class T=real_t>                class gsCurveLoop;
 template <class T=real_t>                class gsPlanarDomain;
 template <class T=real_t>                class gsField;
+template <class T=real_t>                class gsPointLocator;
 template <class T=real_t>                class gsMesh;
 template <class T=real_t>                class gsHeMesh;
 
@@ -296,11 +297,15 @@ template <class T=real_t>                class gsCompositePrecOp;
 template <class T=real_t>                class gsKroneckerOp;
 template <class T=real_t>                class gsBlockOp;
 template <class T=real_t>                class gsPatchPreconditionersCreator;
+template <class T=real_t>                class gsDistributedMatrixOp;
 
 // gsMultiGrid
 
 template <class T=real_t>                class gsMultiGridOp;
 template <class T=real_t>                class gsGridHierarchy;
+template <class T=real_t>                class gsAlgebraicMultiGridOp;
+template <class T=real_t>                class gsPMultiGridOp;
+template <class T=real_t>                class gsBlockILUTOp;
 
 // gsIeti
 
@@ -582,17 +582,30 @@ inline void computeAuxiliaryData(const gsFunction<T> &src, gsMapData<T> & InOut,
         // domDim<=tarDim makes sense
 
         InOut.jacInvTr.resize(d*n, numPts);
+        // For fixed dimensions, the inverses are computed in closed form
+        // on the stack; cramerInverse would allocate a temporary per point
+        gsMatrix<T,domDim,domDim> metricInv(d,d);
         for (index_t p=0; p!=numPts; ++p)
         {
             const gsAsConstMatrix<T,domDim,tarDim> jacT(InOut.values[1].col(p).data(), d, n);
 
             if ( tarDim!=-1 ? tarDim == domDim : n==d )
-                gsAsMatrix<T,tarDim,domDim>(InOut.jacInvTr.col(p).data(), n, d)
+            {
+                if (-1!=domDim)
+                    gsAsMatrix<T,tarDim,domDim>(InOut.jacInvTr.col(p).data(), n, d)
+                        = jacT.inverse();
+                else
+                    gsAsMatrix<T,tarDim,domDim>(InOut.jacInvTr.col(p).data(), n, d)
                         = jacT.cramerInverse();
+            }
             else
             {
+                if (-1!=domDim)
+                    metricInv = (jacT*jacT.transpose()).inverse();
+                else
+                    metricInv = (jacT*jacT.transpose()).cramerInverse();
                 gsAsMatrix<T,tarDim,domDim>(InOut.jacInvTr.col(p).data(), n, d)
-                        = jacT.transpose()*(jacT*jacT.transpose()).cramerInverse();
+                        = jacT.transpose()*metricInv;
             }
         }
     }
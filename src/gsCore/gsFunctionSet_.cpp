@@ -23,20 +23,43 @@ CLASS_TEMPLATE_INST gsFunctionSet<real_t>;
 
 namespace py = pybind11;
 
+// Writes the result of an evaluation into the memory of a NumPy array
+// (of any memory layout), which is passed by reference
+typedef gsEigen::Ref<gsMatrix<real_t>::Base, 0,
+                     gsEigen::Stride<gsEigen::Dynamic,gsEigen::Dynamic> > pyArrayRef;
+
+static void pybind11_copy_result(const gsMatrix<real_t> & result, pyArrayRef out)
+{
+    GISMO_ENSURE( out.rows() == result.rows() && out.cols() == result.cols(),
+                  "The output array has size "<<out.rows()<<"x"<<out.cols()
+                  <<", expected "<<result.rows()<<"x"<<result.cols() );
+    out = result;
+}
+
+// The evaluation functions release the GIL, so that several Python
+// threads can evaluate at the same time. The results of eval, deriv and
+// deriv2 are moved into the returned NumPy arrays without copying, the
+// _into variants write into the given array.
 void pybind11_init_gsFunctionSet(py::module &m)
 {
   using Class = gsFunctionSet<real_t>;
   py::class_<Class>(m, "gsFunctionSet")
 
   //Constructor?
-  .def("eval_into", &Class::eval_into, "Evaluates the function set into a matrix")
-  .def("deriv_into", &Class::deriv_into, "Evaluates the first derivative into a matrix")
-  .def("deriv2_into", &Class::deriv2_into, "Evaluates the second derivative into a matrix")
+  .def("eval_into", [](const Class & self, const gsMatrix<real_t> & u, pyArrayRef result)
+       { gsMatrix<real_t> tmp; self.eval_into(u, tmp); pybind11_copy_result(tmp, result); },
+       py::call_guard<py::gil_scoped_release>(), "Evaluates the function set into a matrix")
+  .def("deriv_into", [](const Class & self, const gsMatrix<real_t> & u, pyArrayRef result)
+       { gsMatrix<real_t> tmp; self.deriv_into(u, tmp); pybind11_copy_result(tmp, result); },
+       py::call_guard<py::gil_scoped_release>(), "Evaluates the first derivative into a matrix")
+  .def("deriv2_into", [](const Class & self, const gsMatrix<real_t> & u, pyArrayRef result)
+       { gsMatrix<real_t> tmp; self.deriv2_into(u, tmp); pybind11_copy_result(tmp, result); },
+       py::call_guard<py::gil_scoped_release>(), "Evaluates the second derivative into a matrix")
   .def("evalAllDers_into", &Class::deriv2_into, "Evaluates all derivatives upto certien order into a vector of matrices")
-  .def("eval", &Class::eval, "Evaluates the function set and returns a matrix")
-  .def("deriv", &Class::deriv, "Evaluates the first derivative and returns a matrix")
-  .def("deriv2", &Class::deriv2, "Evaluates the second derivative and returns a matrix")
-  .def("evalAllDers", &Class::evalAllDers, "Evaluates all derivatives upto certien order into a vector of matrices")
+  .def("eval", &Class::eval, py::call_guard<py::gil_scoped_release>(), "Evaluates the function set and returns a matrix")
+  .def("deriv", &Class::deriv, py::call_guard<py::gil_scoped_release>(), "Evaluates the first derivative and returns a matrix")
+  .def("deriv2", &Class::deriv2, py::call_guard<py::gil_scoped_release>(), "Evaluates the second derivative and returns a matrix")
+  .def("evalAllDers", &Class::evalAllDers, py::call_guard<py::gil_scoped_release>(), "Evaluates all derivatives upto certien order into a vector of matrices")
   .def("domainDim", &Class::domainDim, "Returns the domain dimension")
   .def("targetDim", &Class::targetDim, "Returns the target dimension")
 
@@ -17,9 +17,9 @@ void pybind11_init_gsFunction(py::module &m)
     using Base = gsFunctionSet<real_t>;
     using Class = gsFunction<real_t>;
     py::class_<Class, Base>(m, "gsFunction")
-        .def("jacobian",  &Class::jacobian, "Returns the Jacobian")
-        .def("hessian",   &Class::hessian, "Returns the Hessian")
-        .def("laplacian", &Class::laplacian, "Returns the Laplacian")
+        .def("jacobian",  &Class::jacobian, py::call_guard<py::gil_scoped_release>(), "Returns the Jacobian")
+        .def("hessian",   &Class::hessian, py::call_guard<py::gil_scoped_release>(), "Returns the Hessian")
+        .def("laplacian", &Class::laplacian, py::call_guard<py::gil_scoped_release>(), "Returns the Laplacian")
         .def("argMin", &Class::argMin, "Returns the position of the minimum",
              py::arg("accuracy") = 1e-6, py::arg("max_loop") = 100,
              py::arg("init") = gsMatrix<real_t>(),
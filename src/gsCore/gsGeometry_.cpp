@@ -37,8 +37,9 @@ void pybind11_init_gsGeometry(py::module &m)
   // Member functions
   .def("parDim", &Class::targetDim, "Gives the parameter dimension")
   .def("geoDim", &Class::targetDim, "Gives the geometry dimension")
-  .def("coefs", static_cast<      gsMatrix<real_t>& (Class::*)()      > (&Class::coefs), "Get the coefficients as a reference")
-  .def("coefs", static_cast<const gsMatrix<real_t>& (Class::*)() const> (&Class::coefs), "Get the coefficients as a const reference")
+  // The coefficients are returned as a NumPy view of the memory of the geometry (no copy)
+  .def("coefs", static_cast<      gsMatrix<real_t>& (Class::*)()      > (&Class::coefs), py::return_value_policy::reference_internal, "Get the coefficients as a reference")
+  .def("coefs", static_cast<const gsMatrix<real_t>& (Class::*)() const> (&Class::coefs), py::return_value_policy::reference_internal, "Get the coefficients as a const reference")
   .def("setCoefs", &Class::setCoefs, "Sets the coefficients")
   .def("basis", static_cast<const gsBasis<real_t>& (Class::*)() const>(&Class::basis), "Returns the bspline basis")
   .def("basis", static_cast<gsBasis<real_t>& (Class::*)()>(&Class::basis), "Returns the bspline basis as a reference")
@@ -374,6 +374,14 @@ public:
     /// \param preim in each column,  the parametric coordinates of the corresponding point in the patch
     void locatePoints(const gsMatrix<T> & points, gsVector<index_t> & pids, gsMatrix<T> & preim, const T accuracy = 1e-6) const;
 
+    /// @brief For each point in \a points, locates the patch and the parametric coordinates of the point
+    ///
+    /// Uses a gsPointLocator, which is set up for every call; for
+    /// repeated queries on the same multipatch, use a gsPointLocator directly.
+    /// \param pids vector containing for each point the patch id where it belongs (or -1 if not found)
+    /// \param preim in each column,  the parametric coordinates of the corresponding point in the patch
+    void locate(const gsMatrix<T> & points, gsVector<index_t> & pids, gsMatrix<T> & preim, const T accuracy = 1e-6) const;
+
     /// @brief For each point in \a points located on patch pid1, locates the parametric coordinates of the point
     ///
     /// \param pid2 vector containing for each point the patch id where it belongs (or -1 if not found)
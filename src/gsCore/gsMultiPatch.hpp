@@ -17,6 +17,7 @@
 #include <gsCore/gsGeometry.h>
 #include <gsCore/gsDofMapper.h>
 #include <gsCore/gsAffineFunction.h>
+#include <gsCore/gsPointLocator.h>
 
 #include <gsUtils/gsCombinatorics.h>
 
@@ -738,6 +739,14 @@ void gsMultiPatch<T>::locatePoints(const gsMatrix<T> & points,
     }
 }
 
+template<class T>
+void gsMultiPatch<T>::locate(const gsMatrix<T> & points,
+                             gsVector<index_t> & pids,
+                             gsMatrix<T> & preim, const T accuracy) const
+{
+    gsPointLocator<T>(*this).locate(points, pids, preim, accuracy);
+}
+
 template<class T>
 void gsMultiPatch<T>::locatePoints(const gsMatrix<T> & points, index_t pid1,
                                    gsVector<index_t> & pid2, gsMatrix<T> & preim) const
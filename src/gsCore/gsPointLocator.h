@@ -0,0 +1,149 @@
+/** @file gsPointLocator.h
+
+    @brief Provides a search structure for locating points of the
+    physical domain on the patches of a multipatch domain.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#pragma once
+
+#include <gsCore/gsFunctionSet.h>
+
+namespace gismo
+{
+
+/**
+ * @brief Search structure for the inversion of the geometry map on
+ * multipatch domains.
+ *
+ * For every element of every patch, an axis-aligned bounding box of
+ * the physical element is computed from the control points of the
+ * basis functions which are active on the element. Since B-spline,
+ * NURBS (with positive weights) and (truncated) hierarchical bases
+ * are non-negative and form a partition of unity, the physical
+ * element lies in the convex hull of these control points, so the
+ * box contains the whole element. The boxes are stored in a bounding
+ * volume hierarchy.
+ *
+ * For a point of the physical domain, candidates() returns the
+ * elements whose boxes contain the point, together with an initial
+ * guess for its parameter. locate() runs Newton's method for all
+ * points, starting from the candidates; the iterations are done in
+ * batches of points on the same patch, in parallel.
+ *
+ * The domain is not copied; it has to stay alive (and unchanged) as
+ * long as the locator is used.
+ *
+ * \ingroup Core
+ */
+template<class T>
+class gsPointLocator
+{
+public:
+
+    /// Shared pointer for gsPointLocator
+    typedef memory::shared_ptr<gsPointLocator> Ptr;
+
+    /// Unique pointer for gsPointLocator
+    typedef memory::unique_ptr<gsPointLocator> uPtr;
+
+    /// An element which possibly contains a given point
+    struct candidate
+    {
+        index_t     patch;      ///< Index of the patch
+        index_t     element;    ///< Index of the element, see elementLower()
+        gsVector<T> guess;      ///< Initial guess for the parameter (center of the element)
+    };
+
+public:
+
+    /// @brief Constructor
+    ///
+    /// @param domain  A gsMultiPatch or a gsGeometry; the pieces have to be gsGeometry objects
+    explicit gsPointLocator(const gsFunctionSet<T> & domain);
+
+    /// Make function returning a smart pointer
+    static uPtr make(const gsFunctionSet<T> & domain)
+    { return uPtr( new gsPointLocator(domain) ); }
+
+    /// @brief Returns the candidate elements for \a point
+    ///
+    /// The candidates are the elements whose bounding boxes (enlarged
+    /// by \a tol) contain the point. They are sorted by the distance
+    /// of the point to the image of the element centers.
+    void candidates(const gsVector<T> & point, std::vector<candidate> & result,
+                    const T tol = 0) const;
+
+    /// @brief For each point in \a points, locates the patch and the
+    /// parametric coordinates of the point
+    ///
+    /// @param[in]  points    The points, one per column
+    /// @param[out] pids      For each point the patch it belongs to (or -1 if not found)
+    /// @param[out] preim     In each column, the parametric coordinates of the corresponding point
+    /// @param[in]  accuracy  Tolerance for the distance of the image of the parameter to the point
+    /// @param[in]  maxIter   Maximum number of Newton iterations per candidate
+    void locate(const gsMatrix<T> & points, gsVector<index_t> & pids, gsMatrix<T> & preim,
+                const T accuracy = 1e-6, const index_t maxIter = 50) const;
+
+    /// The domain
+    const gsFunctionSet<T> & domain() const { return *m_domain; }
+
+    /// The number of elements over all patches
+    index_t numElements() const { return m_elPatch.size(); }
+
+    /// The patch of element \a e
+    index_t elementPatch(index_t e) const { return m_elPatch[e]; }
+
+    /// The lower corner of the parameter domain of element \a e
+    gsVector<T> elementLower(index_t e) const { return m_elLower.col(e); }
+
+    /// The upper corner of the parameter domain of element \a e
+    gsVector<T> elementUpper(index_t e) const { return m_elUpper.col(e); }
+
+    /// The bounding box of the physical element \a e (lower and upper corner as columns)
+    gsMatrix<T> elementBox(index_t e) const
+    {
+        gsMatrix<T> result(m_boxLo.rows(), 2);
+        result << m_boxLo.col(e), m_boxHi.col(e);
+        return result;
+    }
+
+private:
+
+    /// Builds the subtree for the elements m_elOrder[begin..end); returns the node index
+    index_t buildNode(index_t begin, index_t end);
+
+    /// Newton's method for the points \a x on patch \a p starting from
+    /// \a u; sets \a found for the points which were located
+    void newton(index_t p, const gsMatrix<T> & x, gsMatrix<T> & u,
+                std::vector<bool> & found, const T accuracy, const index_t maxIter) const;
+
+private:
+
+    const gsFunctionSet<T> * m_domain;  ///< The multipatch domain
+
+    std::vector<index_t> m_elPatch;     ///< Patch of each element
+    gsMatrix<T> m_elLower, m_elUpper;   ///< Parameter domain of each element
+    gsMatrix<T> m_elCenter;             ///< Image of the center of each element
+    gsMatrix<T> m_boxLo, m_boxHi;       ///< Bounding box of each physical element
+
+    std::vector<index_t> m_elOrder;     ///< Elements, ordered by the leaves of the hierarchy
+    gsMatrix<T> m_nodeLo, m_nodeHi;     ///< Bounding box of each node
+    std::vector<index_t> m_nodeLeft;    ///< Left child of each node (-1 for leaves)
+    std::vector<index_t> m_nodeRight;   ///< Right child of each node (-1 for leaves)
+    std::vector<index_t> m_nodeBegin;   ///< First element of each node in m_elOrder
+    std::vector<index_t> m_nodeEnd;     ///< End of the elements of each node in m_elOrder
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsPointLocator.hpp)
+#endif
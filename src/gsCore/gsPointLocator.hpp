@@ -0,0 +1,296 @@
+/** @file gsPointLocator.hpp
+
+    @brief Provides a search structure for locating points of the
+    physical domain on the patches of a multipatch domain.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#pragma once
+
+#include <gsCore/gsGeometry.h>
+#include <gsCore/gsBasis.h>
+#include <gsCore/gsFuncData.h>
+#include <gsCore/gsDomainIterator.h>
+
+namespace gismo
+{
+
+template<class T>
+gsPointLocator<T>::gsPointLocator(const gsFunctionSet<T> & domain)
+: m_domain(&domain)
+{
+    const index_t np = domain.nPieces();
+    const short_t gd = domain.targetDim();
+
+    // Count the elements
+    index_t nEl = 0;
+    for (index_t p = 0; p < np; ++p)
+    {
+        GISMO_ENSURE( dynamic_cast<const gsGeometry<T>*>(&domain.piece(p)),
+                      "gsPointLocator: The pieces of the domain have to be geometries." );
+        nEl += static_cast<const gsGeometry<T>&>(domain.piece(p)).basis().numElements();
+    }
+
+    const short_t pd = domain.domainDim();
+    m_elPatch.reserve(nEl);
+    m_elLower.resize(pd, nEl);
+    m_elUpper.resize(pd, nEl);
+    m_elCenter.resize(gd, nEl);
+    m_boxLo.resize(gd, nEl);
+    m_boxHi.resize(gd, nEl);
+
+    gsMatrix<index_t> act;
+    gsMatrix<T> centers;
+    index_t e = 0;
+    for (index_t p = 0; p < np; ++p)
+    {
+        const gsGeometry<T> & geo = static_cast<const gsGeometry<T>&>(domain.piece(p));
+        const gsBasis<T> & basis = geo.basis();
+        const gsMatrix<T> & coefs = geo.coefs();
+        const index_t first = e;
+
+        typename gsBasis<T>::domainIter domIt = basis.makeDomainIterator();
+        for (; domIt->good(); domIt->next(), ++e)
+        {
+            m_elPatch.push_back(p);
+            m_elLower.col(e) = domIt->lowerCorner();
+            m_elUpper.col(e) = domIt->upperCorner();
+
+            // The element lies in the convex hull of the control points
+            // of the active basis functions
+            basis.active_into(domIt->centerPoint(), act);
+            m_boxLo.col(e) = m_boxHi.col(e) = coefs.row(act(0,0)).transpose();
+            for (index_t k = 1; k < act.rows(); ++k)
+            {
+                m_boxLo.col(e) = m_boxLo.col(e).cwiseMin( coefs.row(act(k,0)).transpose() );
+                m_boxHi.col(e) = m_boxHi.col(e).cwiseMax( coefs.row(act(k,0)).transpose() );
+            }
+        }
+
+        centers = ( m_elLower.middleCols(first, e - first)
+                  + m_elUpper.middleCols(first, e - first) ) / (T)(2);
+        m_elCenter.middleCols(first, e - first) = geo.eval(centers);
+    }
+    GISMO_ASSERT( e == nEl, "gsPointLocator: Internal error." );
+
+    // Build the bounding volume hierarchy
+    m_elOrder.resize(nEl);
+    for (index_t i = 0; i < nEl; ++i)
+        m_elOrder[i] = i;
+    m_nodeLo.resize(gd, 2 * nEl);
+    m_nodeHi.resize(gd, 2 * nEl);
+    if (nEl > 0)
+        buildNode(0, nEl);
+    m_nodeLo.conservativeResize(gsEigen::NoChange, m_nodeLeft.size());
+    m_nodeHi.conservativeResize(gsEigen::NoChange, m_nodeLeft.size());
+}
+
+template<class T>
+index_t gsPointLocator<T>::buildNode(index_t begin, index_t end)
+{
+    const index_t leafSize = 4;
+
+    const index_t node = m_nodeLeft.size();
+    m_nodeLeft.push_back(-1);
+    m_nodeRight.push_back(-1);
+    m_nodeBegin.push_back(begin);
+    m_nodeEnd.push_back(end);
+
+    gsVector<T> lo = m_boxLo.col(m_elOrder[begin]), hi = m_boxHi.col(m_elOrder[begin]);
+    for (index_t i = begin + 1; i < end; ++i)
+    {
+        lo = lo.cwiseMin( m_boxLo.col(m_elOrder[i]) );
+        hi = hi.cwiseMax( m_boxHi.col(m_elOrder[i]) );
+    }
+    m_nodeLo.col(node) = lo;
+    m_nodeHi.col(node) = hi;
+
+    if (end - begin <= leafSize)
+        return node;
+
+    // Split at the median of the box centers along the longest direction
+    index_t dir;
+    (hi - lo).maxCoeff(&dir);
+    const index_t mid = (begin + end) / 2;
+    const gsMatrix<T> & boxLo = m_boxLo, & boxHi = m_boxHi;
+    std::nth_element(m_elOrder.begin() + begin, m_elOrder.begin() + mid, m_elOrder.begin() + end,
+                     [&boxLo, &boxHi, dir](index_t a, index_t b)
+                     { return boxLo(dir,a) + boxHi(dir,a) < boxLo(dir,b) + boxHi(dir,b); });
+
+    const index_t left = buildNode(begin, mid);
+    const index_t right = buildNode(mid, end);
+    m_nodeLeft[node] = left;
+    m_nodeRight[node] = right;
+    return node;
+}
+
+template<class T>
+void gsPointLocator<T>::candidates(const gsVector<T> & point, std::vector<candidate> & result,
+                                   const T tol) const
+{
+    GISMO_ASSERT( point.rows() == m_boxLo.rows(), "gsPointLocator: The point has wrong dimension." );
+    result.clear();
+    if (m_nodeLeft.empty()) return;
+
+    std::vector<index_t> found, stack(1, 0);
+    while (!stack.empty())
+    {
+        const index_t node = stack.back();
+        stack.pop_back();
+        if ( (point.array() < m_nodeLo.col(node).array() - tol).any() ||
+             (point.array() > m_nodeHi.col(node).array() + tol).any() )
+            continue;
+
+        if (-1 == m_nodeLeft[node])
+        {
+            for (index_t i = m_nodeBegin[node]; i < m_nodeEnd[node]; ++i)
+            {
+                const index_t e = m_elOrder[i];
+                if ( (point.array() >= m_boxLo.col(e).array() - tol).all() &&
+                     (point.array() <= m_boxHi.col(e).array() + tol).all() )
+                    found.push_back(e);
+            }
+        }
+        else
+        {
+            stack.push_back(m_nodeLeft[node]);
+            stack.push_back(m_nodeRight[node]);
+        }
+    }
+
+    std::vector<std::pair<T,index_t> > dist(found.size());
+    for (size_t i = 0; i < found.size(); ++i)
+        dist[i] = std::make_pair( (m_elCenter.col(found[i]) - point).squaredNorm(), found[i] );
+    std::sort(dist.begin(), dist.end());
+
+    result.resize(found.size());
+    for (size_t i = 0; i < found.size(); ++i)
+    {
+        const index_t e = dist[i].second;
+        result[i].patch = m_elPatch[e];
+        result[i].element = e;
+        result[i].guess = ( m_elLower.col(e) + m_elUpper.col(e) ) / (T)(2);
+    }
+}
+
+template<class T>
+void gsPointLocator<T>::locate(const gsMatrix<T> & points, gsVector<index_t> & pids, gsMatrix<T> & preim,
+                               const T accuracy, const index_t maxIter) const
+{
+    const index_t n = points.cols();
+    const index_t np = m_domain->nPieces();
+    pids.setConstant(n, -1); // -1 implies not in the domain
+    preim.setZero(m_domain->domainDim(), n);
+
+    std::vector< std::vector<candidate> > cand(n);
+#   pragma omp parallel for
+    for (index_t i = 0; i < n; ++i)
+        candidates(points.col(i), cand[i], accuracy);
+
+    // In round k, all points which are not located yet are tried on their
+    // k-th candidate; the points are collected per patch and processed in
+    // chunks, one per thread
+    const index_t chunkSize = 64;
+    std::vector< std::vector<index_t> > batch(np);
+    std::vector< std::pair<index_t,index_t> > chunks;
+    for (size_t k = 0; ; ++k)
+    {
+        for (index_t p = 0; p < np; ++p)
+            batch[p].clear();
+        for (index_t i = 0; i < n; ++i)
+            if (-1 == pids[i] && k < cand[i].size())
+                batch[cand[i][k].patch].push_back(i);
+
+        chunks.clear();
+        for (index_t p = 0; p < np; ++p)
+            for (size_t c = 0; c < batch[p].size(); c += chunkSize)
+                chunks.push_back(std::make_pair(p, (index_t)c));
+        if (chunks.empty()) break;
+
+#       pragma omp parallel for schedule(dynamic)
+        for (index_t c = 0; c < (index_t)chunks.size(); ++c)
+        {
+            const index_t p = chunks[c].first;
+            const std::vector<index_t> & pts = batch[p];
+            const index_t begin = chunks[c].second;
+            const index_t m = math::min<index_t>(chunkSize, pts.size() - begin);
+
+            gsMatrix<T> x(points.rows(), m), u(preim.rows(), m);
+            for (index_t j = 0; j < m; ++j)
+            {
+                x.col(j) = points.col(pts[begin + j]);
+                u.col(j) = cand[pts[begin + j]][k].guess;
+            }
+            std::vector<bool> found(m, false);
+            newton(p, x, u, found, accuracy, maxIter);
+            for (index_t j = 0; j < m; ++j)
+                if (found[j])
+                {
+                    pids[pts[begin + j]] = p;
+                    preim.col(pts[begin + j]) = u.col(j);
+                }
+        }
+    }
+}
+
+template<class T>
+void gsPointLocator<T>::newton(index_t p, const gsMatrix<T> & x, gsMatrix<T> & u,
+                               std::vector<bool> & found, const T accuracy, const index_t maxIter) const
+{
+    const gsFunction<T> & geo = static_cast<const gsFunction<T>&>(m_domain->piece(p));
+    const gsMatrix<T> supp = geo.support();
+    const bool square = x.rows() == u.rows();
+    const T stepTol = 1e-12 * (supp.col(1) - supp.col(0)).norm();
+
+    gsFuncData<T> fd(NEED_VALUE | NEED_DERIV);
+    std::vector<index_t> active(u.cols()), next;
+    for (index_t j = 0; j < u.cols(); ++j)
+        active[j] = j;
+    gsMatrix<T> ua;
+    gsVector<T> residual, delta, old;
+
+    for (index_t it = 0; it <= maxIter && !active.empty(); ++it)
+    {
+        // Evaluate the geometry at all active points at once
+        ua.resize(u.rows(), active.size());
+        for (size_t j = 0; j < active.size(); ++j)
+            ua.col(j) = u.col(active[j]);
+        geo.compute(ua, fd);
+
+        next.clear();
+        for (size_t j = 0; j < active.size(); ++j)
+        {
+            const index_t a = active[j];
+            residual = x.col(a) - fd.values[0].col(j);
+            if (residual.norm() <= accuracy)
+            {
+                found[a] = true;
+                continue;
+            }
+            if (it == maxIter)
+                continue;
+
+            if (square)
+                delta = fd.jacobian(j).partialPivLu().solve(residual);
+            else
+                delta = fd.jacobian(j).colPivHouseholderQr().solve(residual);
+
+            old = u.col(a);
+            u.col(a) = (old + delta).cwiseMax(supp.col(0)).cwiseMin(supp.col(1));
+
+            // Stagnation, e.g., at the boundary for points outside the patch
+            if ( (u.col(a) - old).norm() > stepTol )
+                next.push_back(a);
+        }
+        active.swap(next);
+    }
+}
+
+} // namespace gismo
@@ -112,6 +112,7 @@ public:
     {
         const gsHTensorBasis<d, T>* hbs =  dynamic_cast<const gsHTensorBasis<d, T> *>(m_basis);
         m_leaf = hbs->tree().beginLeafIterator();
+        m_id = 0;
         updateLeaf();
         updateElement();
     }
@@ -15,6 +15,7 @@
 
 #include <gsModeling/gsFitting.h>
 #include <gsHSplines/gsHTensorBasis.h>
+#include <gsHSplines/gsTHBSplineBasis.h>
 
 namespace gismo {
 
@@ -22,6 +23,14 @@ namespace gismo {
     \brief
     This class applies hierarchical fitting of parametrized point clouds.
 
+    The values of the basis functions at the parameters and the point
+    contributions to the normal equations are kept between the
+    iterations. For a THB-spline basis, only the points where a basis
+    function was changed by the refinement are evaluated again; the
+    rest of the system is carried over to the refined basis by the
+    transfer matrix. The new system is solved starting from the
+    previous fit.
+
     \tparam T coefficient type
 
     \ingroup HSplines
@@ -154,6 +163,26 @@ protected:
     /// Identifies the threshold from where we should refine
     T setRefineThreshold(const std::vector<T>& errors);
 
+    /// Computes the fit. If \a transfer is given, the basis was
+    /// refined with this transfer matrix after the previous call, and
+    /// the system is updated instead of assembled from scratch.
+    void computeIncremental(const gsSparseMatrix<T> * transfer = NULL);
+
+    /// Evaluates the basis at the parameters of the points \a pts,
+    /// one row of \a result per point
+    void collocationRows(const std::vector<index_t> & pts,
+                         gsSparseMatrix<T,RowMajor> & result) const;
+
+    /// Computes the point-wise errors, using the stored values of the
+    /// basis functions if they are up to date
+    void computeErrorsIncremental();
+
+    /// Adds \a sign times the contributions of the points \a pts to
+    /// the normal equations, where row \a i of \a colloc contains the
+    /// basis functions at point \a pts[i]
+    void addToSystem(const gsSparseMatrix<T,RowMajor> & colloc,
+                     const std::vector<index_t> & pts, T sign);
+
     /// Checks if a_cell is already inserted in container of cells
     static bool isCellAlreadyInserted(const gsVector<index_t, d>& a_cell,
                                       const std::vector<index_t>& cells);
@@ -177,10 +206,20 @@ protected:
     /// Size of the extension
     std::vector<unsigned> m_ext;
 
+    /// Values of the basis functions at the parameters, one row per point
+    gsSparseMatrix<T,RowMajor> m_colloc;
+
+    /// Point contributions to the normal equations (without smoothing
+    /// and constraints)
+    gsSparseMatrix<T> m_A;
+    gsMatrix<T> m_rhs;
+
     using gsFitting<T>::m_param_values;
     using gsFitting<T>::m_points;
     using gsFitting<T>::m_basis;
     using gsFitting<T>::m_result;
+    using gsFitting<T>::m_last_lambda;
+    using gsFitting<T>::m_constraintsLHS;
 
     using gsFitting<T>::m_pointErrors;
     using gsFitting<T>::m_max_error;
@@ -203,6 +242,9 @@ bool gsHFitting<d, T>::nextIteration(T tolerance, T err_threshold,
     // INVARIANT
     // look at iterativeRefine
 
+    gsSparseMatrix<T> transfer;
+    const gsSparseMatrix<T> * refined = NULL;
+
     if ( m_pointErrors.size() != 0 )
     {
 
@@ -216,7 +258,8 @@ bool gsHFitting<d, T>::nextIteration(T tolerance, T err_threshold,
                 return false;
 
             gsHTensorBasis<d, T>* basis = static_cast<gsHTensorBasis<d,T> *> (this->m_basis);
-            basis->refineElements(boxes);
+            basis->refineElements_withTransfer(boxes, transfer);
+            refined = &transfer;
 
             // If there are any fixed sides, prescribe the coefs in the finer basis.
             if(m_result != NULL && fixedSides.size() > 0)
@@ -234,12 +277,16 @@ bool gsHFitting<d, T>::nextIteration(T tolerance, T err_threshold,
     }
 
     // We run one fitting step and compute the errors
-    this->compute(m_lambda);
+    computeIncremental(refined);
 
     //parameter correction
     this->parameterCorrection(1e-7, maxPcIter, 1e-4);//closestPoint accuracy, orthogonality tolerance
 
-    this->computeErrors();
+    // The parameters have changed, the stored system is not valid anymore
+    if ( maxPcIter > 0 )
+        m_colloc.resize(0, 0);
+
+    computeErrorsIncremental();
 
     return true;
 }
@@ -253,8 +300,8 @@ void gsHFitting<d, T>::iterativeRefine(int numIterations, T tolerance, T err_thr
 
     if ( m_pointErrors.size() == 0 )
     {
-        this->compute(m_lambda);
-        this->computeErrors();
+        computeIncremental();
+        computeErrorsIncremental();
     }
 
     bool newIteration;
@@ -274,6 +321,234 @@ void gsHFitting<d, T>::iterativeRefine(int numIterations, T tolerance, T err_thr
     }
 }
 
+template<short_t d, class T>
+void gsHFitting<d, T>::computeIncremental(const gsSparseMatrix<T> * transfer)
+{
+    m_last_lambda = m_lambda;
+    const index_t numPts = m_points.rows();
+    const index_t num_basis = m_basis->size();
+
+    // The previous fit, expressed in the refined basis
+    gsMatrix<T> guess;
+    if ( m_result && transfer )
+    {
+        if ( m_result->coefs().rows() == transfer->cols() )
+            guess = (*transfer) * m_result->coefs();
+        else // the result was refined together with the basis
+            guess = m_result->coefs();
+    }
+
+    // Wipe out previous result
+    delete m_result;
+    m_result = NULL;
+
+    std::vector<index_t> pts;
+
+    // The update relies on the partition of unity of the THB-splines
+    if ( !transfer || m_colloc.rows() != numPts || m_colloc.cols() != transfer->cols()
+         || !dynamic_cast<const gsTHBSplineBasis<d,T>*>(m_basis) )
+    {
+        pts.resize(numPts);
+        for (index_t k = 0; k < numPts; ++k)
+            pts[k] = k;
+        collocationRows(pts, m_colloc);
+        m_A.resize(num_basis, num_basis);
+        m_rhs.setZero(num_basis, m_points.cols());
+        addToSystem(m_colloc, pts, 1);
+    }
+    else
+    {
+        const gsSparseMatrix<T> & tr = *transfer;
+
+        // An old basis function is unchanged iff its column of the
+        // transfer matrix is a unit vector; these are renumbered by P
+        std::vector<index_t> newIndex(tr.cols(), -1);
+        gsSparseEntries<T> entries;
+        for (index_t i = 0; i < tr.outerSize(); ++i)
+        {
+            typename gsSparseMatrix<T>::InnerIterator it(tr, i);
+            if ( !it ) continue;
+            const index_t row = it.row();
+            if ( math::abs(it.value() - 1) < 1e-12 && !(++it) )
+            {
+                newIndex[i] = row;
+                entries.add(row, i, 1);
+            }
+        }
+        gsSparseMatrix<T> P(tr.rows(), tr.cols());
+        P.setFrom(entries);
+
+        // A point is affected iff a basis function which is non-zero at
+        // the point has changed. By the partition of unity, the new
+        // functions also vanish at the other points.
+        std::vector<char> affected(numPts, 0);
+#       pragma omp parallel for
+        for (index_t k = 0; k < numPts; ++k)
+            for (typename gsSparseMatrix<T,RowMajor>::InnerIterator it(m_colloc, k); it; ++it)
+                if ( -1 == newIndex[it.col()] )
+                {
+                    affected[k] = 1;
+                    break;
+                }
+        for (index_t k = 0; k < numPts; ++k)
+            if ( affected[k] )
+                pts.push_back(k);
+
+        // Remove the contributions of the affected points and carry the
+        // rest of the system over to the refined basis
+        entries.clear();
+        for (size_t r = 0; r < pts.size(); ++r)
+            for (typename gsSparseMatrix<T,RowMajor>::InnerIterator it(m_colloc, pts[r]); it; ++it)
+                entries.add(r, it.col(), it.value());
+        gsSparseMatrix<T,RowMajor> colloc(pts.size(), tr.cols());
+        colloc.setFrom(entries);
+        addToSystem(colloc, pts, -1);
+
+        gsSparseMatrix<T> PA = P * m_A;
+        m_A = PA * P.transpose();
+        gsMatrix<T> rhs = P * m_rhs;
+        m_rhs.swap(rhs);
+
+        // Add the contributions of the affected points in the refined basis
+        collocationRows(pts, colloc);
+        addToSystem(colloc, pts, 1);
+
+        // Update the stored values of the basis functions
+        entries.clear();
+        entries.reserve(m_colloc.nonZeros() + colloc.nonZeros());
+        for (index_t k = 0, r = 0; k < numPts; ++k)
+        {
+            if ( affected[k] )
+            {
+                for (typename gsSparseMatrix<T,RowMajor>::InnerIterator it(colloc, r++); it; ++it)
+                    entries.add(k, it.col(), it.value());
+            }
+            else
+            {
+                for (typename gsSparseMatrix<T,RowMajor>::InnerIterator it(m_colloc, k); it; ++it)
+                    entries.add(k, newIndex[it.col()], it.value());
+            }
+        }
+        m_colloc.resize(numPts, num_basis);
+        m_colloc.setFrom(entries);
+
+        gsDebug << "updated the fitting system at " << pts.size() << " of " << numPts << " points.\n";
+    }
+
+    gsSparseMatrix<T> A_mat = m_A;
+    gsMatrix<T> B = m_rhs;
+    if ( m_constraintsLHS.rows() > 0 )
+    {
+        A_mat.conservativeResize(num_basis + m_constraintsLHS.rows(), num_basis + m_constraintsLHS.rows());
+        B.conservativeResize(num_basis + m_constraintsLHS.rows(), gsEigen::NoChange);
+        B.bottomRows(m_constraintsLHS.rows()).setZero();
+    }
+    if ( m_lambda > 0 || m_constraintsLHS.rows() > 0 )
+    {
+        // Room for the entries added by the smoothing and the constraints
+        index_t nonZerosPerCol = 1;
+        for (short_t i = 0; i < d; ++i)
+            nonZerosPerCol *= 2 * m_basis->basis(0).degree(i) + 1;
+        A_mat.reservePerColumn( nonZerosPerCol );
+    }
+
+    this->solveSystem(A_mat, B, m_lambda, guess);
+}
+
+template<short_t d, class T>
+void gsHFitting<d, T>::computeErrorsIncremental()
+{
+    if ( !m_result || m_colloc.rows() != m_points.rows()
+         || m_colloc.cols() != m_result->coefs().rows() )
+    {
+        this->computeErrors();
+        return;
+    }
+
+    // The values of the fit at the parameters
+    const gsMatrix<T> val = m_colloc * m_result->coefs();
+    m_pointErrors.resize(m_points.rows());
+    for (index_t i = 0; i < m_points.rows(); i++)
+        m_pointErrors[i] = (m_points.row(i) - val.row(i)).norm();
+    m_max_error = *std::max_element(m_pointErrors.begin(), m_pointErrors.end());
+    m_min_error = *std::min_element(m_pointErrors.begin(), m_pointErrors.end());
+}
+
+template<short_t d, class T>
+void gsHFitting<d, T>::collocationRows(const std::vector<index_t> & pts,
+                                       gsSparseMatrix<T,RowMajor> & result) const
+{
+    const gsBasis<T> & basis = *static_cast<const gsBasis<T>*>(m_basis);
+    const index_t numPts = pts.size();
+    const index_t chunkSize = 256;
+    const index_t numChunks = (numPts + chunkSize - 1) / chunkSize;
+
+    // The basis is evaluated at all points of a chunk at once
+    std::vector<gsSparseEntries<T> > entries(numChunks);
+#   pragma omp parallel for schedule(dynamic)
+    for (index_t c = 0; c < numChunks; ++c)
+    {
+        const index_t r0 = c * chunkSize;
+        const index_t np = math::min(chunkSize, numPts - r0);
+        gsMatrix<T> u(m_param_values.rows(), np), value;
+        gsMatrix<index_t> actives;
+        for (index_t p = 0; p < np; ++p)
+            u.col(p) = m_param_values.col(pts[r0 + p]);
+        basis.eval_into(u, value);
+        basis.active_into(u, actives);
+
+        entries[c].reserve(value.size());
+        for (index_t p = 0; p < np; ++p)
+            for (index_t i = 0; i < actives.rows(); ++i)
+                if ( 0 != value(i,p) ) // inactive entries (padding) have zero value
+                    entries[c].add(r0 + p, actives(i,p), value(i,p));
+    }
+
+    for (index_t c = 1; c < numChunks; ++c)
+    {
+        entries[0].insert(entries[0].end(), entries[c].begin(), entries[c].end());
+        gsSparseEntries<T>().swap(entries[c]);
+    }
+    result.resize(numPts, basis.size());
+    if ( numChunks > 0 )
+        result.setFrom(entries[0]);
+}
+
+template<short_t d, class T>
+void gsHFitting<d, T>::addToSystem(const gsSparseMatrix<T,RowMajor> & colloc,
+                                   const std::vector<index_t> & pts, T sign)
+{
+    const index_t numPts = pts.size();
+
+#   pragma omp parallel
+    {
+#       ifdef _OPENMP
+        const int tid = omp_get_thread_num();
+        const int nt  = omp_get_num_threads();
+#       else
+        const int tid = 0;
+        const int nt  = 1;
+#       endif
+
+        // Every thread computes the products for a block of points
+        const index_t r0 = numPts * tid / nt;
+        const index_t r1 = numPts * (tid + 1) / nt;
+        const gsSparseMatrix<T,RowMajor> block = colloc.middleRows(r0, r1 - r0);
+        gsMatrix<T> blockPts(r1 - r0, m_points.cols());
+        for (index_t r = r0; r < r1; ++r)
+            blockPts.row(r - r0) = m_points.row(pts[r]);
+
+        const gsSparseMatrix<T> A_loc = sign * (block.transpose() * block);
+        const gsMatrix<T> B_loc = sign * (block.transpose() * blockPts);
+
+#       pragma omp critical (gsHFitting_addToSystem)
+        {
+            m_A += A_loc;
+            m_rhs += B_loc;
+        }
+    }
+}
+
 template <short_t d, class T>
 std::vector<index_t> gsHFitting<d, T>::getBoxes(const std::vector<T>& errors,
                                                  const T threshold)
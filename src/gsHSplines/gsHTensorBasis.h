@@ -896,6 +896,18 @@ public:
      */
     virtual void unrefineElements(std::vector<index_t> const & boxes);
 
+    /**
+     * @brief      Removes all levels finer than \a lvl.
+     *
+     * Every element of a level higher than \a lvl is replaced by its
+     * ancestor in level \a lvl. Applied to a basis obtained by
+     * successive local refinements, this recovers the basis of an
+     * earlier refinement step (cf. gsGridHierarchy::buildByHierarchy).
+     *
+     * @param[in]  lvl   The finest level to be kept
+     */
+    void coarsenToLevel(index_t lvl);
+
     /// Refines all the cells on the side \a side up to level \a lvl
     void refineSide(const boxSide side, index_t lvl);
 
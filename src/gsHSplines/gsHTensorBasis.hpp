@@ -897,6 +897,42 @@ void gsHTensorBasis<d,T>::unrefineElements(std::vector<index_t> const & boxes)
     update_structure();
 }
 
+template<short_t d, class T>
+void gsHTensorBasis<d,T>::coarsenToLevel(index_t lvl)
+{
+    GISMO_ASSERT( lvl >= 0, "Invalid level "<< lvl );
+    if ( static_cast<unsigned>(lvl) >= maxLevel() ) return;
+
+    // rebuild the tree, inserting every leaf at most at level lvl;
+    // the leaves need not be aligned with the grid of level lvl,
+    // therefore the box is widened to the enclosing cells
+    gsHDomain<d> newtree( m_tree.upperCornerIndex() );
+    point lower, upper;
+    for (auto leafIt = m_tree.beginLeafIterator(); leafIt.good(); leafIt.next())
+    {
+        const index_t l = leafIt.level();
+        if ( 0 == l ) continue;
+        if ( l <= lvl )
+        {
+            newtree.insertBox(leafIt.lowerCorner(), leafIt.upperCorner(), l);
+            continue;
+        }
+        lower = leafIt.lowerCorner();
+        upper = leafIt.upperCorner();
+        const index_t s = l - lvl;
+        for ( short_t j = 0; j < d; ++j )
+        {
+            lower[j] >>= s;
+            upper[j]   = (upper[j] + (1 << s) - 1) >> s;
+        }
+        newtree.insertBox(lower, upper, lvl);
+    }
+    m_tree = newtree;
+
+    m_tree.computeMaxInsLevel();
+    update_structure();
+}
+
 template<short_t d, class T>
 void gsHTensorBasis<d,T>::refineSide(const boxSide side, index_t lvl)
 {
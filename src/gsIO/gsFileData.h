@@ -62,6 +62,31 @@ public:
      */
     bool read(String const & fn, bool recursive=false) ;
 
+    /**
+     * Opens a (native, uncompressed) G+Smo XML file in indexed mode.
+     *
+     * The file is scanned once and the tag, type, id, label and
+     * position of every top-level object are stored in a table. The
+     * objects themselves are parsed only when they are first
+     * requested (eg. by getId, getLabel or getFirst), by reading
+     * only their byte range from the file. Referenced files
+     * (<xmlfile> tags) are not loaded, see getIncludeById.
+     *
+     * @param fn filename string
+     * @param sidecar if true, the table is read from (or written to)
+     * the file  fn + ".idx", so that the scan is done only once
+     *
+     * Returns true on success, false on failure.
+     */
+    bool readIndexed(String const & fn, bool sidecar = true);
+
+    /// \brief Returns true if the file data was opened by readIndexed
+    bool isIndexed() const { return !m_indexFile.empty(); }
+
+    /// \brief Returns the number of indexed objects which have been
+    /// parsed so far
+    index_t numParsed() const;
+
     ~gsFileData();
 
     /// \brief Clear all data
@@ -104,12 +129,22 @@ private:
     /// File data as an xml tree
     FileData * data;
 
-    // Used to hold parsed data of native gismo XML files
-    std::list<std::vector<char> > m_buffer;
+    // Used to hold parsed data of native gismo XML files (also
+    // filled by const accessors in indexed mode)
+    mutable std::list<std::vector<char> > m_buffer;
 
     // Holds the last path that was used in an I/O operation
     mutable String m_lastPath;
 
+    // File opened by readIndexed (empty if not in indexed mode)
+    String m_indexFile;
+
+    // Table of the top-level objects of m_indexFile
+    std::vector<internal::gsXmlIndexEntry> m_index;
+
+    // Parsed nodes of the entries of m_index, or NULL if not parsed yet
+    mutable std::vector<gsXmlNode*> m_indexNodes;
+
 protected:
 
 /*
@@ -179,6 +214,7 @@ public:
     template<class Object>
     inline memory::unique_ptr<Object> getId( const int & id)  const
     {
+        fetchIndexed(internal::gsXml<Object>::tag(), "", id);
         return memory::make_unique( internal::gsXml<Object>::getId( getXmlRoot(), id ) );
     }
 
@@ -194,6 +230,7 @@ public:
     template<class Object>
     inline memory::unique_ptr<Object> getLabel(const std::string & name)  const
     {
+        fetchIndexed(internal::gsXml<Object>::tag(), "", -1, name);
         return memory::make_unique( internal::gsXml<Object>::getLabel( getXmlRoot(), name ) );
     }
 
@@ -226,6 +263,12 @@ public:
     /// Returns true if an Object exists in the filedata
     inline bool hasId(int id) const
     {
+        if ( isIndexed() )
+        {
+            for (size_t i = 0; i!=m_index.size(); ++i)
+                if (m_index[i].id == id) return true;
+            return false;
+        }
         gsXmlNode * root = getXmlRoot();
         const gsXmlAttribute * id_at;
         gsXmlNode * nd = internal::searchId(id, root);
@@ -251,6 +294,8 @@ public:
     template<class Object>
     inline int count() const
     {
+        fetchIndexed( internal::gsXml<Object>::tag(),
+                      internal::gsXml<Object>::type() );
         int i(0);
         for (gsXmlNode * child = getFirstNode( internal::gsXml<Object>::tag(),
                                                internal::gsXml<Object>::type() ) ;
@@ -373,6 +418,7 @@ public:
     {
         //GISMO_ASSERT(id < 0, "Id " << id << " should be >= 0!");
 
+        fetchIndexed("string", "", id);
         gsXmlNode * root = getXmlRoot();
         const gsXmlAttribute * id_at;
         gsXmlNode * nd = internal::searchId(id, root, "string");
@@ -388,6 +434,7 @@ public:
     {
         //GISMO_ASSERT(id < 0, "Id " << id << " should be >= 0!");
 
+        fetchIndexed("string", "", -1, label);
         gsXmlNode * root = getXmlRoot();
         const gsXmlAttribute * id_at;
         gsXmlNode * nd = internal::searchNode( root, "label", label, "string");
@@ -493,7 +540,8 @@ public:
     inline std::vector< memory::unique_ptr<Object> > getAll()  const
     {
         std::vector< memory::unique_ptr<Object> > result;
-
+        fetchIndexed( internal::gsXml<Object>::tag(),
+                      internal::gsXml<Object>::type() );
         for (gsXmlNode * child = getFirstNode( internal::gsXml<Object>::tag(),
                                                internal::gsXml<Object>::type() ) ;
              child; child = getNextSibling(child, internal::gsXml<Object>::tag(),
@@ -584,6 +632,18 @@ private:
                                        const String & name = "",
                                        const String & type = "" );
 
+    // Parses (if needed) the indexed objects matching the given tag,
+    // type, id and label (empty/-1 matches anything) into the XML
+    // tree. If \a firstOnly is true, only the first match is
+    // parsed. Returns the node of the first match, or NULL. Does
+    // nothing if not in indexed mode.
+    gsXmlNode * fetchIndexed(const String & name, const String & type,
+                             int id = -1, const String & label = "",
+                             bool firstOnly = false) const;
+
+    // Parses the i-th indexed object and places it in the XML tree
+    gsXmlNode * fetchIndexEntry(size_t i) const;
+
     // Helpers for X3D files
     void addX3dShape(gsXmlNode * shape);
     void addX3dTransform(gsXmlNode * shape);
@@ -70,12 +70,17 @@ gsFileData<T>::clear()
 {
     data->clear();
     data->makeRoot(); // ready to re-use
+    m_buffer.clear();
+    m_indexFile.clear();
+    m_index.clear();
+    m_indexNodes.clear();
 }
 
 
 template<class T>
 std::ostream & gsFileData<T>::print(std::ostream &os) const
 {
+    fetchIndexed("","");
     //rapidxml::print_no_indenting
     os<< *data;
     return os;
@@ -97,6 +102,7 @@ gsFileData<T>::addComment(std::string const & message)
 template<class T> void
 gsFileData<T>::save(std::string const & fname, bool compress)  const
 {
+    fetchIndexed("","");
     gsXmlNode * comment = internal::makeComment("This file was created by G+Smo "
                                                 GISMO_VERSION, *data);
     data->prepend_node(comment);
@@ -142,6 +148,7 @@ gsFileData<T>::saveCompressed(std::string const & fname)  const
         tmp = fname;
 
     m_lastPath = tmp;
+    fetchIndexed("","");
 
     ogzstream fn( tmp.c_str() );
     fn << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
@@ -292,6 +299,132 @@ bool gsFileData<T>::readGismoXmlStream(std::istream & is, bool recursive)
     return true;
 }
 
+template<class T>
+bool gsFileData<T>::readIndexed(String const & fn, bool sidecar)
+{
+    clear();
+    m_lastPath = gsFileManager::find(fn);
+    if ( m_lastPath.empty() )
+    {
+        gsWarn<<"gsFileData: Problem with file "<<fn<<": File not found.\n";
+        gsWarn<<"search paths: "<< gsFileManager::getSearchPaths()<<"\n";
+        return false;
+    }
+
+    if ( gsFileManager::getExtension(m_lastPath) != "xml" )
+    {
+        gsWarn<<"gsFileData: Indexed reading is available for .xml files only, reading "
+              <<fn<<" as a whole.\n";
+        return read(fn);
+    }
+
+    std::ifstream file(m_lastPath.c_str(), std::ios::in | std::ios::binary);
+    if ( file.fail() )
+    {gsWarn<<"gsFileData: Problem with file "<<fn<<": Cannot open file stream.\n"; return false; }
+    file.seekg(0, std::ios::end);
+    const size_t fileSize = static_cast<size_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    const String idxFile = m_lastPath + ".idx";
+    if ( !sidecar || !internal::readXmlIndex(idxFile, fileSize, m_index) )
+    {
+        if ( !internal::makeXmlIndex(file, m_index) )
+        {
+            gsWarn<< "gsFileData: Problem with file "<<m_lastPath
+                  <<": Invalid XML file, no root tag <xml> found.\n";
+            m_index.clear();
+            return false;
+        }
+        if ( sidecar && !internal::writeXmlIndex(idxFile, fileSize, m_index) )
+            gsWarn<<"gsFileData: Could not write index file "<<idxFile<<".\n";
+    }
+
+    m_indexFile = m_lastPath;
+    m_indexNodes.assign(m_index.size(), NULL);
+    return true;
+}
+
+template<class T>
+index_t gsFileData<T>::numParsed() const
+{
+    index_t c = 0;
+    for (size_t i = 0; i!=m_indexNodes.size(); ++i)
+        if ( m_indexNodes[i] ) ++c;
+    return c;
+}
+
+template<class T>
+typename gsFileData<T>::gsXmlNode *
+gsFileData<T>::fetchIndexEntry(size_t i) const
+{
+    if ( m_indexNodes[i] ) return m_indexNodes[i];
+
+    const internal::gsXmlIndexEntry & e = m_index[i];
+    std::ifstream file(m_indexFile.c_str(), std::ios::in | std::ios::binary);
+    GISMO_ENSURE( !file.fail(), "gsFileData: Cannot open file "<<m_indexFile );
+    file.seekg( static_cast<std::streamoff>(e.begin) );
+
+    // The parsed strings point into the buffer, which must persist
+    m_buffer.emplace_back(e.end - e.begin + 1, '\0');
+    std::vector<char> & buffer = m_buffer.back();
+    file.read(&buffer[0], static_cast<std::streamsize>(e.end - e.begin));
+    GISMO_ENSURE( !file.fail(), "gsFileData: Cannot read "<<e.tag<<" from "<<m_indexFile );
+
+    // Parse the object and move it under the root, keeping the file order
+    data->parse<0>(&buffer[0], true);
+    gsXmlNode * node = data->last_node();
+    data->remove_node(node);
+    gsXmlNode * where = NULL;
+    for (size_t j = i+1; j<m_indexNodes.size() && !where; ++j)
+        where = m_indexNodes[j];
+    getXmlRoot()->insert_node(where, node);
+    m_indexNodes[i] = node;
+
+    // Objects which refer to their siblings by id (eg. MultiPatch)
+    for (gsXmlNode * child = node->first_node(); child; child = child->next_sibling())
+    {
+        const gsXmlAttribute * type = child->first_attribute("type");
+        if ( !type ) continue;
+        std::vector<int> ids;
+        std::istringstream str(child->value());
+        if ( !strcmp(type->value(), "id_range") )
+        {
+            int first, last;
+            if (gsGetInt(str, first) && gsGetInt(str, last))
+                for (int k = first; k<=last; ++k) ids.push_back(k);
+        }
+        else if ( !strcmp(type->value(), "id_index") )
+            for (int k; gsGetInt(str, k);) ids.push_back(k);
+
+        for (std::vector<int>::const_iterator it = ids.begin(); it!=ids.end(); ++it)
+            fetchIndexed("", "", *it, "", true);
+    }
+    return node;
+}
+
+template<class T>
+typename gsFileData<T>::gsXmlNode *
+gsFileData<T>::fetchIndexed(const String & name, const String & type,
+                            int id, const String & label, bool firstOnly) const
+{
+    gsXmlNode * result = NULL;
+    if ( !isIndexed() ) return result;
+    for (size_t i = 0; i!=m_index.size(); ++i)
+    {
+        const internal::gsXmlIndexEntry & e = m_index[i];
+        if ( (name.empty()  || e.tag   == name ) &&
+             (type.empty()  || e.type  == type ) &&
+             (-1 == id      || e.id    == id   ) &&
+             (label.empty() || e.label == label) )
+        {
+            gsXmlNode * node = fetchIndexEntry(i);
+            if ( !result ) result = node;
+            if ( firstOnly ) break;
+        }
+    }
+    return result;
+}
+
 template<class T>
 void gsFileData<T>::getInclude(gsFileData<T> & res, index_t id, real_t time, std::string label)
 {   
@@ -319,6 +452,7 @@ void gsFileData<T>::getInclude(gsFileData<T> & res, index_t id, real_t time, std
     } 
 
     bool found=false;
+    fetchIndexed("xmlfile", "");
     gsXmlNode * root = getXmlRoot();
     const gsXmlAttribute * attribute;
 
@@ -327,7 +461,10 @@ void gsFileData<T>::getInclude(gsFileData<T> & res, index_t id, real_t time, std
     {
         std::string filename = gsFileManager::getPath(m_lastPath) +  nd->value();
         res.clear();
-        res.read(filename);
+        if ( isIndexed() )
+            res.readIndexed(filename);
+        else
+            res.read(filename);
         return;
     }
     GISMO_ERROR("Include with " << attr_name << "=" << attr_string << " does not exist!");
@@ -2575,6 +2712,20 @@ gsFileData<T>::contents () const
     std::ostringstream os;
     os << "--- \n";
     int i(1);
+    if ( isIndexed() )
+    {
+        for (size_t k = 0; k!=m_index.size(); ++k)
+        {
+            const internal::gsXmlIndexEntry & e = m_index[k];
+            os << i++ <<". " << e.tag;
+            if (!e.type.empty() ) os << ", type=" << e.type;
+            if (-1 != e.id      ) os << ", id="   << e.id;
+            if (!e.label.empty()) os << ", label="<< e.label;
+            os << (m_indexNodes[k] ? "\n" : " (not parsed)\n");
+        }
+        os << "--- \n";
+        return os.str();
+    }
     for (gsXmlNode * child = data->first_node("xml")->first_node();
          child; child = child->next_sibling() )
     {
@@ -2591,6 +2742,8 @@ gsFileData<T>::contents () const
 template<class T> inline
 int gsFileData<T>::numTags() const
 {
+    if ( isIndexed() )
+        return static_cast<int>(m_index.size());
     int i(0);
     for (gsXmlNode * child = data->first_node("xml")->first_node() ;
          child; child = child->next_sibling() )
@@ -2617,6 +2770,10 @@ template<class T> inline
 typename gsFileData<T>::gsXmlNode *
 gsFileData<T>::getFirstNode(const std::string & name, const std::string & type) const
 {
+    if ( isIndexed() )
+        if ( gsXmlNode * node = fetchIndexed(name, type, -1, "", true) )
+            return node;
+
     gsXmlNode * root = data->first_node("xml");
     if ( ! root )
     {
@@ -2641,6 +2798,15 @@ template<class T> inline
 typename gsFileData<T>::gsXmlNode *
 gsFileData<T>::getAnyFirstNode(const std::string & name, const std::string & type) const
 {
+    // Nested objects are not indexed, so all objects up to the first
+    // top-level match need to be parsed
+    if ( isIndexed() )
+        for (size_t i = 0; i!=m_index.size(); ++i)
+        {
+            fetchIndexEntry(i);
+            if ( m_index[i].tag == name && (type.empty() || m_index[i].type == type) )
+                break;
+        }
     gsXmlNode * root = data->first_node("xml");
     assert( root ) ;
     if ( type == "" )
@@ -42,6 +42,9 @@ namespace py = pybind11;
       .def(py::init<const std::string&>())
       
       .def("read", &Class::read)
+      .def("readIndexed", &Class::readIndexed, py::arg("fn"), py::arg("sidecar")=true)
+      .def("isIndexed", &Class::isIndexed)
+      .def("numParsed", &Class::numParsed)
       .def("clear", &Class::clear)
       .def("numData", &Class::numData)
       .def("save",           &Class::save,           py::arg("fname")="dump", py::arg("compress")=false)
@@ -27,7 +27,12 @@ namespace gismo
         GISMO_ENSURE(!dataSet.isEmpty(), "The gsParaviewDataSet you are trying to add is empty!");
         GISMO_ASSERT(time>=0, "Time should be a non-negative real number.");
 
-        if (! dataSet.isSaved()) dataSet.save(); // the actual files are written to disk/finalized
+        if (! dataSet.isSaved()) // the actual files are written to disk/finalized
+        {
+            // At most one time step is written in the background
+            if (m_flush.valid()) m_flush.get();
+            m_flush = dataSet.save( m_options.askSwitch("asyncWrite", false) );
+        }
         std::vector<std::string> filenames( dataSet.filenames() );
 
         time = time==-1 ? m_time : time;
@@ -66,6 +66,10 @@ namespace gismo {
     pc.save() // finalize and close the .pvd file
     \endverbatim
 
+    With the option "asyncWrite", saveTimeStep() returns as soon as
+    the fields are evaluated, and the files are written in the
+    background while the next time step is computed.
+
 
     The above creates a file with extension pvd. When opening this
     file with Paraview, the contents of all parts in the list are
@@ -185,7 +189,8 @@ public:
         m_dataset.addFields(rest...);
     }
 
-    /// @brief The current timestep is saved and files written to disk.
+    /// @brief The current timestep is saved and files written to disk
+    /// (in the background, if the option "asyncWrite" is set).
     void saveTimeStep(){
         GISMO_ENSURE( !m_dataset.isEmpty(), "The gsParaviewDataSet, stored internally by gsParaviewCollection, is empty! Try running newTimestep() before saveTimeStep().");
         addDataSet(m_dataset,m_time);
@@ -198,6 +203,8 @@ public:
         GISMO_ASSERT(!m_isSaved, "Error: gsParaviewCollection::save() already called." );
         if (!m_isSaved)
         {
+            if (m_flush.valid()) m_flush.get(); // wait for the last time step
+
             mfile <<"</Collection>\n";
             mfile <<"</VTKFile>\n";
 
@@ -231,6 +238,9 @@ private:
 
     gsParaviewDataSet m_dataset;
 
+    /// Background write of the last time step
+    std::future<void> m_flush;
+
     gsOptionList m_options;
 
     index_t counter;
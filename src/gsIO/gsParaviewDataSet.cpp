@@ -32,6 +32,7 @@ namespace gismo
 
         // QUESTION: Can I be certain that the ids are consecutive?
         initFilenames();
+        m_contents.resize(m_geometry->nPieces());
         for ( index_t k=0; k!=m_geometry->nPieces(); k++) // For every patch.
         {
             gsMatrix<real_t> activeBases = m_geometry->piece(k).support();
@@ -41,11 +42,9 @@ namespace gismo
             index_t np1 = (np.size()>1 ? np(1)-1 : 0);
             index_t np2 = (np.size()>2 ? np(2)-1 : 0);
 
-            // initializes individual .vts files
+            // initializes the contents of the individual .vts files
             // for every patch
-            std::ofstream file(m_filenames[k].c_str());
-            file << std::fixed; // no exponents
-            file << std::setprecision(5); // PLOT_PRECISION
+            std::stringstream file;
             file <<"<?xml version=\"1.0\"?>\n";
             file <<"<VTKFile type=\"StructuredGrid\" version=\"0.1\">\n";
             file <<"<StructuredGrid WholeExtent=\"0 "<< np(0)-1<<" 0 "<< np1 <<" 0 "
@@ -53,7 +52,7 @@ namespace gismo
             file <<"<Piece Extent=\"0 "<< np(0)-1<<" 0 "<<np1<<" 0 "
                 << np2 <<"\">\n";
             file <<"<PointData>\n";
-            file.close();
+            m_contents[k] = file.str();
         }
     }
 
@@ -64,9 +63,10 @@ namespace gismo
     }
 
 
-    void gsParaviewDataSet::save()
+    std::future<void> gsParaviewDataSet::save(bool async)
     {
         GISMO_ASSERT( !m_isSaved, "gsParaviewDataSet already saved.");
+        std::future<void> flush;
         if (!m_isSaved)
         {
             m_isSaved = true; 
@@ -75,41 +75,72 @@ namespace gismo
             unsigned precision = m_options.askInt("precision",5);
             bool plotElements   = m_options.askSwitch("plotElements", false);
             bool plotControlNet = m_options.askSwitch("plotControlNet", false);
+            int resolution = m_options.askInt("plotElements.resolution", -1);
+            const index_t nPatches = m_geometry->nPieces();
 
             std::vector<std::string> points = toVTK(*m_geometry,nPts,precision); //m_evaltr->geoMap2vtk(*m_geometry,nPts, precision);
             // QUESTION: Can I be certain that the ids are consecutive?
-            for ( index_t k=0; k!=m_geometry->nPieces(); k++) // For every patch.
+            for ( index_t k=0; k!=nPatches; k++) // For every patch.
             {
-                std::ofstream file;
-                file.open(m_filenames[k].c_str(), std::ios_base::app); // Append to file 
-                file <<"</PointData>\n\n\n<!-- GEOMETRY -->\n<Points>\n";
-                file << points[k];
-                file << "</Points>\n</Piece>\n</StructuredGrid>\n</VTKFile>";
-                file.close();
-                if (plotControlNet)
-                {
-                    writeSingleControlNet( m_geometry->piece(k), m_basename + "_cnet" + std::to_string(k));
-                    m_filenames.push_back( m_basename + "_cnet" + std::to_string(k)+".vtp");
-                } 
-                if ( plotElements)
+                m_contents[k] += "</PointData>\n\n\n<!-- GEOMETRY -->\n<Points>\n";
+                m_contents[k] += points[k];
+                m_contents[k] += "</Points>\n</Piece>\n</StructuredGrid>\n</VTKFile>";
+            }
+
+            if (plotControlNet || plotElements)
+            {
+#               pragma omp parallel for schedule(dynamic)
+                for ( index_t k=0; k < nPatches; k++) // For every patch.
                 {
-                    int numPoints = m_options.getInt("plotElements.resolution");
-                    if (-1 == numPoints )
+                    if (plotControlNet)
+                        writeSingleControlNet( m_geometry->patch(k), m_basename + "_cnet" + std::to_string(k));
+                    if ( plotElements)
                     {
-                        const real_t evalPtsPerElem = 16 * (1.0 / m_geometry->piece(k).basis().numElements());
-
-                        // copied from gsWriteParaview
-                        numPoints = cast<real_t,int>(
-                            static_cast<real_t>(math::max( m_geometry->piece(k).basis().maxDegree()-1, (short_t)1))
-                            * math::pow(evalPtsPerElem, (real_t)(1.0)/static_cast<real_t>(m_geometry->domainDim())) );
+                        int numPoints = resolution;
+                        if (-1 == numPoints )
+                        {
+                            const real_t evalPtsPerElem = 16 * (1.0 / m_geometry->basis(k).numElements());
+
+                            // copied from gsWriteParaview
+                            numPoints = cast<real_t,int>(
+                                static_cast<real_t>(math::max( m_geometry->basis(k).maxDegree()-1, (short_t)1))
+                                * math::pow(evalPtsPerElem, (real_t)(1.0)/static_cast<real_t>(m_geometry->domainDim())) );
+                        }
+                        gsMesh<real_t> msh( m_geometry->basis(k), numPoints);
+                        m_geometry->patch(k).evaluateMesh(msh);
+                        gsWriteParaview(msh, m_basename + "_mesh" + std::to_string(k), false);
                     }
-                    gsMesh<real_t> msh( gsMultiBasis<real_t>(*m_geometry).basis(k), numPoints);
-                    static_cast<const gsGeometry<real_t>&>(m_geometry->piece(k)).evaluateMesh(msh);
-                    gsWriteParaview(msh, m_basename + "_mesh" + std::to_string(k), false);
-                    m_filenames.push_back( m_basename + "_mesh" + std::to_string(k)+".vtp");
+                }
+                for ( index_t k=0; k!=nPatches; k++)
+                {
+                    if (plotControlNet)
+                        m_filenames.push_back( m_basename + "_cnet" + std::to_string(k)+".vtp");
+                    if (plotElements)
+                        m_filenames.push_back( m_basename + "_mesh" + std::to_string(k)+".vtp");
                 }
             }
+
             // output text files for each part.
+            std::vector<std::string> names(m_filenames.begin(), m_filenames.begin() + nPatches);
+            if (async)
+                flush = std::async(std::launch::async, &gsParaviewDataSet::writeFiles,
+                                   std::move(names), std::move(m_contents));
+            else
+                writeFiles(names, m_contents);
+            m_contents.clear();
+        }
+        return flush;
+    }
+
+    void gsParaviewDataSet::writeFiles(const std::vector<std::string> & names,
+                                       const std::vector<std::string> & contents)
+    {
+        for (size_t k=0; k!=names.size(); k++)
+        {
+            std::ofstream file(names[k].c_str());
+            GISMO_ENSURE(file.is_open(), "Error creating "<< names[k] );
+            file << contents[k];
+            file.close();
         }
     }
 
@@ -20,6 +20,7 @@
 #include <gsAssembler/gsExprEvaluator.h>
 
 #include<fstream>
+#include<future>
 
 namespace gismo 
 {
@@ -30,6 +31,10 @@ namespace gismo
     This class is used by gsParaviewCollection to manage said files, 
     but can be used by the user explicitly as well.
 
+    The patches are evaluated and formatted in parallel. The contents
+    of the files are kept in memory and written by save(), optionally
+    in a background thread.
+
     \ingroup IO
 */
 class GISMO_EXPORT gsParaviewDataSet // a collection of .vts files 
@@ -37,6 +42,7 @@ class GISMO_EXPORT gsParaviewDataSet // a collection of .vts files
 private:
     std::string m_basename;
     std::vector<std::string> m_filenames;
+    std::vector<std::string> m_contents; // contents of the .vts files, written by save()
     const gsMultiPatch<real_t> * m_geometry;
     gsExprEvaluator<real_t> * m_evaltr;
     gsOptionList m_options;
@@ -78,15 +84,9 @@ public:
         //gsMultiBasis<real_t> mb(*m_geometry);
         //ev.setIntegrationElements(mb);
         std::vector<std::string> tags = toVTK(expr,nPts,precision,label);
-        std::vector<std::string> fnames = filenames();
 
         for ( index_t k=0; k!=m_geometry->nPieces(); k++) // For every patch.
-        {
-            std::ofstream file;
-            file.open( fnames[k].c_str(), std::ios_base::app); // Append to file
-            file << tags[k];
-            file.close(); 
-        }
+            m_contents[k] += tags[k];
     }
 
     // Just here to stop the recursion
@@ -129,15 +129,9 @@ public:
         unsigned precision = m_options.askInt("precision",5);
 
         std::vector<std::string> tags = toVTK( field, nPts, precision, label);
-        std::vector<std::string> fnames = filenames();
 
         for ( index_t k=0; k!=m_geometry->nPieces(); k++) // For every patch.
-        {
-            std::ofstream file;
-            file.open( fnames[k].c_str(), std::ios_base::app); // Append to file
-            file << tags[k];
-            file.close(); 
-        }
+            m_contents[k] += tags[k];
     }
 
     /// @brief Recursive form of addField()
@@ -159,7 +153,14 @@ public:
     /// @return A vector of strings
     const std::vector<std::string> filenames();
 
-    void save();
+    /// @brief Evaluates the geometry and writes all files to disk.
+    /// @param async If true, the .vts files are written by a background
+    /// thread; the returned future becomes ready when they are
+    /// written (its destructor waits for that). All evaluations are
+    /// done before save() returns, so the geometry and the fields
+    /// can be modified afterwards.
+    /// @return The future of the background write (invalid if \a async is false)
+    std::future<void> save(bool async = false);
 
     bool isEmpty();
 
@@ -176,6 +177,7 @@ public:
         opt.addString("subfolder","Name of subfolder where the vtk files will be stored.", "");
         opt.addSwitch("plotElements", "Controls plotting of element mesh.", false);
         opt.addSwitch("plotControlNet", "Controls plotting of control point grid.", false);
+        opt.addSwitch("asyncWrite", "Write the files of a time step in the background (used by gsParaviewCollection).", false);
         return opt;
     }
 
@@ -191,25 +193,18 @@ private:
     template< class T>
     static std::vector<std::string> toVTK(const gsFunctionSet<T> & funSet, unsigned nPts=1000, unsigned precision=5, std::string label="")
     {   
-        std::vector<std::string> out;
-        gsMatrix<T> evalPoint, xyzPoints;
+        std::vector<std::string> out(funSet.nPieces());
 
-        // Loop over all patches
-        for ( index_t i=0; i != funSet.nPieces(); ++i )
+        // The patches are independent, evaluate and format them in parallel
+#       pragma omp parallel for schedule(dynamic)
+        for ( index_t i=0; i < funSet.nPieces(); ++i )
         {
             gsGridIterator<T,CUBE> grid(funSet.piece(i).support(), nPts);
 
-            // Evaluate the MultiPatch for every parametric point of the grid iterator
-            xyzPoints.resize( funSet.targetDim(), grid.numPoints() );
-            index_t col = 0;
-            for( grid.reset(); grid; ++grid )
-            {
-                evalPoint = *grid; // ..
-                xyzPoints.col(col) =  funSet.piece(i).eval(evalPoint);
-                col++;
-            }
+            // Evaluate the MultiPatch at all parametric points of the grid iterator
+            const gsMatrix<T> xyzPoints = funSet.piece(i).eval(grid.toMatrix());
 
-            out.push_back( toDataArray(xyzPoints, label, precision)  );
+            out[i] = toDataArray(xyzPoints, label, precision);
         }
         return out; 
     }
@@ -217,25 +212,17 @@ private:
     template< class T>
     static std::vector<std::string> toVTK(const gsField<T> & field, unsigned nPts=1000, unsigned precision=5, std::string label="")
     {   
-        std::vector<std::string> out;
-        gsMatrix<T> evalPoint, xyzPoints;
+        std::vector<std::string> out(field.nPieces());
 
-        // Loop over all patches
-        for ( index_t i=0; i != field.nPieces(); ++i )
+#       pragma omp parallel for schedule(dynamic)
+        for ( index_t i=0; i < field.nPieces(); ++i )
         {
-            gsGridIterator<T,CUBE> grid(field.fields().piece(i).support(), nPts);
+            gsGridIterator<T,CUBE> grid(field.patches().piece(i).support(), nPts);
 
-            // Evaluate the MultiPatch for every parametric point of the grid iterator
-            xyzPoints.resize( field.dim(), grid.numPoints());
-            index_t col = 0;
-            for( grid.reset(); grid; ++grid )
-            {
-                evalPoint = *grid; // ..
-                xyzPoints.col(col) =  field.value(evalPoint, i);
-                col++;
-            }
+            // Evaluate the field at all parametric points of the grid iterator
+            const gsMatrix<T> xyzPoints = field.value(grid.toMatrix(), i);
 
-            out.push_back( toDataArray(xyzPoints, label, precision)  );
+            out[i] = toDataArray(xyzPoints, label, precision);
         }
         return out; 
     }
@@ -251,42 +238,48 @@ private:
                                             unsigned precision=5,
                                             std::string label="SolutionField")
     {   
-        std::vector<std::string> out;
-        std::stringstream dataArray;
-        dataArray.setf( std::ios::fixed ); // write floating point values in fixed-point notation.
-        dataArray.precision(precision);
         // m_exprdata->parse(expr);
 
         //if false, embed topology ?
         const index_t n = m_evaltr->exprData()->multiBasis().nBases();
 
-        gsMatrix<real_t> pts, vals, ab;
-
+        // The evaluator is not thread-safe: evaluate the patches one after
+        // another and format them in parallel afterwards
+        std::vector< gsMatrix<real_t> > vals(n);
+        gsMatrix<real_t> ab;
         for ( index_t i=0; i != n; ++i )
         {
             ab = m_evaltr->exprData()->multiBasis().piece(i).support();
             gsGridIterator<real_t,CUBE> pt(ab, nPts);
             m_evaltr->eval(expr, pt, i);
             
-            vals = m_evaltr->allValues(m_evaltr->elementwise().size()/pt.numPoints(), pt.numPoints());
+            vals[i] = m_evaltr->allValues(m_evaltr->elementwise().size()/pt.numPoints(), pt.numPoints());
+        }
 
-            dataArray <<"<DataArray type=\"Float32\" Name=\""<< label <<"\" format=\"ascii\" NumberOfComponents=\""<< ( vals.rows()==1 ? 1 : 3) <<"\">\n";
-            if ( vals.rows()==1 )
-                for ( index_t j=0; j<vals.cols(); ++j)
-                    dataArray<< vals.at(j) <<" ";
+        std::vector<std::string> out(n);
+#       pragma omp parallel for schedule(dynamic)
+        for ( index_t i=0; i < n; ++i )
+        {
+            const gsMatrix<real_t> & v = vals[i];
+            std::stringstream dataArray;
+            dataArray.setf( std::ios::fixed ); // write floating point values in fixed-point notation.
+            dataArray.precision(precision);
+            dataArray <<"<DataArray type=\"Float32\" Name=\""<< label <<"\" format=\"ascii\" NumberOfComponents=\""<< ( v.rows()==1 ? 1 : 3) <<"\">\n";
+            if ( v.rows()==1 )
+                for ( index_t j=0; j<v.cols(); ++j)
+                    dataArray<< v.at(j) <<" ";
             else
             {
-                for ( index_t j=0; j<vals.cols(); ++j)
+                for ( index_t j=0; j<v.cols(); ++j)
                 {
-                    for ( index_t k=0; k!=vals.rows(); ++k)
-                        dataArray<< vals(k,j) <<" ";
-                    for ( index_t k=vals.rows(); k<3; ++k)
+                    for ( index_t k=0; k!=v.rows(); ++k)
+                        dataArray<< v(k,j) <<" ";
+                    for ( index_t k=v.rows(); k<3; ++k)
                         dataArray<<"0 ";
                 }
             }
             dataArray <<"\n</DataArray>\n";
-            out.push_back( dataArray.str() );
-            dataArray.str(std::string()); // Clear the dataArray stringstream
+            out[i] = dataArray.str();
         }
         return out; 
     }
@@ -324,5 +317,9 @@ private:
 
     void initFilenames();
 
+    /// Writes \a contents[k] to the file \a names[k]
+    static void writeFiles(const std::vector<std::string> & names,
+                           const std::vector<std::string> & contents);
+
 };
 } // End namespace gismo
@@ -130,6 +130,41 @@ template<class T>
 void gsWriteParaview(gsFunctionSet<T> const& geo, gsFunctionSet<T> const& func,
                      std::string const & fn, unsigned npts = NS, const std::string pDelim = "");
 
+/// \brief Export a gsGeometry to paraview file, using one rational Bezier
+/// cell (VTK_BEZIER_CURVE, _QUADRILATERAL or _HEXAHEDRON) per element
+///
+/// Unlike sampling, this represents B-spline and NURBS geometries
+/// exactly; Paraview subdivides the cells adaptively for rendering.
+///
+/// \param Geo a geometry object
+/// \param fn filename where paraview file is written
+template<class T>
+void gsWriteParaviewBezier(const gsGeometry<T> & Geo, std::string const & fn);
+
+/// \brief Export a multipatch geometry to paraview file, using one
+/// rational Bezier cell per element
+///
+/// \param mp a multipatch object
+/// \param fn filename where paraview file is written
+/// \param pDelim is the delimiter that is used to separate fn from the patch index
+template<class T>
+void gsWriteParaviewBezier(const gsMultiPatch<T> & mp, std::string const & fn,
+                           const std::string pDelim = "_");
+
+/// \brief Write a solution field to paraview file, using one rational
+/// Bezier cell per element
+///
+/// The control points of the field are obtained by interpolation on
+/// each element, which is exact for parametric fields given by splines
+/// (which are piecewise polynomials of at most the degree of the cells).
+///
+/// \param field a field object
+/// \param fn filename where paraview file is written
+/// \param pDelim is the delimiter that is used to separate fn from the patch index
+template<class T>
+void gsWriteParaviewBezier(const gsField<T> & field, std::string const & fn,
+                           const std::string pDelim = "");
+
 /// \brief Export a multipatch Geometry (without scalar information) to paraview file
 ///
 /// \param Geo a multipatch object
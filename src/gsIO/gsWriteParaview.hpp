@@ -660,6 +660,300 @@ void writeSingleTrimSurface(const gsTrimSurface<T> & surf,
     gsWriteParaview( *msh, fn);
 }
 
+namespace
+{
+// Position of the control point (i,j,k) of a Bezier cell of the given
+// degrees in the VTK numbering of the points of higher-order cells:
+// vertices, edges, faces, interior (VTK file version 2.2)
+inline index_t vtkBezierPointIndex(index_t i, index_t j, index_t k, const gsVector<index_t,3> & p)
+{
+    const bool ib = (i == 0 || i == p[0]);
+    const bool jb = (j == 0 || j == p[1]) || p[1] == 0;
+    const bool kb = (k == 0 || k == p[2]) || p[2] == 0;
+    const index_t nb = ib + jb + kb;
+    const index_t nVert = p[2] ? 8 : (p[1] ? 4 : 2);
+
+    if (nb == 3) // vertex
+        return (i ? (j ? 2 : 1) : (j ? 3 : 0)) + (k ? 4 : 0);
+
+    if (0 == p[1]) // curve: the interior points follow the end points
+        return i + 1;
+
+    index_t offset = nVert;
+    const index_t e0 = p[0] - 1, e1 = p[1] - 1, e2 = p[2] - 1;
+    if (nb == 2) // edge
+    {
+        if (!ib)
+            return (i - 1) + (j ? e0 + e1 : 0) + (k ? 2 * (e0 + e1) : 0) + offset;
+        if (!jb)
+            return (j - 1) + (i ? e0 : 2 * e0 + e1) + (k ? 2 * (e0 + e1) : 0) + offset;
+        offset += 4 * (e0 + e1);
+        return (k - 1) + e2 * (i ? (j ? 2 : 1) : (j ? 3 : 0)) + offset;
+    }
+
+    offset += (p[2] ? 4 : 2) * (e0 + e1) + (p[2] ? 4 * e2 : 0);
+    if (0 == p[2]) // interior of a quadrilateral
+        return (i - 1) + e0 * (j - 1) + offset;
+
+    if (nb == 1) // face
+    {
+        if (ib)
+            return (j - 1) + e1 * (k - 1) + (i ? e1 * e2 : 0) + offset;
+        offset += 2 * e1 * e2;
+        if (jb)
+            return (i - 1) + e0 * (k - 1) + (j ? e2 * e0 : 0) + offset;
+        offset += 2 * e2 * e0;
+        return (i - 1) + e0 * (j - 1) + (k ? e0 * e1 : 0) + offset;
+    }
+
+    offset += 2 * (e1 * e2 + e2 * e0 + e0 * e1);
+    return offset + (i - 1) + e0 * ((j - 1) + e1 * (k - 1));
+}
+}
+
+/// Write the elements of a patch as rational Bezier cells, optionally
+/// with a field (given in parametric or in physical coordinates)
+template<class T>
+void writeSingleBezierPatch(const gsGeometry<T> & geo,
+                            const gsFunction<T> * func,
+                            const gsBasis<T> * funcBasis,
+                            const bool isParam,
+                            std::string const & fn)
+{
+    const short_t d = geo.domainDim();
+    const short_t n = geo.targetDim();
+    if (d > 3 || n > 3)
+    {
+        gsWarn<< "writeSingleBezierPatch: Cannot plot more than 3 dimensions.\n";
+        return;
+    }
+    const gsBasis<T> & basis = geo.basis();
+    const bool rational = basis.isRational();
+
+    // Degree of the cells; a parametric field on a finer mesh defines
+    // the elements
+    gsVector<index_t,3> deg;
+    deg.setZero();
+    for (short_t k = 0; k < d; ++k)
+    {
+        deg[k] = math::max<index_t>(basis.degree(k), 1);
+        if (funcBasis)
+            deg[k] = math::max<index_t>(deg[k], funcBasis->degree(k));
+    }
+    const gsBasis<T> & mesh = funcBasis && funcBasis->numElements() > basis.numElements() ? *funcBasis : basis;
+
+    // The control points of a polynomial of degree deg on the element are
+    // obtained by interpolation at equidistant nodes; the inverse of the
+    // collocation matrix of the Bernstein polynomials is the same for all
+    // elements. The nodes are ordered lexicographically (first direction
+    // fastest), so the collocation matrix is B_{d-1} x ... x B_0.
+    gsMatrix<T> colloc(1,1), Bk;
+    colloc(0,0) = 1;
+    for (short_t k = 0; k < d; ++k)
+    {
+        const index_t q = deg[k];
+        Bk.resize(q+1, q+1);
+        for (index_t a = 0; a <= q; ++a)
+        {
+            const T t = (T)(a) / (T)(q);
+            for (index_t b = 0; b <= q; ++b)
+                Bk(a,b) = (T)binomial<index_t>(q,b) * math::pow(t, (T)b) * math::pow(1-t, (T)(q-b));
+        }
+        colloc = Bk.kron(colloc);
+    }
+    const gsMatrix<T> collocInv = colloc.inverse();
+    const index_t nn = colloc.rows();
+
+    // Nodes on the reference element and VTK numbering of the control points
+    gsMatrix<T> refNodes(d, nn);
+    std::vector<index_t> vtkIndex(nn);
+    for (index_t l = 0; l < nn; ++l)
+    {
+        gsVector<index_t,3> ijk;
+        ijk.setZero();
+        for (index_t k = 0, r = l; k < d; ++k)
+        {
+            ijk[k] = r % (deg[k] + 1);
+            r /= deg[k] + 1;
+            refNodes(k, l) = (T)(ijk[k]) / (T)(deg[k]);
+        }
+        vtkIndex[l] = vtkBezierPointIndex(ijk[0], ijk[1], ijk[2], deg);
+    }
+
+    const index_t numEl = mesh.numElements();
+    const index_t fd = func ? func->targetDim() : 0;
+    gsMatrix<T> points(3, numEl * nn), values(fd == 1 ? 1 : 3, func ? numEl * nn : 0), weights;
+    points.setZero();
+    values.setZero();
+    if (rational)
+        weights.resize(1, numEl * nn);
+
+    gsMatrix<T> nodes(d, nn), geoVals, funcVals, w, homog(n + 1 + fd, nn), coefs, rvals;
+    gsMatrix<index_t> act;
+    const gsMatrix<T> & basisWeights = basis.weights();
+    index_t e = 0;
+    typename gsBasis<T>::domainIter domIt = mesh.makeDomainIterator();
+    for (; domIt->good(); domIt->next(), ++e)
+    {
+        const gsVector<T> & lo = domIt->lowerCorner(), & up = domIt->upperCorner();
+        for (index_t l = 0; l < nn; ++l)
+            nodes.col(l) = lo.array() + refNodes.col(l).array() * (up - lo).array();
+
+        geo.eval_into(nodes, geoVals);
+        if (func)
+            func->eval_into(isParam ? nodes : geoVals, funcVals);
+
+        // Weight function: for the rational basis R_i = w_i N_i / W, so W = 1 / sum_i R_i / w_i
+        w.setOnes(1, nn);
+        if (rational)
+        {
+            basis.active_into(nodes, act);
+            basis.eval_into(nodes, rvals);
+            for (index_t l = 0; l < nn; ++l)
+            {
+                T sum = 0;
+                for (index_t r = 0; r < act.rows(); ++r)
+                    sum += rvals(r, l) / basisWeights(act(r, l), 0);
+                w(0, l) = 1 / sum;
+            }
+        }
+
+        // Interpolate in homogeneous coordinates
+        homog.topRows(n) = geoVals.array().rowwise() * w.row(0).array();
+        homog.row(n) = w;
+        if (func)
+            homog.bottomRows(fd) = funcVals.array().rowwise() * w.row(0).array();
+        coefs.noalias() = homog * collocInv.transpose();
+
+        for (index_t l = 0; l < nn; ++l)
+        {
+            const index_t c = e * nn + vtkIndex[l];
+            const T cw = coefs(n, l);
+            points.col(c).head(n) = coefs.col(l).head(n) / cw;
+            if (func)
+                values.col(c).head(fd) = coefs.col(l).tail(fd) / cw;
+            if (rational)
+                weights(0, c) = cw;
+        }
+    }
+
+    static const int cellType[3] = { 75, 77, 79 }; // VTK_BEZIER_CURVE, _QUADRILATERAL, _HEXAHEDRON
+
+    std::string mfn(fn);
+    mfn.append(".vtu");
+    std::ofstream file(mfn.c_str());
+    if ( ! file.is_open() )
+        gsWarn<<"writeSingleBezierPatch: Problem opening file \""<<fn<<"\""<<std::endl;
+    file << std::fixed; // no exponents
+    file << std::setprecision (PLOT_PRECISION);
+
+    file <<"<?xml version=\"1.0\"?>\n";
+    file <<"<VTKFile type=\"UnstructuredGrid\" version=\"2.2\">\n";
+    file <<"<UnstructuredGrid>\n";
+    file <<"<Piece NumberOfPoints=\""<< numEl * nn <<"\" NumberOfCells=\""<< numEl <<"\">\n";
+
+    file <<"<PointData";
+    if (func)
+        file <<" "<< ( values.rows()==1 ? "Scalars" : "Vectors" ) <<"=\"SolutionField\"";
+    if (rational)
+        file <<" RationalWeights=\"RationalWeights\"";
+    file <<">\n";
+    if (func)
+    {
+        file <<"<DataArray type=\"Float32\" Name=\"SolutionField\" format=\"ascii\" NumberOfComponents=\""<< values.rows() <<"\">\n";
+        for ( index_t j=0; j<values.cols(); ++j)
+            for ( index_t i=0; i!=values.rows(); ++i)
+                file<< values(i,j) <<" ";
+        file <<"</DataArray>\n";
+    }
+    if (rational)
+    {
+        file <<"<DataArray type=\"Float32\" Name=\"RationalWeights\" format=\"ascii\" NumberOfComponents=\"1\">\n";
+        for ( index_t j=0; j<weights.cols(); ++j)
+            file<< weights(0,j) <<" ";
+        file <<"</DataArray>\n";
+    }
+    file <<"</PointData>\n";
+
+    file <<"<CellData HigherOrderDegrees=\"HigherOrderDegrees\">\n";
+    file <<"<DataArray type=\"Int32\" Name=\"HigherOrderDegrees\" format=\"ascii\" NumberOfComponents=\"3\">\n";
+    for ( index_t j=0; j<numEl; ++j)
+        file<< deg[0] <<" "<< deg[1] <<" "<< deg[2] <<" ";
+    file <<"</DataArray>\n";
+    file <<"</CellData>\n";
+
+    file <<"<Points>\n";
+    file <<"<DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">\n";
+    for ( index_t j=0; j<points.cols(); ++j)
+        file<< points(0,j) <<" "<< points(1,j) <<" "<< points(2,j) <<" ";
+    file <<"</DataArray>\n";
+    file <<"</Points>\n";
+
+    file <<"<Cells>\n";
+    file <<"<DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">\n";
+    for ( index_t j=0; j<numEl * nn; ++j)
+        file<< j <<" ";
+    file <<"</DataArray>\n";
+    file <<"<DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">\n";
+    for ( index_t j=1; j<=numEl; ++j)
+        file<< j * nn <<" ";
+    file <<"</DataArray>\n";
+    file <<"<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">\n";
+    for ( index_t j=0; j<numEl; ++j)
+        file<< cellType[d-1] <<" ";
+    file <<"</DataArray>\n";
+    file <<"</Cells>\n";
+
+    file <<"</Piece>\n";
+    file <<"</UnstructuredGrid>\n";
+    file <<"</VTKFile>\n";
+    file.close();
+}
+
+template<class T>
+void gsWriteParaviewBezier(const gsGeometry<T> & Geo, std::string const & fn)
+{
+    gsParaviewCollection collection(fn);
+    writeSingleBezierPatch<T>(Geo, NULL, NULL, true, fn);
+    collection.addPart(gsFileManager::getFilename(fn) + ".vtu");
+    collection.save();
+}
+
+template<class T>
+void gsWriteParaviewBezier(const gsMultiPatch<T> & mp, std::string const & fn,
+                           const std::string pDelim)
+{
+    gsParaviewCollection collection(fn);
+    const index_t n = mp.nPatches();
+
+    // The patches are independent, write them in parallel
+#   pragma omp parallel for schedule(dynamic)
+    for ( index_t i=0; i < n; ++i )
+        writeSingleBezierPatch<T>(mp.patch(i), NULL, NULL, true, fn + pDelim + util::to_string(i));
+
+    for ( index_t i=0; i < n; ++i )
+        collection.addPart(gsFileManager::getFilename(fn + pDelim + util::to_string(i)) + ".vtu");
+    collection.save();
+}
+
+template<class T>
+void gsWriteParaviewBezier(const gsField<T> & field, std::string const & fn,
+                           const std::string pDelim)
+{
+    gsParaviewCollection collection(fn);
+    const index_t n = field.nPieces();
+
+#   pragma omp parallel for schedule(dynamic)
+    for ( index_t i=0; i < n; ++i )
+        writeSingleBezierPatch(field.patch(i), &field.function(i),
+                               field.isParametrized() ? &field.igaFunction(i).basis() : NULL,
+                               field.isParametric(), fn + pDelim + util::to_string(i));
+
+    for ( index_t i=0; i < n; ++i )
+        collection.addPart(gsFileManager::getFilename(fn + pDelim + util::to_string(i)) + ".vtu");
+    collection.save();
+}
+
 /// Write a file containing a solution field over a geometry
 template<class T>
 void gsWriteParaview(const gsField<T> & field,
@@ -675,28 +969,28 @@ void gsWriteParaview(const gsField<T> & field,
     }
     */
 
-    const unsigned n = field.nPieces();
+    const index_t n = field.nPieces();
     gsParaviewCollection collection(fn);
-    std::string fileName, fileName_nopath;
 
-    for ( unsigned i=0; i < n; ++i )
+    // The patches are independent, write them in parallel
+#   pragma omp parallel for schedule(dynamic)
+    for ( index_t i=0; i < n; ++i )
     {
         const gsBasis<T> & dom = field.isParametrized() ?
             field.igaFunction(i).basis() : field.patch(i).basis();
 
-        fileName = fn + pDelim + util::to_string(i);
-        fileName_nopath = gsFileManager::getFilename(fileName);
+        const std::string fileName = fn + pDelim + util::to_string(i);
         writeSinglePatchField( field, i, fileName, npts );
-        collection.addPart(fileName_nopath + ".vts");
         if ( mesh )
-        {
-            fileName+= "_mesh";
-            fileName_nopath = gsFileManager::getFilename(fileName);
-            writeSingleCompMesh(dom, field.patch(i), fileName);
-
-            collection.addPart(fileName_nopath + ".vtp");
-        }
+            writeSingleCompMesh(dom, field.patch(i), fileName + "_mesh");
+    }
 
+    for ( index_t i=0; i < n; ++i )
+    {
+        const std::string fileName_nopath = gsFileManager::getFilename(fn + pDelim + util::to_string(i));
+        collection.addPart(fileName_nopath + ".vts");
+        if ( mesh )
+            collection.addPart(fileName_nopath + "_mesh.vtp");
     }
     collection.save();
 }
@@ -718,17 +1012,15 @@ void gsWriteParaview(gsFunctionSet<T> const& geo,
 
     GISMO_ASSERT(geo.nPieces()==func.nPieces(),"Function sets must have same number of pieces, but func has "<<func.nPieces()<<" and geo has "<<geo.nPieces());
 
-    const unsigned n = geo.nPieces();
+    const index_t n = geo.nPieces();
     gsParaviewCollection collection(fn);
-    std::string fileName, fileName_nopath;
 
-    for ( unsigned i=0; i < n; ++i )
-    {
-        fileName = fn + pDelim + util::to_string(i);
-        fileName_nopath = gsFileManager::getFilename(fileName);
-        writeSinglePatchField( geo.function(i), func.function(i), true, fileName, npts );
-        collection.addPart(fileName_nopath + ".vts");
-    }
+#   pragma omp parallel for schedule(dynamic)
+    for ( index_t i=0; i < n; ++i )
+        writeSinglePatchField( geo.function(i), func.function(i), true, fn + pDelim + util::to_string(i), npts );
+
+    for ( index_t i=0; i < n; ++i )
+        collection.addPart(gsFileManager::getFilename(fn + pDelim + util::to_string(i)) + ".vts");
     collection.save();
 }
 
@@ -940,42 +1232,37 @@ void gsWriteParaview( std::vector<gsGeometry<T> *> const & Geo,
                       std::string const & fn,
                       unsigned npts, bool mesh, bool ctrlNet, const std::string pDelim)
 {
-    const size_t n = Geo.size();
+    const index_t n = Geo.size();
 
     gsParaviewCollection collection(fn);
-    std::string fnBase, fnBase_nopath;
 
-    for ( size_t i=0; i<n ; i++)
+    // The patches are independent: evaluate and write them in parallel,
+    // then list the files in the collection in order
+#   pragma omp parallel for schedule(dynamic)
+    for ( index_t i=0; i<n ; i++)
     {
-        fnBase = fn + pDelim + util::to_string(i);
-        fnBase_nopath = gsFileManager::getFilename(fnBase);
+        const std::string fnBase = fn + pDelim + util::to_string(i);
 
-        if ( Geo.at(i)->domainDim() == 1 )
-        {
+        if ( Geo[i]->domainDim() == 1 )
             writeSingleCurve(*Geo[i], fnBase, npts);
-            collection.addPart(fnBase_nopath + ".vtp");
-        }
         else
-        {
             writeSingleGeometry( *Geo[i], fnBase, npts ) ;
-            collection.addPart(fnBase_nopath + ".vts");
-        }
 
         if ( mesh )
-        {
-            const std::string fileName = fnBase + "_mesh";
-            const std::string fileName_nopath = gsFileManager::getFilename(fileName);
-            writeSingleCompMesh(Geo[i]->basis(), *Geo[i], fileName);
-            collection.addPart(fileName_nopath + ".vtp");
-        }
+            writeSingleCompMesh(Geo[i]->basis(), *Geo[i], fnBase + "_mesh");
 
         if ( ctrlNet ) // Output the control net
-        {
-            const std::string fileName = fnBase + "_cnet";
-            const std::string fileName_nopath = gsFileManager::getFilename(fileName);
-            writeSingleControlNet(*Geo[i], fileName);
-            collection.addPart(fileName_nopath + ".vtp");
-        }
+            writeSingleControlNet(*Geo[i], fnBase + "_cnet");
+    }
+
+    for ( index_t i=0; i<n ; i++)
+    {
+        const std::string fnBase_nopath = gsFileManager::getFilename(fn + pDelim + util::to_string(i));
+        collection.addPart(fnBase_nopath + ( Geo[i]->domainDim() == 1 ? ".vtp" : ".vts" ));
+        if ( mesh )
+            collection.addPart(fnBase_nopath + "_mesh.vtp");
+        if ( ctrlNet )
+            collection.addPart(fnBase_nopath + "_cnet.vtp");
     }
     collection.save();
 }
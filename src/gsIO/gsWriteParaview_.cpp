@@ -19,6 +19,17 @@ TEMPLATE_INST
 void gsWriteParaview(const gsGeometry<T> & Geo, std::string const & fn, 
                      unsigned npts, bool mesh, bool ctrlNet);
 
+TEMPLATE_INST
+void gsWriteParaviewBezier(const gsGeometry<T> & Geo, std::string const & fn);
+
+TEMPLATE_INST
+void gsWriteParaviewBezier(const gsMultiPatch<T> & mp, std::string const & fn,
+                           const std::string pDelim);
+
+TEMPLATE_INST
+void gsWriteParaviewBezier(const gsField<T> & field, std::string const & fn,
+                           const std::string pDelim);
+
 TEMPLATE_INST
 void gsWriteParaview( std::vector<gsGeometry<T> *> const & Geo, std::string const & fn, 
                       unsigned npts, bool mesh, bool ctrlNet, const std::string pDelim);
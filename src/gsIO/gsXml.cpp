@@ -13,6 +13,7 @@
 
 #include <fstream>
 #include <iomanip>      // std::setprecision
+#include <cctype>
 
 #include <gsCore/gsLinearAlgebra.h>
 #include <gsCore/gsBoxTopology.h>
@@ -312,6 +313,165 @@ void getBoundaries(gsXmlNode * node, std::map<int, int> & ids,
     }
 }
 
+namespace {
+
+// Consumes characters of \a sb until the sequence \a stop has been read
+bool skipPast(std::streambuf * sb, size_t & pos, const std::string & stop)
+{
+    std::string tail;
+    for (int c = sb->sbumpc(); c != EOF; c = sb->sbumpc())
+    {
+        ++pos;
+        tail.push_back( static_cast<char>(c) );
+        if (tail.size() > stop.size())
+            tail.erase(0,1);
+        if (tail == stop)
+            return true;
+    }
+    return false;
+}
+
+// Reads the name and the attributes of a start tag, the leading '<'
+// and the first character \a c of the name are already consumed.
+// Returns 1 for an open tag, 2 for a self-closing tag and 0 on error.
+int readStartTag(std::streambuf * sb, size_t & pos, int c, std::string & name,
+                 std::map<std::string,std::string> & attr)
+{
+    name.clear();
+    attr.clear();
+    for (; c != EOF && !isspace(c) && c != '>' && c != '/'; c = sb->sbumpc(), ++pos)
+        name.push_back( static_cast<char>(c) );
+
+    std::string aname, aval;
+    while (c != EOF)
+    {
+        while (c != EOF && isspace(c)) { c = sb->sbumpc(); ++pos; }
+        if ( c == '>' ) return 1;
+        if ( c == '/' ) { c = sb->sbumpc(); ++pos; return ( c == '>' ? 2 : 0 ); }
+
+        aname.clear();
+        for (; c != EOF && !isspace(c) && c != '='; c = sb->sbumpc(), ++pos)
+            aname.push_back( static_cast<char>(c) );
+        while (c != EOF && c != '=') { c = sb->sbumpc(); ++pos; }
+        do { c = sb->sbumpc(); ++pos; } while (c != EOF && isspace(c));
+        if ( c != '"' && c != '\'' ) return 0;
+        const int quote = c;
+        aval.clear();
+        for (c = sb->sbumpc(), ++pos; c != EOF && c != quote; c = sb->sbumpc(), ++pos)
+            aval.push_back( static_cast<char>(c) );
+        attr[aname] = aval;
+        c = sb->sbumpc(); ++pos;
+    }
+    return 0;
+}
+
+}// anonymous namespace
+
+bool makeXmlIndex(std::istream & is, std::vector<gsXmlIndexEntry> & index)
+{
+    index.clear();
+    std::streambuf * sb = is.rdbuf();
+    std::string name;
+    std::map<std::string,std::string> attr;
+    size_t pos = 0, start = 0;
+    int depth  = 0; // 0: outside <xml>, 1: inside <xml>, >1: inside an object
+    bool hasRoot = false;
+
+    for (int c = sb->sbumpc(); c != EOF; c = sb->sbumpc())
+    {
+        ++pos;
+        if ( c != '<' ) continue;
+        start = pos - 1;
+        c = sb->sbumpc(); ++pos;
+        if ( c == '?' )
+        {
+            if (!skipPast(sb, pos, "?>")) return false;
+        }
+        else if ( c == '!' )
+        {
+            c = sb->sbumpc(); ++pos;
+            if ( c == '-' )
+            { if (!skipPast(sb, pos, "-->")) return false; }
+            else if ( c == '[' )
+            { if (!skipPast(sb, pos, "]]>")) return false; }
+            else if (!skipPast(sb, pos, ">")) return false;
+        }
+        else if ( c == '/' )
+        {
+            if (!skipPast(sb, pos, ">")) return false;
+            if ( --depth == 1 )
+                index.back().end = pos;
+            else if ( 0 == depth )
+                return hasRoot;
+        }
+        else
+        {
+            const int kind = readStartTag(sb, pos, c, name, attr);
+            if ( 0 == kind ) return false;
+            if ( 0 == depth )
+            {
+                if ( name != "xml" ) return false;
+                hasRoot = true;
+                if ( 2 == kind ) return true;
+                depth = 1;
+                continue;
+            }
+            if ( 1 == depth )
+            {
+                gsXmlIndexEntry e;
+                e.tag   = name;
+                e.type  = attr["type"];
+                e.label = attr["label"];
+                e.id    = attr.count("id") ? atoi(attr["id"].c_str()) : -1;
+                e.begin = start;
+                e.end   = pos;
+                index.push_back(e);
+            }
+            if ( 1 == kind ) ++depth;
+        }
+    }
+    return hasRoot && 1 >= depth;
+}
+
+bool readXmlIndex(const std::string & fn, size_t fileSize,
+                  std::vector<gsXmlIndexEntry> & index)
+{
+    index.clear();
+    std::ifstream file(fn.c_str());
+    if ( file.fail() ) return false;
+
+    std::string magic;
+    size_t sz = 0, n = 0;
+    file >> magic >> sz >> n;
+    if ( magic != "gsXmlIndex" || sz != fileSize ) return false;
+
+    index.resize(n);
+    for (size_t i = 0; i!=n; ++i)
+    {
+        gsXmlIndexEntry & e = index[i];
+        file >> e.begin >> e.end >> e.id >> e.tag >> e.type;
+        if ( e.type == "-" ) e.type.clear();
+        file.get(); // separator
+        std::getline(file, e.label);
+        if ( file.fail() ) { index.clear(); return false; }
+    }
+    return true;
+}
+
+bool writeXmlIndex(const std::string & fn, size_t fileSize,
+                   const std::vector<gsXmlIndexEntry> & index)
+{
+    std::ofstream file(fn.c_str());
+    if ( file.fail() ) return false;
+    file << "gsXmlIndex " << fileSize << " " << index.size() << "\n";
+    for (std::vector<gsXmlIndexEntry>::const_iterator it = index.begin();
+         it != index.end(); ++it)
+        file << it->begin << " " << it->end << " " << it->id   << " "
+             << it->tag   << " " << (it->type.empty() ? "-" : it->type)
+             << " " << it->label << "\n";
+    return !file.fail();
+}
+
 }// end namespace internal
 
 }// end namespace gismo
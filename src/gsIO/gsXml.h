@@ -371,6 +371,35 @@ GISMO_EXPORT void appendBoxTopology(const gsBoxTopology& topology,
                                     gsXmlNode* node,
                                     gsXmlTree& data);
 
+/// Entry of the index of the top-level objects of a G+Smo XML file
+/// (children of the root tag <xml>), see gsFileData::readIndexed
+struct gsXmlIndexEntry
+{
+    std::string tag;   ///< Tag of the object, eg. "Geometry"
+    std::string type;  ///< Value of the "type" attribute (or empty)
+    std::string label; ///< Value of the "label" attribute (or empty)
+    int         id;    ///< Value of the "id" attribute (or -1)
+    size_t      begin; ///< Offset of the first character of the object in the file
+    size_t      end;   ///< Offset past the last character of the object in the file
+};
+
+/// Helper which scans the XML stream \a is once (without building a
+/// DOM tree) and collects the tag, type, id, label and byte range of
+/// every child of the root tag <xml> into \a index.
+/// Returns false if no valid root tag was found.
+GISMO_EXPORT bool makeXmlIndex(std::istream & is,
+                               std::vector<gsXmlIndexEntry> & index);
+
+/// Helper to read an index sidecar file written by writeXmlIndex.
+/// Returns false if the file does not exist or if it was created for
+/// an XML file of size different than \a fileSize.
+GISMO_EXPORT bool readXmlIndex(const std::string & fn, size_t fileSize,
+                               std::vector<gsXmlIndexEntry> & index);
+
+/// Helper to write an index sidecar file for an XML file of size \a fileSize
+GISMO_EXPORT bool writeXmlIndex(const std::string & fn, size_t fileSize,
+                                const std::vector<gsXmlIndexEntry> & index);
+
 /// Helper to allocate XML node with gsMatrix value
 template<class T>
 gsXmlNode * makeNode( const std::string & name,
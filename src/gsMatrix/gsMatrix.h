@@ -642,10 +642,18 @@ gsMatrix<T,_Rows, _Cols, _Options> * gsMatrix<T,_Rows, _Cols, _Options>::clone()
     // Constructors
     .def(py::init<>())
     .def(py::init<index_t, index_t>())
+    .def(py::init<const Class &>()) // copy of a NumPy array
     // Member functions
     .def("size",       &Class::size)
     .def("rows",       &Class::rows)
     .def("cols",       &Class::cols)
+    // Zero-copy view for NumPy, e.g. numpy.asarray(m)
+    .def_buffer([](Class & m) -> py::buffer_info
+    {
+        return py::buffer_info(m.data(), sizeof(T), py::format_descriptor<T>::format(), 2,
+                               { static_cast<py::ssize_t>(m.rows()), static_cast<py::ssize_t>(m.cols()) },
+                               { static_cast<py::ssize_t>(sizeof(T)), static_cast<py::ssize_t>(sizeof(T) * m.rows()) });
+    })
     // .def("transpose",  &Class::transpose)
     ;
   }
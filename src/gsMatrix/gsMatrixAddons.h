@@ -74,7 +74,7 @@ inline Matrix<Scalar, Dynamic, Dynamic> cramerInverse() const
             break;
         default:
             gsWarn<<"Inversion by LU for matrix of size "<<M.rows()<<"\n";
-            M.inverse();
+            rvo1 = M.inverse();
             break;
     };
     return rvo1;
@@ -335,9 +335,17 @@ gsVector3d<T>::gsVector3d(const Base& a): Base(a) { }
     // Constructors
     .def(py::init<>())
     .def(py::init<index_t, index_t>())
+    .def(py::init<const Class &>()) // copy of a NumPy array
     // Member functions
     .def("size",       &Class::size)
     .def("rows",       &Class::rows)
+    // Zero-copy view for NumPy, e.g. numpy.asarray(v)
+    .def_buffer([](Class & v) -> py::buffer_info
+    {
+        return py::buffer_info(v.data(), sizeof(T), py::format_descriptor<T>::format(), 1,
+                               { static_cast<py::ssize_t>(v.rows()) },
+                               { static_cast<py::ssize_t>(sizeof(T)) });
+    })
     // .def("transpose",  &Class::transpose)
     ;
   }
@@ -24,6 +24,12 @@ bool GISMO_EXPORT read_obj(gsSurfMesh& mesh, const std::string& filename);
 bool GISMO_EXPORT read_poly(gsSurfMesh& mesh, const std::string& filename);
 bool GISMO_EXPORT read_stl(gsSurfMesh& mesh, const std::string& filename);
 
+// Readers based on stdio, kept for comparison with the memory-mapped
+// readers above
+bool GISMO_EXPORT read_off_stdio(gsSurfMesh& mesh, const std::string& filename);
+bool GISMO_EXPORT read_obj_stdio(gsSurfMesh& mesh, const std::string& filename);
+bool GISMO_EXPORT read_stl_stdio(gsSurfMesh& mesh, const std::string& filename);
+
 bool GISMO_EXPORT write_mesh(const gsSurfMesh& mesh, const std::string& filename);
 bool GISMO_EXPORT write_off(const gsSurfMesh& mesh, const std::string& filename);
 bool GISMO_EXPORT write_obj(const gsSurfMesh& mesh, const std::string& filename);
@@ -0,0 +1,80 @@
+/** @file IO_mmap.cpp
+
+    @brief Read-only memory mapping of files, used by the mesh readers
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#include <gsMesh2/IO_mmap.h>
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GISMO_MMAP_AVAILABLE
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+namespace gismo {
+
+
+gsMappedFile::gsMappedFile(const std::string & filename)
+: m_data(0), m_size(0), m_ok(false), m_mapped(false)
+{
+#ifdef GISMO_MMAP_AVAILABLE
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return;
+
+    struct stat st;
+    if (0 == ::fstat(fd, &st))
+    {
+        m_size = static_cast<size_t>(st.st_size);
+        if (0 == m_size)
+            m_ok = true;
+        else
+        {
+            void * addr = ::mmap(0, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != addr)
+            {
+                ::madvise(addr, m_size, MADV_SEQUENTIAL);
+                m_data   = static_cast<const char*>(addr);
+                m_mapped = true;
+                m_ok     = true;
+            }
+        }
+    }
+    ::close(fd);
+    if (m_ok) return;
+    m_size = 0;
+#endif
+
+    // fall back to reading the whole file
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if (in.fail()) return;
+    m_buffer.assign(std::istreambuf_iterator<char>(in.rdbuf()),
+                    std::istreambuf_iterator<char>());
+    m_size = m_buffer.size();
+    m_data = m_size ? &m_buffer[0] : 0;
+    m_ok   = true;
+}
+
+
+gsMappedFile::~gsMappedFile()
+{
+#ifdef GISMO_MMAP_AVAILABLE
+    if (m_mapped)
+        ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+
+} // namespace gismo
@@ -0,0 +1,72 @@
+/** @file IO_mmap.h
+
+    @brief Read-only memory mapping of files, used by the mesh readers
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#pragma once
+
+#include <gsCore/gsExport.h>
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace gismo {
+
+/// \brief Read-only view of the contents of a file.
+///
+/// On POSIX systems the file is memory-mapped, so that the pages are
+/// loaded on demand by the operating system and no copy is made.
+/// Elsewhere the file is read into a buffer.
+class GISMO_EXPORT gsMappedFile
+{
+public:
+
+    explicit gsMappedFile(const std::string & filename);
+
+    ~gsMappedFile();
+
+    /// Returns true if the file could be opened
+    bool is_open() const { return m_ok; }
+
+    /// Pointer to the first byte of the file
+    const char * data() const { return m_data; }
+
+    /// Size of the file in bytes
+    size_t size() const { return m_size; }
+
+    /// Pointer past the last byte of the file
+    const char * end() const { return m_data + m_size; }
+
+private:
+    gsMappedFile(const gsMappedFile &);
+    gsMappedFile & operator=(const gsMappedFile &);
+
+private:
+    const char *      m_data;
+    size_t            m_size;
+    bool              m_ok;
+    bool              m_mapped;
+    std::vector<char> m_buffer; // used if mapping is not available
+};
+
+/// Copies the line starting at \a p into \a line (without the line
+/// break) and returns the beginning of the next line
+inline const char * get_line(const char * p, const char * end, std::string & line)
+{
+    const char * e = static_cast<const char*>(memchr(p, '\n', end - p));
+    if (!e) e = end;
+    line.assign(p, e);
+    if (!line.empty() && '\r' == line[line.size()-1])
+        line.resize(line.size()-1);
+    return e == end ? end : e + 1;
+}
+
+} // namespace gismo
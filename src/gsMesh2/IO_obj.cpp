@@ -1,5 +1,6 @@
 
 #include <gsMesh2/IO.h>
+#include <gsMesh2/IO_mmap.h>
 
 #include <cstdio>
 
@@ -13,61 +14,49 @@ namespace gismo {
 //== IMPLEMENTATION ===========================================================
 
 
-bool read_obj(gsSurfMesh& mesh, const std::string& filename)
+// helper class which parses the lines of an OBJ file into a mesh
+class ObjParser
 {
-    char   s[200];
-    float  x, y, z;
-    std::vector<gsSurfMesh::Vertex>  vertices;
-    std::vector<Texture_coordinate> all_tex_coords;   //individual texture coordinates
-    std::vector<int> halfedge_tex_idx; //texture coordinates sorted for halfedges
-    gsSurfMesh::Halfedge_property <Texture_coordinate> tex_coords = mesh.halfedge_property<Texture_coordinate>("h:texcoord", Texture_coordinate(0,0,0));
-    bool with_tex_coord=false;
-
-    // clear mesh
-    mesh.clear();
-
-
-    // open file (in ASCII mode)
-    FILE* in = fopen(filename.c_str(), "r");
-    if (!in) return false;
-
-
-    // clear line once
-    memset(&s, 0, 200);
+public:
 
+    explicit ObjParser(gsSurfMesh& mesh)
+    : mesh_(mesh), with_tex_coord(false)
+    {
+        tex_coords = mesh.halfedge_property<Texture_coordinate>("h:texcoord", Texture_coordinate(0,0,0));
+    }
 
-    // parse line by line (currently only supports vertex positions & faces
-    while(in && !feof(in) && fgets(s, 200, in))
+    // parses one (null-terminated) line, the line is modified
+    void parse(char * s)
     {
+        char * e;
+
         // comment
-        if (s[0] == '#' || isspace(s[0])) continue;
+        if (s[0] == '#' || isspace(s[0])) return;
 
         // vertex
         else if (strncmp(s, "v ", 2) == 0)
         {
-            if (sscanf(s, "v %f %f %f", &x, &y, &z))
-            {
-                mesh.add_vertex(Point(x,y,z));
-            }
+            Point p;
+            s += 2;
+            for (int j = 0; j < 3; ++j, s = e)
+                p[j] = static_cast<Point::Scalar>( strtod(s, &e) );
+            mesh_.add_vertex(p);
         }
         // normal
         else if (strncmp(s, "vn ", 3) == 0)
         {
-          if (sscanf(s, "vn %f %f %f", &x, &y, &z))
-          {
             // problematic as it can be either a vertex property when interpolated
             // or a halfedge property for hard edges
-          }
         }
 
         // texture coordinate
         else if (strncmp(s, "vt ", 3) == 0)
         {
-          if (sscanf(s, "vt %f %f", &x, &y))
-          {
-            z=1;
-            all_tex_coords.push_back(Texture_coordinate(x,y,z));
-          }
+            Texture_coordinate t(0,0,1);
+            s += 3;
+            for (int j = 0; j < 2; ++j, s = e)
+                t[j] = static_cast<Point::Scalar>( strtod(s, &e) );
+            all_tex_coords.push_back(t);
         }
 
         // face
@@ -143,13 +132,13 @@ bool read_obj(gsSurfMesh& mesh, const std::string& filename)
             }
           }
 
-          gsSurfMesh::Face f=mesh.add_face(vertices);
+          gsSurfMesh::Face f=mesh_.add_face(vertices);
 
 
           // add texture coordinates
           if(with_tex_coord)
           {
-              gsSurfMesh::Halfedge_around_face_circulator h_fit = mesh.halfedges(f);
+              gsSurfMesh::Halfedge_around_face_circulator h_fit = mesh_.halfedges(f);
               gsSurfMesh::Halfedge_around_face_circulator h_end = h_fit;
               unsigned v_idx =0;
               do
@@ -161,6 +150,44 @@ bool read_obj(gsSurfMesh& mesh, const std::string& filename)
               while(h_fit!=h_end);
           }
         }
+    }
+
+private:
+    gsSurfMesh & mesh_;
+    std::vector<gsSurfMesh::Vertex>  vertices;
+    std::vector<Texture_coordinate> all_tex_coords;   //individual texture coordinates
+    std::vector<int> halfedge_tex_idx; //texture coordinates sorted for halfedges
+    gsSurfMesh::Halfedge_property <Texture_coordinate> tex_coords;
+    bool with_tex_coord;
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+bool read_obj_stdio(gsSurfMesh& mesh, const std::string& filename)
+{
+    char   s[200];
+    ObjParser parser(mesh);
+
+    // clear mesh
+    mesh.clear();
+
+
+    // open file (in ASCII mode)
+    FILE* in = fopen(filename.c_str(), "r");
+    if (!in) return false;
+
+
+    // clear line once
+    memset(&s, 0, 200);
+
+
+    // parse line by line (currently only supports vertex positions & faces
+    while(in && !feof(in) && fgets(s, 200, in))
+    {
+        parser.parse(s);
+
         // clear line
         memset(&s, 0, 200);
     }
@@ -173,6 +200,47 @@ bool read_obj(gsSurfMesh& mesh, const std::string& filename)
 //-----------------------------------------------------------------------------
 
 
+bool read_obj(gsSurfMesh& mesh, const std::string& filename)
+{
+    ObjParser parser(mesh);
+
+    // clear mesh
+    mesh.clear();
+
+    gsMappedFile in(filename);
+    if (!in.is_open()) return false;
+
+    // count vertices and faces to reserve the storage up front
+    unsigned nV = 0, nF = 0;
+    for (const char * p = in.data(); p < in.end(); )
+    {
+        if (in.end() - p > 1 && p[1] == ' ')
+        {
+            if      (p[0] == 'v') ++nV;
+            else if (p[0] == 'f') ++nF;
+        }
+        p = static_cast<const char*>(memchr(p, '\n', in.end() - p));
+        if (!p) break;
+        ++p;
+    }
+    mesh.reserve(nV, nV + nF, nF);
+
+    // parse line by line (currently only supports vertex positions & faces
+    std::string line;
+    for (const char * p = in.data(); p != in.end(); )
+    {
+        p = get_line(p, in.end(), line);
+        if (line.empty()) continue;
+        parser.parse(&line[0]);
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 bool write_obj(const gsSurfMesh& mesh, const std::string& filename)
 {
     FILE* out = fopen(filename.c_str(), "w");
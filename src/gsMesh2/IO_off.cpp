@@ -1,5 +1,6 @@
 
 #include <gsMesh2/IO.h>
+#include <gsMesh2/IO_mmap.h>
 
 #include <cstdio>
 
@@ -173,6 +174,7 @@ bool read_off_ascii(gsSurfMesh& mesh,
 //    fs.getline(in, sizeof buffer );
 
     char                 line[200], *lp;
+    float                fb[3];
     int                  nc;
     unsigned int         i, j, items, idx;
     unsigned int         nV, nF, nE;
@@ -204,16 +206,18 @@ bool read_off_ascii(gsSurfMesh& mesh,
         lp = line;
 
         // position
-        items = sscanf(lp, "%f %f %f%n", (float*)&p[0], (float*)&p[1], (float*)&p[2], &nc);
+        items = sscanf(lp, "%f %f %f%n", fb, fb+1, fb+2, &nc);
         assert(items==3);
+        p << fb[0], fb[1], fb[2];
         v = mesh.add_vertex(p.cast<gsSurfMesh::Scalar>());
         lp += nc;
 
         // normal
         if (has_normals)
         {
-            if (sscanf(lp, "%f %f %f%n", (float*)&n[0], (float*)&n[1], (float*)&n[2], &nc) == 3)
+            if (sscanf(lp, "%f %f %f%n", fb, fb+1, fb+2, &nc) == 3)
             {
+                n << fb[0], fb[1], fb[2];
                 normals[v] = n;
             }
             lp += nc;
@@ -222,8 +226,9 @@ bool read_off_ascii(gsSurfMesh& mesh,
         // color
         if (has_colors)
         {
-            if (sscanf(lp, "%f %f %f%n", (float*)&c[0], (float*)&c[1], (float*)&c[2], &nc) == 3)
+            if (sscanf(lp, "%f %f %f%n", fb, fb+1, fb+2, &nc) == 3)
             {
+                c << fb[0], fb[1], fb[2];
                 if (c[0]>1.0f || c[1]>1.0f || c[2]>1.0f) c *= (1.0/255.0);
                 colors[v] = c;
             }
@@ -354,7 +359,7 @@ bool read_off_binary(gsSurfMesh& mesh,
 //-----------------------------------------------------------------------------
 
 
-bool read_off(gsSurfMesh& mesh, const std::string& filename)
+bool read_off_stdio(gsSurfMesh& mesh, const std::string& filename)
 {
     char  line[200];
     bool  has_texcoords = false;
@@ -415,6 +420,110 @@ bool read_off(gsSurfMesh& mesh, const std::string& filename)
 //-----------------------------------------------------------------------------
 
 
+// returns the next line which is neither empty nor a comment
+inline const char * off_next_line(const char * p, const char * end, std::string & line)
+{
+    while (p != end)
+    {
+        p = get_line(p, end, line);
+        const size_t s = line.find_first_not_of(" \t");
+        if (s != std::string::npos && line[s] != '#') break;
+        line.clear();
+    }
+    return p;
+}
+
+
+bool read_off(gsSurfMesh& mesh, const std::string& filename)
+{
+    bool  has_texcoords = false;
+    bool  has_normals   = false;
+    bool  has_colors    = false;
+
+    gsMappedFile in(filename);
+    if (!in.is_open()) return false;
+
+    std::string line;
+    const char * p = off_next_line(in.data(), in.end(), line);
+
+    // read header: [ST][C][N][4][n]OFF BINARY
+    const char * c = line.c_str();
+    if (c[0] == 'S' && c[1] == 'T') { has_texcoords = true; c += 2; }
+    if (c[0] == 'C') { has_colors  = true; ++c; }
+    if (c[0] == 'N') { has_normals = true; ++c; }
+    if (c[0] == '4' || c[0] == 'n') return false; // not supported
+    if (strncmp(c, "OFF", 3) != 0) return false; // no OFF
+    if (strncmp(c+3, " BINARY", 7) == 0)
+        return read_off_stdio(mesh, filename);
+
+    // properties
+    gsSurfMesh::Vertex_property<Normal>              normals;
+    gsSurfMesh::Vertex_property<Texture_coordinate>  texcoords;
+    gsSurfMesh::Vertex_property<Color>               colors;
+    if (has_normals)   normals   = mesh.vertex_property<Normal>("v:normal",Point(0,0,0));
+    if (has_texcoords) texcoords = mesh.vertex_property<Texture_coordinate>("v:texcoord",Point(0,0,0));
+    if (has_colors)    colors    = mesh.vertex_property<Color>("v:color",Color(0,0,0));
+
+    // #Vertice, #Faces, #Edges
+    char * e;
+    p = off_next_line(p, in.end(), line);
+    const unsigned nV = strtoul(line.c_str(), &e, 10);
+    const unsigned nF = strtoul(e, &e, 10);
+    const unsigned nE = strtoul(e, &e, 10);
+    mesh.clear();
+    mesh.reserve(nV, std::max(3*nV, nE), nF);
+
+    // read vertices: pos [normal] [color] [texcoord]
+    Point q;
+    for (unsigned i=0; i<nV; ++i)
+    {
+        if (p == in.end()) return false;
+        p = off_next_line(p, in.end(), line);
+        e = &line[0];
+
+        for (int j=0; j<3; ++j) q[j] = strtod(e, &e);
+        gsSurfMesh::Vertex v = mesh.add_vertex(q);
+
+        if (has_normals)
+        {
+            for (int j=0; j<3; ++j) q[j] = strtod(e, &e);
+            normals[v] = q;
+        }
+
+        if (has_colors)
+        {
+            for (int j=0; j<3; ++j) q[j] = strtod(e, &e);
+            if (q[0]>1 || q[1]>1 || q[2]>1) q *= (1.0/255.0);
+            colors[v] = q;
+        }
+
+        if (has_texcoords)
+        {
+            texcoords[v][0] = strtod(e, &e);
+            texcoords[v][1] = strtod(e, &e);
+        }
+    }
+
+    // read faces: #N v[1] v[2] ... v[n-1]
+    std::vector<gsSurfMesh::Vertex> vertices;
+    for (unsigned i=0; i<nF; ++i)
+    {
+        if (p == in.end()) return false;
+        p = off_next_line(p, in.end(), line);
+        const unsigned n = strtoul(line.c_str(), &e, 10);
+        vertices.resize(n);
+        for (unsigned j=0; j<n; ++j)
+            vertices[j] = gsSurfMesh::Vertex( strtoul(e, &e, 10) );
+        mesh.add_face(vertices);
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 bool write_off(const gsSurfMesh& mesh, const std::string& filename)
 {
     FILE* out = fopen(filename.c_str(), "w");
@@ -2,11 +2,14 @@
 //== INCLUDES =================================================================
 
 #include <gsMesh2/IO.h>
+#include <gsMesh2/IO_mmap.h>
 
 #include <cstdio>
 #include <cfloat>
 #include <map>
 #include <fstream>
+#include <unordered_map>
+#include <gsParallel/gsOpenMP.h>
 
 
 //== NAMESPACES ===============================================================
@@ -38,7 +41,8 @@ public:
 
     CmpVec(float _eps=FLT_MIN) : eps_(_eps) {}
 
-    bool operator()(const Point& v0, const Point& v1) const
+    template<class Vec>
+    bool operator()(const Vec& v0, const Vec& v1) const
     {
         if (fabs(v0[0] - v1[0]) <= eps_)
         {
@@ -59,19 +63,20 @@ private:
 //-----------------------------------------------------------------------------
 
 
-bool read_stl(gsSurfMesh& mesh, const std::string& filename)
+bool read_stl_stdio(gsSurfMesh& mesh, const std::string& filename)
 {
+    typedef gsEigen::Vector<float,3> Vec3f; // STL coordinates are single precision
     char                             line[100], *c;
     unsigned int                     i, nT;
-    Point                            p;
+    Vec3f                            p;
     gsSurfMesh::Vertex               v;
     std::vector<gsSurfMesh::Vertex>  vertices(3);
     size_t n_items(0);
     (void)n_items;
     
     CmpVec comp(FLT_MIN);
-    std::map<Point, gsSurfMesh::Vertex, CmpVec>            vMap(comp);
-    std::map<Point, gsSurfMesh::Vertex, CmpVec>::iterator  vMapIt;
+    std::map<Vec3f, gsSurfMesh::Vertex, CmpVec>            vMap(comp);
+    std::map<Vec3f, gsSurfMesh::Vertex, CmpVec>::iterator  vMapIt;
 
 
     // clear mesh
@@ -168,7 +173,7 @@ bool read_stl(gsSurfMesh& mesh, const std::string& filename)
                     for (c=line; isspace(*c) && *c!='\0'; ++c) {};
 
                     // read x, y, z
-                    sscanf(c+6, "%f %f %f", (float*)&p[0], (float*)&p[1], (float*)&p[2]);
+                    sscanf(c+6, "%f %f %f", &p[0], &p[1], &p[2]);
 
                     // has vector been referenced before?
                     if ((vMapIt=vMap.find(p)) == vMap.end())
@@ -203,6 +208,162 @@ bool read_stl(gsSurfMesh& mesh, const std::string& filename)
 //-----------------------------------------------------------------------------
 
 
+// helper class for the hashed vertex welding: a point is identified by
+// the bit patterns of its (single precision) coordinates
+struct StlKey
+{
+    uint32_t c[3];
+    bool operator==(const StlKey & o) const
+    { return c[0]==o.c[0] && c[1]==o.c[1] && c[2]==o.c[2]; }
+};
+
+struct StlKeyHash
+{
+    size_t operator()(const StlKey & k) const
+    {
+        uint64_t h = k.c[0];
+        h = h * 0x9E3779B97F4A7C15ULL ^ k.c[1];
+        h = h * 0x9E3779B97F4A7C15ULL ^ k.c[2];
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+};
+
+inline StlKey stl_key(const float * p)
+{
+    StlKey k;
+    for (int j=0; j<3; ++j)
+    {
+        const float x = (p[j] == 0.0f ? 0.0f : p[j]); // -0 equals +0
+        memcpy(&k.c[j], &x, sizeof(float));
+    }
+    return k;
+}
+
+
+// Welds coinciding corners. \a pts holds the corners as consecutive
+// coordinate triples. On output, \a idx holds the vertex index of
+// every corner and \a first holds the first corner of every vertex,
+// the vertices are numbered in order of appearance. The corners are
+// distributed over the threads by their hash value, therefore the
+// result does not depend on the number of threads.
+void stl_weld(const std::vector<float> & pts, std::vector<unsigned> & idx,
+              std::vector<size_t> & first)
+{
+    const size_t n = pts.size() / 3;
+    std::vector<size_t> hash(n), rep(n);
+
+#pragma omp parallel
+    {
+        const size_t tid = omp_get_thread_num();
+        const size_t nt  = omp_get_num_threads();
+        StlKeyHash hasher;
+
+#       pragma omp for
+        for (size_t i = 0; i < n; ++i)
+            hash[i] = hasher( stl_key(&pts[3*i]) );
+
+        // each thread welds the corners of its spatial bucket
+        std::unordered_map<StlKey, size_t, StlKeyHash> seen;
+        seen.reserve( n / (2*nt) + 1 );
+        for (size_t i = 0; i < n; ++i)
+            if ( hash[i] % nt == tid )
+                rep[i] = seen.insert( std::make_pair(stl_key(&pts[3*i]), i) ).first->second;
+    }
+
+    idx.resize(n);
+    first.clear();
+    first.reserve(n / 5);
+    for (size_t i = 0; i < n; ++i)
+    {
+        if ( rep[i] == i )
+        {
+            idx[i] = static_cast<unsigned>(first.size());
+            first.push_back(i);
+        }
+        else
+            idx[i] = idx[rep[i]];
+    }
+}
+
+
+bool read_stl(gsSurfMesh& mesh, const std::string& filename)
+{
+    mesh.clear();
+
+    gsMappedFile in(filename);
+    if (!in.is_open()) return false;
+
+    const char * data = in.data();
+    const size_t size = in.size();
+    std::vector<float> pts; // triangle corners
+
+    // ASCII or binary STL? Note that some binary files also start with "solid"
+    uint32_t nT = 0;
+    if (size >= 84) memcpy(&nT, data + 80, sizeof(uint32_t));
+    const bool binary = (size >= 84 && size == 84 + 50 * static_cast<size_t>(nT)) ||
+        ( (size < 5 || (strncmp(data, "SOLID", 5) != 0 &&
+                        strncmp(data, "solid", 5) != 0)) );
+
+    if (binary)
+    {
+        if (size < 84 || size < 84 + 50 * static_cast<size_t>(nT)) return false;
+        pts.resize(9 * static_cast<size_t>(nT));
+        // record: normal (12 bytes), 3 corners (36 bytes), attribute (2 bytes)
+#       pragma omp parallel for
+        for (index_t t = 0; t < static_cast<index_t>(nT); ++t)
+            memcpy(&pts[9*t], data + 84 + 50 * static_cast<size_t>(t) + 12, 9 * sizeof(float));
+    }
+    else
+    {
+        pts.reserve(size / 20);
+        std::string line;
+        const char * c;
+        char * e;
+        for (const char * p = data; p != in.end(); )
+        {
+            p = get_line(p, in.end(), line);
+            for (c = line.c_str(); isspace(*c); ++c) {};
+            if (strncmp(c, "vertex", 6) != 0 && strncmp(c, "VERTEX", 6) != 0)
+                continue;
+            c += 6;
+            for (int j = 0; j < 3; ++j, c = e)
+                pts.push_back( strtof(c, &e) );
+        }
+        if (pts.size() % 9 != 0) return false;
+    }
+
+    // hashed vertex welding
+    std::vector<unsigned> idx;
+    std::vector<size_t>   first;
+    stl_weld(pts, idx, first);
+
+    const size_t nF = pts.size() / 9;
+    const size_t nV = first.size();
+    mesh.reserve(nV, nV + nF, nF);
+
+    for (size_t i = 0; i < nV; ++i)
+    {
+        const float * q = &pts[3*first[i]];
+        mesh.add_vertex( Point(q[0], q[1], q[2]) );
+    }
+
+    for (size_t f = 0; f < nF; ++f)
+    {
+        const unsigned * v = &idx[3*f];
+        // Add face only if it is not degenerated
+        if (v[0] != v[1] && v[0] != v[2] && v[1] != v[2])
+            mesh.add_triangle(gsSurfMesh::Vertex(v[0]),
+                              gsSurfMesh::Vertex(v[1]),
+                              gsSurfMesh::Vertex(v[2]));
+    }
+
+    return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 bool write_stl(const gsSurfMesh& mesh, const std::string& filename)
 {
     if (!mesh.is_triangle_mesh())
@@ -159,6 +159,15 @@ private:
     /// Extends the system of equations by taking constraints into account.
     void extendSystem(gsSparseMatrix<T>& A_mat, gsMatrix<T>& m_B);
 
+protected:
+
+    /// Adds the smoothing term and the constraints to the system
+    /// A_mat * x = m_B assembled by assembleSystem(), solves it and
+    /// stores the result. If \a guess contains one row per basis
+    /// function, the iterative solver starts from it.
+    void solveSystem(gsSparseMatrix<T> & A_mat, gsMatrix<T> & m_B, T lambda,
+                     const gsMatrix<T> & guess = gsMatrix<T>());
+
 protected:
 
     //gsOptionList
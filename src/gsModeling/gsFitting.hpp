@@ -99,6 +99,15 @@ void gsFitting<T>::compute(T lambda)
     assembleSystem(A_mat, m_B);
 
 
+    solveSystem(A_mat, m_B, lambda);
+}
+
+template<class T>
+void gsFitting<T>::solveSystem(gsSparseMatrix<T> & A_mat, gsMatrix<T> & m_B,
+                               T lambda, const gsMatrix<T> & guess)
+{
+    const int num_basis = m_basis->size();
+
     // --- Smoothing matrix computation
     //test degree >=3
     if(lambda > 0)
@@ -124,7 +133,16 @@ void gsFitting<T>::compute(T lambda)
     // Solves for many right hand side  columns
     gsMatrix<T> x;
 
-    x = solver.solve(m_B); //toDense()
+    if ( guess.rows() == num_basis )
+    {
+        // Start from the given coefficients; the multipliers of the
+        // constraints start from zero
+        gsMatrix<T> x0 = gsMatrix<T>::Zero(m_B.rows(), m_B.cols());
+        x0.topRows(num_basis) = guess;
+        x = solver.solveWithGuess(m_B, x0);
+    }
+    else
+        x = solver.solve(m_B); //toDense()
 
     // If there were constraints, we obtained too many coefficients.
     x.conservativeResize(num_basis, gsEigen::NoChange);
@@ -222,37 +240,67 @@ void gsFitting<T>::assembleSystem(gsSparseMatrix<T>& A_mat,
 {
     const int num_patches ( m_basis->nPieces() ); //initialize
 
-    //for computing the value of the basis function
-    gsMatrix<T> value, curr_point;
-    gsMatrix<index_t> actives;    
-
+    // The points are processed in chunks; the basis functions are
+    // evaluated at all points of a chunk at once
+    const index_t chunkSize = 256;
+    std::vector<std::pair<index_t,index_t> > chunks; // (patch, first point)
     for (index_t h = 0; h < num_patches; h++ )
+        for (index_t k = m_offset[h]; k < m_offset[h+1]; k += chunkSize)
+            chunks.push_back( std::make_pair(h, k) );
+
+    index_t nonZerosPerCol = 1;
+    for (short_t i = 0; i < m_basis->domainDim(); ++i)
+        nonZerosPerCol *= 2 * m_basis->basis(0).degree(i) + 1;
+
+#   pragma omp parallel
     {
-        auto & basis = m_basis->basis(h);
+        //for computing the value of the basis function
+        gsMatrix<T> value, curr_points;
+        gsMatrix<index_t> actives;
+
+        // Every thread accumulates its contributions separately
+        gsSparseMatrix<T> A_loc(A_mat.rows(), A_mat.cols());
+        A_loc.reservePerColumn( nonZerosPerCol );
+        gsMatrix<T> B_loc = gsMatrix<T>::Zero(m_B.rows(), m_B.cols());
 
-//#   pragma omp parallel for default(shared) private(curr_point,actives,value)
-        for (index_t k = m_offset[h]; k < m_offset[h+1]; ++k)
+#       pragma omp for schedule(dynamic) nowait
+        for (index_t c = 0; c < (index_t)chunks.size(); ++c)
         {
-            curr_point = m_param_values.col(k);
+            const index_t h = chunks[c].first;
+            const index_t k0 = chunks[c].second;
+            const index_t np = math::min(chunkSize, m_offset[h+1] - k0);
+            auto & basis = m_basis->basis(h);
+            curr_points = m_param_values.middleCols(k0, np);
 
-            //computing the values of the basis functions at the current point
-            basis.eval_into(curr_point, value);
+            //computing the values of the basis functions at the current points
+            basis.eval_into(curr_points, value);
 
             // which functions have been computed i.e. which are active
-            basis.active_into(curr_point, actives);
+            basis.active_into(curr_points, actives);
 
-            const index_t numActive = actives.rows();
-
-            for (index_t i = 0; i != numActive; ++i)
+            for (index_t p = 0; p != np; ++p)
             {
-                const index_t ii = actives.at(i);
-//#           pragma omp critical (acc_m_B)
-                m_B.row(ii) += value.at(i) * m_points.row(k);
-                for (index_t j = 0; j != numActive; ++j)
-//#               pragma omp critical (acc_A_mat)
-                    A_mat(ii, actives.at(j)) += value.at(i) * value.at(j);
+                const index_t k = k0 + p;
+                for (index_t i = 0; i != actives.rows(); ++i)
+                {
+                    // Inactive entries (padding) have zero value
+                    if (0 == value(i,p)) continue;
+                    const index_t ii = actives(i,p);
+                    B_loc.row(ii) += value(i,p) * m_points.row(k);
+                    for (index_t j = 0; j != actives.rows(); ++j)
+                        if (0 != value(j,p))
+                            A_loc.coeffRef(ii, actives(j,p)) += value(i,p) * value(j,p);
+                }
             }
         }
+
+#       pragma omp critical (acc_A_mat)
+        {
+            m_B += B_loc;
+            for (index_t k=0; k<A_loc.outerSize(); ++k)
+                for (typename gsSparseMatrix<T>::InnerIterator it(A_loc,k); it; ++it)
+                    A_mat.coeffRef(it.row(), it.col()) += it.value();
+        }
     }
 }
 
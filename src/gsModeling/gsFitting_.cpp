@@ -22,10 +22,10 @@ void pybind11_init_gsFitting(py::module &m)
     .def( py::init<gsMatrix<real_t> const &, gsMatrix<real_t> const &, gsBasis<real_t>&>() )
 
     // Member functions
-    .def("compute", &Class::compute, "Computes the least square fit for a gsBasis.")
+    .def("compute", &Class::compute, py::call_guard<py::gil_scoped_release>(), "Computes the least square fit for a gsBasis.")
     .def("applySmoothing", &Class::applySmoothing, "apply smoothing to the input matrix.")
     .def("smoothingMatrix", &Class::smoothingMatrix, "get the amoothing matrix.")
-    .def("parameterCorrection", &Class::parameterCorrection, "Apply parameter correction steps.")
+    .def("parameterCorrection", &Class::parameterCorrection, py::call_guard<py::gil_scoped_release>(), "Apply parameter correction steps.")
     ;
 }
 #endif
@@ -222,6 +222,9 @@ protected:
     {
 
     public:
+        /// Empty local parametrization, to be assigned
+        LocalParametrization() : m_vertexIndex(0) { }
+
         /**
          * @brief Constructor
          * Using this constructor one needs to input mesh information, a local neighbourhood and a parametrization method.
@@ -243,7 +246,7 @@ protected:
          *
          * @return lambdas
          */
-        const std::vector<T> &getLambdas() const;
+        const gsSparseVector<T> &getLambdas() const;
 
     private:
         /**
@@ -256,7 +259,7 @@ protected:
         void calculateLambdas(const size_t N, VectorType& points);
 
         size_t m_vertexIndex; ///< vertex index
-        std::vector<T> m_lambdas; ///< lambdas
+        gsSparseVector<T> m_lambdas; ///< lambdas, only the neighbours are non-zero
 
     };
 
@@ -306,11 +309,12 @@ protected:
         /**
          * @brief Get vector of lambdas
          *
-         * This method returns a vector that stores the lambdas.
+         * This method returns a sparse vector that stores the lambdas of
+         * the i-th inner vertex, indexed by vertex index - 1.
          *
          * @return vector of lambdas
          */
-        const std::vector<T> &getLambdas(const size_t i) const;
+        const gsSparseVector<T> &getLambdas(const size_t i) const;
 
         /**
          * @brief Get boundary corners depending on the method
@@ -361,6 +365,8 @@ protected:
     *  a(i,i) = 1
     *  a(i,j) = -lambda(i,j) for j!=i
     * and the right hand side is calculated using the boundary parameters found beforehand. The parameter values are multiplied with corresponding lambda values and summed up.
+    * The matrix is sparse with about seven entries per row. Both coordinates are obtained from one sparse LU factorization,
+    * which is applied to a right-hand side with two columns.
     * In the last step the system is solved and the parameter points are stored in m_parameterPoints.
     *
     * @param[in] neighbourhood const Neighbourhood& - neighbourhood information of the mesh
@@ -16,6 +16,7 @@
 #include <gsIO/gsWriteParaview.h>
 #include <gsModeling/gsLineSegment.h>
 #include <gsModeling/gsParametrization.h>
+#include <gsMatrix/gsSparseSolver.h>
 
 namespace gismo
 {
@@ -123,34 +124,38 @@ void gsParametrization<T>::constructAndSolveEquationSystem(const Neighbourhood &
                                                            const size_t n,
                                                            const size_t N)
 {
-    gsMatrix<T> A;
-    A.resize(n, n);
-    std::vector<T> lambdas;
-    gsVector<T> b1(n), b2(n);
-    b1.setZero(); b2.setZero();
+    gsSparseEntries<T> entries;
+    entries.reserve(7 * n);
+    gsMatrix<T> b(n, 2);
+    b.setZero();
 
     for (size_t i = 0; i < n; i++)
     {
-        lambdas = neighbourhood.getLambdas(i);
-        for (size_t j = 0; j < n; j++)
+        entries.add(i, i, (T)(1));
+        const gsSparseVector<T> & lambdas = neighbourhood.getLambdas(i);
+        for (typename gsSparseVector<T>::InnerIterator it(lambdas); it; ++it)
         {
-            A(i, j) = ( i==j ? (T)(1) : -lambdas[j] );
-        }
-
-        for (size_t j = n; j < N; j++)
-        {
-            b1(i) += (lambdas[j]) * (m_parameterPoints[j][0]);
-            b2(i) += (lambdas[j]) * (m_parameterPoints[j][1]);
+            const size_t j = it.index();
+            if (j >= n) // boundary vertex, contributes to the right-hand side
+            {
+                b(i, 0) += it.value() * m_parameterPoints[j][0];
+                b(i, 1) += it.value() * m_parameterPoints[j][1];
+            }
+            else if (j != i)
+                entries.add(i, j, -it.value());
         }
     }
 
-    gsVector<T> u(n), v(n);
-    gsEigen::PartialPivLU<typename gsMatrix<T>::Base> LU = A.partialPivLu();
-    u = LU.solve(b1);
-    v = LU.solve(b2);
+    gsSparseMatrix<T> A(n, n);
+    A.setFrom(entries);
+    A.makeCompressed();
+
+    typename gsSparseSolver<T>::LU solver(A);
+    GISMO_ENSURE(solver.succeed(), "gsParametrization: Factorization of the system matrix failed.");
+    gsMatrix<T> uv = solver.solve(b);
 
     for (size_t i = 0; i < n; i++)
-        m_parameterPoints[i] << u(i), v(i);
+        m_parameterPoints[i] << uv(i, 0), uv(i, 1);
 }
 
 template<class T>
@@ -262,10 +267,13 @@ T gsParametrization<T>::findLengthOfPositionPart(const size_t position,
 template<class T>
 gsParametrization<T>::Neighbourhood::Neighbourhood(const gsHalfEdgeMesh<T> & meshInfo, const size_t parametrizationMethod) : m_basicInfos(meshInfo)
 {
-    m_localParametrizations.reserve(meshInfo.getNumberOfInnerVertices());
-    for(size_t i=1; i <= meshInfo.getNumberOfInnerVertices(); i++)
+    // The local parametrizations are independent of each other
+    const index_t n = meshInfo.getNumberOfInnerVertices();
+    m_localParametrizations.resize(n);
+#pragma omp parallel for schedule(dynamic, 256)
+    for(index_t i=0; i < n; i++)
     {
-        m_localParametrizations.push_back(LocalParametrization(meshInfo, LocalNeighbourhood(meshInfo, i), parametrizationMethod));
+        m_localParametrizations[i] = LocalParametrization(meshInfo, LocalNeighbourhood(meshInfo, i+1), parametrizationMethod);
     }
 
     m_localBoundaryNeighbourhoods.reserve(meshInfo.getNumberOfVertices() - meshInfo.getNumberOfInnerVertices());
@@ -276,7 +284,7 @@ gsParametrization<T>::Neighbourhood::Neighbourhood(const gsHalfEdgeMesh<T> & mes
 }
 
 template<class T>
-const std::vector<T>& gsParametrization<T>::Neighbourhood::getLambdas(const size_t i) const
+const gsSparseVector<T>& gsParametrization<T>::Neighbourhood::getLambdas(const size_t i) const
 {
     return m_localParametrizations[i].getLambdas();
 }
@@ -563,14 +571,11 @@ gsParametrization<T>::LocalParametrization::LocalParametrization(const gsHalfEdg
         }
             break;
         case 2:
-            m_lambdas.reserve(meshInfo.getNumberOfVertices());
-            for(size_t j=1; j <= meshInfo.getNumberOfVertices(); j++)
-            {
-                m_lambdas.push_back(0); // Lambda(m_vertexIndex, j, 0)
-            }
+            m_lambdas.resize(meshInfo.getNumberOfVertices());
+            m_lambdas.reserve(d);
             while(!indices.empty())
             {
-                m_lambdas[indices.front()-1] += (1./d);
+                m_lambdas.coeffRef(indices.front()-1) += (1./d);
                 indices.pop_front();
             }
             break;
@@ -583,14 +588,11 @@ gsParametrization<T>::LocalParametrization::LocalParametrization(const gsHalfEdg
                 sumOfDistances += *it;
             }
             T sumOfDistancesInv = 1./sumOfDistances;
-            m_lambdas.reserve(meshInfo.getNumberOfVertices());
-            for(size_t j=1; j <= meshInfo.getNumberOfVertices(); j++)
-            {
-                m_lambdas.push_back(0); //Lambda(m_vertexIndex, j, 0)
-            }
+            m_lambdas.resize(meshInfo.getNumberOfVertices());
+            m_lambdas.reserve(d);
             for(typename std::list<T>::iterator it = neighbourDistances.begin(); it != neighbourDistances.end(); it++)
             {
-                m_lambdas[indices.front()-1] += ((*it)*sumOfDistancesInv);
+                m_lambdas.coeffRef(indices.front()-1) += ((*it)*sumOfDistancesInv);
                 indices.pop_front();
             }
         }
@@ -601,7 +603,7 @@ gsParametrization<T>::LocalParametrization::LocalParametrization(const gsHalfEdg
 }
 
 template<class T>
-const std::vector<T>& gsParametrization<T>::LocalParametrization::getLambdas() const
+const gsSparseVector<T>& gsParametrization<T>::LocalParametrization::getLambdas() const
 {
     return m_lambdas;
 }
@@ -615,13 +617,10 @@ const std::vector<T>& gsParametrization<T>::LocalParametrization::getLambdas() c
 template<class T>
 void gsParametrization<T>::LocalParametrization::calculateLambdas(const size_t N, VectorType& points)
 {
-    m_lambdas.reserve(N);
-    for(size_t j=1; j <= N; j++)
-    {
-        m_lambdas.push_back(0); //Lambda(m_vertexIndex, j, 0)
-    }
     Point2D p(0, 0, 0);
     size_t d = points.size();
+    m_lambdas.resize(N);
+    m_lambdas.reserve(d);
     std::vector<T> my(d, 0);
     size_t l=1;
     size_t steps = 0;
@@ -657,19 +656,17 @@ void gsParametrization<T>::LocalParametrization::calculateLambdas(const size_t N
         }
         for(size_t k = 1; k <= d; k++)
         {
-            m_lambdas[points[k-1].getVertexIndex()-1] += (my[k-1]);
+            if (my[k-1] != (T)(0))
+                m_lambdas.coeffRef(points[k-1].getVertexIndex()-1) += (my[k-1]);
         }
         std::fill(my.begin(), my.end(), 0);
         l++;
     }
-    for(typename std::vector<T>::iterator it=m_lambdas.begin(); it != m_lambdas.end(); it++)
-    {
-        *it /= d;
-    }
-    for(typename std::vector<T>::iterator it=m_lambdas.begin(); it != m_lambdas.end(); it++)
+    m_lambdas /= (T)(d);
+    for(typename gsSparseVector<T>::InnerIterator it(m_lambdas); it; ++it)
     {
-        if(*it < 0)
-            gsInfo << *it << "\n";
+        if(it.value() < 0)
+            gsInfo << it.value() << "\n";
     }
 }
 
@@ -114,7 +114,10 @@ void gsPeriodicOverlap<T>::constructAndSolveEquationSystem(const Neighbourhood &
     // interior points
     for (size_t i = 0; i < n; i++)
     {
-        lambdas = neighbourhood.getLambdas(i);
+        const gsSparseVector<T> & sparseLambdas = neighbourhood.getLambdas(i);
+        lambdas.assign(N, (T)(0));
+        for (typename gsSparseVector<T>::InnerIterator it(sparseLambdas); it; ++it)
+            lambdas[it.index()] = it.value();
         updateLambdasWithTwins(lambdas, i+1);
 
         for (size_t j = 0; j < N + numTwins; j++)
@@ -129,7 +129,6 @@ void gsPeriodicStitch<T>::constructAndSolveEquationSystem(const Neighbourhood &n
                                                                          const size_t n,
                                                                          const size_t N)
 {
-    std::vector<T> lambdas;
     gsMatrix<T> LHS(N, N);
     gsMatrix<T> RHS(N, 2);
 
@@ -140,18 +139,18 @@ void gsPeriodicStitch<T>::constructAndSolveEquationSystem(const Neighbourhood &n
     // interior points
     for (size_t i = 0; i < n; i++)
     {
-        lambdas = neighbourhood.getLambdas(i);
+        const gsSparseVector<T> & lambdas = neighbourhood.getLambdas(i);
         for (size_t j = 0; j < N; j++)
         {
-            LHS(i, j) = ( i==j ? (T)(1) : -lambdas[j] );
+            LHS(i, j) = ( i==j ? (T)(1) : -lambdas.coeff(j) );
 
             // If your neighbour is across the stitch, its contributions appear
             // on the right hand-side multiplied by +1 or -1. Write the equations
             // down if it is unclear. (-;
             if(m_corrections(i, j) == 1)
-                RHS(i, 0) -= lambdas[j];
+                RHS(i, 0) -= lambdas.coeff(j);
             else if(m_corrections(i, j) == -1)
-                RHS(i, 0) += lambdas[j];
+                RHS(i, 0) += lambdas.coeff(j);
         }
     }
 
@@ -0,0 +1,142 @@
+/** @file gsAlgebraicMultiGrid.h
+
+    @brief Algebraic multigrid preconditioner (smoothed aggregation)
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): S. Takacs
+*/
+
+#pragma once
+
+#include <gsMultiGrid/gsMultiGrid.h>
+
+namespace gismo
+{
+
+/** @brief
+ *  Algebraic multigrid preconditioner based on smoothed aggregation
+ *
+ *  The grid hierarchy is constructed from the (symmetric) system matrix
+ *  alone, so no information on the discretization is needed. This makes
+ *  the preconditioner applicable to problems where no gsGridHierarchy is
+ *  available, like multipatch discretizations with complicated interfaces,
+ *  smooth splines on gsMappedBasis or the local problems in IETI methods.
+ *
+ *  On each level, the unknowns are grouped into aggregates of strongly
+ *  connected unknowns. The tentative prolongation is piecewise constant on
+ *  the aggregates, which is then improved by one damped Jacobi step
+ *  \f$ P = (I - \omega/\rho\, D^{-1} A) P_0 \f$, where \f$ \rho \f$ is an
+ *  estimate for the spectral radius of \f$ D^{-1} A \f$. The coarse matrices
+ *  are computed by the Galerkin principle \f$ A_c = P^T A P \f$. The setup
+ *  phase is parallelized with OpenMP, except for the aggregation itself.
+ *
+ *  The cycle is realized by a gsMultiGridOp, which is set up with Gauss-Seidel
+ *  (default) or damped Jacobi smoothers on all levels. The multigrid options
+ *  (number of smoothing steps, cycle type, ...) can be passed with the options.
+ *
+ *  @ingroup Solver
+**/
+template<class T>
+class gsAlgebraicMultiGridOp : public gsPreconditionerOp<T>
+{
+
+public:
+
+    /// Shared pointer for gsAlgebraicMultiGridOp
+    typedef memory::shared_ptr<gsAlgebraicMultiGridOp> Ptr;
+
+    /// Unique pointer for gsAlgebraicMultiGridOp
+    typedef memory::unique_ptr<gsAlgebraicMultiGridOp> uPtr;
+
+    /// Direct base class
+    typedef gsPreconditionerOp<T> Base;
+
+    /// Matrix type
+    typedef gsMatrix<T> Matrix;
+
+    /// Sparse matrix type
+    typedef gsSparseMatrix<T> SpMatrix;
+
+    /// Matrix type for transfers
+    typedef gsSparseMatrix<T, RowMajor> SpMatrixRowMajor;
+
+    /// @brief Constructor
+    ///
+    /// @param matrix   The (symmetric) system matrix
+    /// @param opt      Options for the setup and the cycle, see defaultOptions()
+    explicit gsAlgebraicMultiGridOp(
+        const SpMatrix& matrix,
+        const gsOptionList& opt = defaultOptions()
+    );
+
+    /// @brief Make function returning smart pointer
+    ///
+    /// @param matrix   The (symmetric) system matrix
+    /// @param opt      Options for the setup and the cycle, see defaultOptions()
+    static uPtr make( const SpMatrix& matrix, const gsOptionList& opt = defaultOptions() )
+    { return uPtr( new gsAlgebraicMultiGridOp(matrix, opt) ); }
+
+    /// @brief Computes the transfer matrices of the smoothed aggregation
+    ///
+    /// @param[in]  matrix              The (symmetric) system matrix on the finest level
+    /// @param[out] transferMatrices    The transfer matrices, starting with the coarsest one
+    /// @param[out] matrices            The matrices on all levels, starting with the coarsest one
+    /// @param[in]  opt                 Options, see defaultOptions()
+    static void buildHierarchy(
+        const SpMatrix& matrix,
+        std::vector< memory::shared_ptr<SpMatrixRowMajor> >& transferMatrices,
+        std::vector< memory::shared_ptr<SpMatrix> >& matrices,
+        const gsOptionList& opt = defaultOptions()
+    );
+
+    /// @brief Groups strongly connected unknowns into aggregates
+    ///
+    /// @param[in]  matrix     The (symmetric) matrix
+    /// @param[in]  theta      The unknowns i and j are strongly connected if
+    ///                        \f$ |a_{ij}| \ge \theta \sqrt{|a_{ii} a_{jj}|} \f$
+    /// @param[out] aggregate  The index of the aggregate for each unknown
+    ///
+    /// @returns The number of aggregates
+    static index_t aggregate( const SpMatrix& matrix, T theta, std::vector<index_t>& aggregate );
+
+    void step(const Matrix& rhs, Matrix& x) const override
+    { m_mg->step(rhs, x); }
+
+    void stepT(const Matrix& rhs, Matrix& x) const override
+    { m_mg->stepT(rhs, x); }
+
+    typename gsLinearOperator<T>::Ptr underlyingOp() const override
+    { return m_mg->underlyingOp(); }
+
+    index_t rows() const override { return m_mg->rows(); }
+    index_t cols() const override { return m_mg->cols(); }
+
+    /// Number of levels in the multigrid construction
+    index_t numLevels() const { return m_mg->numLevels(); }
+
+    /// The underlying multigrid operator, e.g., to exchange smoothers or the coarse solver
+    const typename gsMultiGridOp<T>::Ptr & multiGridOp() const { return m_mg; }
+
+    /// Returns a list of default options
+    static gsOptionList defaultOptions();
+
+    /// Set the options of the cycle based on a gsOptionList
+    void setOptions(const gsOptionList& opt) override;
+
+private:
+
+    /// The multigrid operator realizing the cycle
+    typename gsMultiGridOp<T>::Ptr m_mg;
+
+}; // class gsAlgebraicMultiGridOp
+
+}  // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsAlgebraicMultiGrid.hpp)
+#endif
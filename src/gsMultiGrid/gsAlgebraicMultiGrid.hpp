@@ -0,0 +1,243 @@
+/** @file gsAlgebraicMultiGrid.hpp
+
+    @brief Algebraic multigrid preconditioner (smoothed aggregation)
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): S. Takacs
+*/
+
+#include <gsSolver/gsMatrixOp.h>
+#include <gsSolver/gsSimplePreconditioners.h>
+#include <gsParallel/gsOpenMP.h>
+
+namespace gismo
+{
+
+template<class T>
+gsAlgebraicMultiGridOp<T>::gsAlgebraicMultiGridOp(
+    const SpMatrix& matrix,
+    const gsOptionList& opt
+)
+{
+    std::vector< memory::shared_ptr<SpMatrixRowMajor> > transferMatrices;
+    std::vector< memory::shared_ptr<SpMatrix> > matrices;
+    buildHierarchy(matrix, transferMatrices, matrices, opt);
+
+    const size_t nLevels = matrices.size();
+    std::vector<typename gsLinearOperator<T>::Ptr> ops(nLevels), prolong(nLevels-1), restr(nLevels-1);
+    for (size_t i = 0; i < nLevels; ++i)
+        ops[i] = makeMatrixOp(matrices[i]);
+    for (size_t i = 0; i+1 < nLevels; ++i)
+    {
+        prolong[i]  = makeMatrixOp(transferMatrices[i]);
+        // The shared pointer stored in prolong keeps the matrix alive, cf. gsMultiGridOp::init
+        restr[i]   = makeMatrixOp(transferMatrices[i]->transpose());
+    }
+
+    m_mg = gsMultiGridOp<T>::make(ops, prolong, restr);
+
+    const std::string smoother = opt.askString("Smoother", "GaussSeidel");
+    for (size_t i = 1; i < nLevels; ++i)
+    {
+        typename gsPreconditionerOp<T>::Ptr sm;
+        if ( smoother == "Jacobi" || smoother == "j" )
+            sm = makeJacobiOp(matrices[i]);
+        else if ( smoother == "GaussSeidel" || smoother == "gs" )
+            sm = makeGaussSeidelOp(matrices[i]);
+        else
+            GISMO_ERROR("gsAlgebraicMultiGridOp: Unknown smoother \""<<smoother<<"\".");
+        sm->setOptions(opt);
+        m_mg->setSmoother(i, sm);
+    }
+
+    setOptions(opt);
+}
+
+template<class T>
+void gsAlgebraicMultiGridOp<T>::buildHierarchy(
+    const SpMatrix& matrix,
+    std::vector< memory::shared_ptr<SpMatrixRowMajor> >& transferMatrices,
+    std::vector< memory::shared_ptr<SpMatrix> >& matrices,
+    const gsOptionList& opt
+)
+{
+    GISMO_ASSERT( matrix.rows() == matrix.cols(), "gsAlgebraicMultiGridOp needs quadratic matrices." );
+
+    const T       theta      = opt.askReal("StrengthThreshold"  , (T)0.08      );
+    const index_t coarseSize = opt.askInt ("CoarseSize"         , 200          );
+    const index_t maxLevels  = opt.askInt ("MaxLevels"          , 10           );
+    const T       omega      = opt.askReal("ProlongationDamping", (T)4/(T)3    );
+
+    transferMatrices.clear();
+    matrices.clear();
+    matrices.push_back( memory::make_shared( new SpMatrix(matrix) ) );
+
+    std::vector<index_t> agg;
+    while ( matrices.back()->rows() > coarseSize && (index_t)matrices.size() < maxLevels )
+    {
+        const SpMatrix & A = *matrices.back();
+        const index_t n  = A.rows();
+        const index_t nc = aggregate(A, theta, agg);
+        if ( nc == 0 || nc == n )
+            break;
+
+        // Diagonal and size of the aggregates
+        gsVector<T> diag = A.diagonal();
+        std::vector<index_t> aggSize(nc, 0);
+        for (index_t i = 0; i < n; ++i)
+            ++aggSize[agg[i]];
+
+        // Estimate the spectral radius of D^{-1} A by power iteration
+        gsMatrix<T> v, w;
+        v.setOnes(n, 1);
+        v.col(0) += gsMatrix<T>::Random(n, 1) / 2;
+        T rho = 1;
+        for (index_t k = 0; k < 15; ++k)
+        {
+            w.noalias() = A * v;
+            w.array() /= diag.array();
+            rho = w.norm() / v.norm();
+            v.swap(w);
+            v /= v.norm();
+        }
+
+        // Smoothed prolongation P = (I - omega/rho D^{-1} A) P0, where
+        // the tentative prolongation P0 is piecewise constant
+        const T damp = omega / rho;
+        const int nt = omp_get_max_threads();
+        std::vector< gsSparseEntries<T> > entries(nt);
+#pragma omp parallel
+        {
+            const int tid = omp_get_thread_num();
+            const int nth = omp_get_num_threads();
+            gsSparseEntries<T> & ent = entries[tid];
+            std::vector<T> row(nc, 0);
+            std::vector<index_t> cols;
+            for (index_t i = tid; i < n; i += nth)
+            {
+                cols.clear();
+                row[agg[i]] = 1 / math::sqrt((T)aggSize[agg[i]]);
+                cols.push_back(agg[i]);
+                // A is symmetric, so the column i can be used instead of the row
+                for (typename SpMatrix::InnerIterator it(A, i); it; ++it)
+                {
+                    const index_t c = agg[it.index()];
+                    if ( row[c] == (T)0 )
+                        cols.push_back(c);
+                    row[c] -= damp * it.value() / diag[i] / math::sqrt((T)aggSize[c]);
+                }
+                for (size_t k = 0; k < cols.size(); ++k)
+                {
+                    if ( row[cols[k]] != (T)0 )
+                        ent.add(i, cols[k], row[cols[k]]);
+                    row[cols[k]] = 0;
+                }
+            }
+        }
+        for (int t = 1; t < nt; ++t)
+            entries[0].insert(entries[0].end(), entries[t].begin(), entries[t].end());
+
+        memory::shared_ptr<SpMatrixRowMajor> P( new SpMatrixRowMajor(n, nc) );
+        P->setFromTriplets(entries[0].begin(), entries[0].end());
+        P->makeCompressed();
+
+        memory::shared_ptr<SpMatrix> Ac( new SpMatrix( P->transpose() * A * *P ) );
+        Ac->prune((T)0);
+        Ac->makeCompressed();
+
+        transferMatrices.push_back(P);
+        matrices.push_back(Ac);
+    }
+
+    std::reverse( matrices.begin(), matrices.end() );
+    std::reverse( transferMatrices.begin(), transferMatrices.end() );
+}
+
+template<class T>
+index_t gsAlgebraicMultiGridOp<T>::aggregate( const SpMatrix& A, T theta, std::vector<index_t>& agg )
+{
+    const index_t n = A.rows();
+
+    // Strongly connected neighbors of each unknown
+    gsVector<T> diag = A.diagonal();
+    std::vector< std::vector<index_t> > strong(n);
+#pragma omp parallel for
+    for (index_t i = 0; i < n; ++i)
+    {
+        for (typename SpMatrix::InnerIterator it(A, i); it; ++it)
+        {
+            const index_t j = it.index();
+            if ( j != i && math::abs(it.value()) >= theta * math::sqrt(math::abs(diag[i]*diag[j])) )
+                strong[i].push_back(j);
+        }
+    }
+
+    agg.assign(n, -1);
+    index_t nc = 0;
+
+    // 1st pass: unknowns whose neighborhood is still free form a new aggregate
+    for (index_t i = 0; i < n; ++i)
+    {
+        if ( agg[i] != -1 ) continue;
+        bool free = true;
+        for (size_t k = 0; k < strong[i].size() && free; ++k)
+            free = ( agg[strong[i][k]] == -1 );
+        if ( !free ) continue;
+        agg[i] = nc;
+        for (size_t k = 0; k < strong[i].size(); ++k)
+            agg[strong[i][k]] = nc;
+        ++nc;
+    }
+
+    // 2nd pass: remaining unknowns join the aggregate of a neighbor
+    std::vector<index_t> agg1 = agg;
+    for (index_t i = 0; i < n; ++i)
+    {
+        if ( agg[i] != -1 ) continue;
+        for (size_t k = 0; k < strong[i].size(); ++k)
+            if ( agg1[strong[i][k]] != -1 )
+            {
+                agg[i] = agg1[strong[i][k]];
+                break;
+            }
+    }
+
+    // 3rd pass: the rest forms new aggregates with their free neighbors
+    for (index_t i = 0; i < n; ++i)
+    {
+        if ( agg[i] != -1 ) continue;
+        agg[i] = nc;
+        for (size_t k = 0; k < strong[i].size(); ++k)
+            if ( agg[strong[i][k]] == -1 )
+                agg[strong[i][k]] = nc;
+        ++nc;
+    }
+
+    return nc;
+}
+
+template<class T>
+gsOptionList gsAlgebraicMultiGridOp<T>::defaultOptions()
+{
+    gsOptionList opt = gsMultiGridOp<T>::defaultOptions();
+    opt.addReal  ("StrengthThreshold"   , "Threshold for strong connections between unknowns",          (gsOptionList::Real)0.08 );
+    opt.addInt   ("CoarseSize"          , "The coarsening stops if the number of unknowns is below this", 200 );
+    opt.addInt   ("MaxLevels"           , "Maximum number of levels",                                     10  );
+    opt.addReal  ("ProlongationDamping" , "Damping of the prolongation smoother (scaled by 1/rho)", (gsOptionList::Real)4/3 );
+    opt.addString("Smoother"            , "Smoother: GaussSeidel or Jacobi",                    "GaussSeidel" );
+    return opt;
+}
+
+template<class T>
+void gsAlgebraicMultiGridOp<T>::setOptions(const gsOptionList & opt)
+{
+    Base::setOptions(opt);
+    m_mg->setOptions(opt);
+}
+
+} // namespace gismo
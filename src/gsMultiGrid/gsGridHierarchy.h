@@ -126,6 +126,35 @@ public:
         );
     }
 
+    /// @brief This function sets up a grid hierarchy from the levels of hierarchical bases
+    ///
+    /// @param mBasis                    The gsMultiBasis consisting of hierarchical bases (\a gsHTensorBasis),
+    ///                                  typically obtained by adaptive refinement (finest grid)
+    /// @param boundaryConditions        The boundary conditions
+    /// @param assemblerOptions          A gsOptionList defining a "DirichletStrategy" and a "InterfaceStrategy"
+    /// @param unk                       Since the gsBoundaryCondition object can obtain data for systems
+    ///                                  of PDEs, we have to provide information concerning which unknown
+    ///                                  we are refering to.
+    ///
+    /// The grid of level \f$\ell\f$ is obtained by removing all refinements beyond level \f$\ell\f$
+    /// from the given bases (see gsHTensorBasis::coarsenToLevel), so the number of grids is the
+    /// number of levels of the given bases. Patches with fewer levels or tensor-product bases are
+    /// kept unchanged on the coarser grids. Consecutive grids differ only locally, see changedDofs().
+    static gsGridHierarchy buildByHierarchy(
+        gsMultiBasis<T> mBasis,
+        const gsBoundaryConditions<T>& boundaryConditions,
+        const gsOptionList& assemblerOptions,
+        index_t unk = 0
+        );
+
+    /// @brief Returns the degrees of freedom which are affected by the given transfer matrix
+    ///
+    /// These are all fine-grid dofs except those which coincide with a coarse-grid dof, i.e., those
+    /// where both the row of \a transferMatrix and the corresponding column have only the entry one.
+    /// For grids obtained by local refinement (see buildByHierarchy), this is the set the smoother
+    /// can be restricted to (local smoothing).
+    static std::vector<index_t> changedDofs( const gsSparseMatrix<T, RowMajor>& transferMatrix );
+
     /// Get the default options
     static gsOptionList defaultOptions()
     {
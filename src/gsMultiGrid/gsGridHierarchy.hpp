@@ -19,6 +19,7 @@
 #include <gsIO/gsOptionList.h>
 #include <gsAssembler/gsAssemblerOptions.h>
 #include <gsCore/gsMultiBasis.h>
+#include <gsHSplines/gsHTensorBasis.h>
 
 namespace gismo
 {
@@ -99,4 +100,143 @@ gsGridHierarchy<T> gsGridHierarchy<T>::buildByCoarsening(
     return result;
 }
 
+namespace internal
+{
+
+// Returns the finest level of \a basis, or -1 if it is not a gsHTensorBasis
+template <short_t d, typename T>
+index_t hierarchicalMaxLevel( const gsBasis<T>& basis )
+{
+    const gsHTensorBasis<d,T> * hb = dynamic_cast<const gsHTensorBasis<d,T>*>(&basis);
+    return hb ? static_cast<index_t>(hb->maxLevel()) : -1;
+}
+
+// Replaces \a basis by its coarsening to level \a lvl and computes the
+// transfer matrix; \a basis is assumed to be a gsHTensorBasis
+template <short_t d, typename T>
+void hierarchicalCoarsen( gsBasis<T>& basis, index_t lvl, gsSparseMatrix<T, RowMajor>& transfer )
+{
+    gsHTensorBasis<d,T> & hb = static_cast<gsHTensorBasis<d,T>&>(basis);
+    typename gsHTensorBasis<d,T>::uPtr fine = hb.clone();
+    hb.coarsenToLevel(lvl);
+    gsSparseMatrix<T> tr;
+    fine->transfer(hb.getXmatrix(), tr);
+    transfer = tr;
+}
+
+} // namespace internal
+
+template <typename T>
+gsGridHierarchy<T> gsGridHierarchy<T>::buildByHierarchy(
+    gsMultiBasis<T> mBasis,
+    const gsBoundaryConditions<T>& boundaryConditions,
+    const gsOptionList& options,
+    index_t unk
+    )
+{
+    const short_t d = mBasis.dim();
+    GISMO_ENSURE( d>=1 && d<=4, "buildByHierarchy: dimension "<< d <<" is not supported." );
+
+    const size_t np = mBasis.nBases();
+    std::vector<index_t> maxLevel(np);
+    index_t levels = 1;
+    for (size_t k = 0; k < np; ++k)
+    {
+        switch (d)
+        {
+        case 1: maxLevel[k] = internal::hierarchicalMaxLevel<1,T>(mBasis.basis(k)); break;
+        case 2: maxLevel[k] = internal::hierarchicalMaxLevel<2,T>(mBasis.basis(k)); break;
+        case 3: maxLevel[k] = internal::hierarchicalMaxLevel<3,T>(mBasis.basis(k)); break;
+        case 4: maxLevel[k] = internal::hierarchicalMaxLevel<4,T>(mBasis.basis(k)); break;
+        }
+        levels = math::max(levels, maxLevel[k]+1);
+    }
+
+    gsGridHierarchy<T> result;
+    result.m_mBases.push_back(give(mBasis));
+
+    for (index_t lvl = levels-2; lvl >= 0; --lvl)
+    {
+        gsMultiBasis<T> coarseMBasis = result.m_mBases.back();
+
+        gsDofMapper fineMapper;
+        coarseMBasis.getMapper(
+            (dirichlet::strategy)options.askInt("DirichletStrategy",11),
+            (iFace    ::strategy)options.askInt("InterfaceStrategy", 1),
+            boundaryConditions,
+            fineMapper,
+            unk
+        );
+
+        std::vector< gsSparseMatrix<T, RowMajor> > localTransferMatrices(np);
+        for (size_t k = 0; k < np; ++k)
+        {
+            if ( maxLevel[k] > lvl )
+            {
+                switch (d)
+                {
+                case 1: internal::hierarchicalCoarsen<1,T>(coarseMBasis.basis(k), lvl, localTransferMatrices[k]); break;
+                case 2: internal::hierarchicalCoarsen<2,T>(coarseMBasis.basis(k), lvl, localTransferMatrices[k]); break;
+                case 3: internal::hierarchicalCoarsen<3,T>(coarseMBasis.basis(k), lvl, localTransferMatrices[k]); break;
+                case 4: internal::hierarchicalCoarsen<4,T>(coarseMBasis.basis(k), lvl, localTransferMatrices[k]); break;
+                }
+            }
+            else
+            {
+                const index_t sz = coarseMBasis.basis(k).size();
+                localTransferMatrices[k].resize(sz, sz);
+                localTransferMatrices[k].setIdentity();
+            }
+        }
+
+        gsDofMapper coarseMapper;
+        coarseMBasis.getMapper(
+            (dirichlet::strategy)options.askInt("DirichletStrategy",11),
+            (iFace    ::strategy)options.askInt("InterfaceStrategy", 1),
+            boundaryConditions,
+            coarseMapper,
+            unk
+        );
+
+        gsSparseMatrix<T, RowMajor> transferMatrix;
+        gsMultiBasis<T>::combineTransferMatrices( localTransferMatrices, coarseMapper, fineMapper, transferMatrix );
+
+        result.m_mBases.push_back(give(coarseMBasis));
+        result.m_transferMatrices.push_back(give(transferMatrix));
+    }
+
+    std::reverse( result.m_mBases.begin(), result.m_mBases.end() );
+    std::reverse( result.m_transferMatrices.begin(), result.m_transferMatrices.end() );
+
+    return result;
+}
+
+template <typename T>
+std::vector<index_t> gsGridHierarchy<T>::changedDofs( const gsSparseMatrix<T, RowMajor>& transferMatrix )
+{
+    // number of entries per column
+    std::vector<index_t> colCount(transferMatrix.cols(), 0);
+    for (index_t i = 0; i < transferMatrix.outerSize(); ++i)
+        for (typename gsSparseMatrix<T, RowMajor>::InnerIterator it(transferMatrix,i); it; ++it)
+            if ( it.value() != (T)0 )
+                ++colCount[it.index()];
+
+    std::vector<index_t> result;
+    for (index_t i = 0; i < transferMatrix.outerSize(); ++i)
+    {
+        index_t nz = 0, col = -1;
+        T val = 0;
+        for (typename gsSparseMatrix<T, RowMajor>::InnerIterator it(transferMatrix,i); it; ++it)
+            if ( it.value() != (T)0 )
+            {
+                ++nz;
+                col = it.index();
+                val = it.value();
+            }
+        if ( nz != 1 || colCount[col] != 1 || math::abs(val - (T)1) > 1000*math::limits::epsilon() )
+            result.push_back(i);
+    }
+    return result;
+}
+
 } // namespace gismo
@@ -0,0 +1,297 @@
+/** @file gsPMultiGrid.h
+
+    @brief p-multigrid preconditioner and block ILUT smoother
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): R. Tielen, S. Takacs
+*/
+
+#pragma once
+
+#include <gsMultiGrid/gsMultiGrid.h>
+
+namespace gismo
+{
+
+/** @brief
+ *  Block incomplete LU smoother for multipatch discretizations
+ *
+ *  The unknowns are split into blocks (usually the unknowns that belong to
+ *  exactly one patch) and the remaining coupling unknowns (those on the
+ *  interfaces). With this ordering, the matrix reads
+ *  \f[
+ *     A = \begin{pmatrix} A_{1} & & & C_1 \\ & \ddots & & \vdots \\
+ *           & & A_{n} & C_n \\ B_1 & \cdots & B_n & A_{\Gamma} \end{pmatrix}.
+ *  \f]
+ *  The diagonal blocks are approximated by incomplete LU factorizations
+ *  \f$ \tilde A_k \f$ (with thresholding) and the Schur complement
+ *  \f$ S = A_{\Gamma} - \sum_k B_k \tilde A_k^{-1} C_k \f$ is
+ *  approximated by an incomplete LU factorization as well. The
+ *  factorizations of the blocks and their applications are independent of
+ *  each other and done in parallel using OpenMP.
+ *
+ *  @ingroup Solver
+**/
+template<class T>
+class gsBlockILUTOp : public gsPreconditionerOp<T>
+{
+
+public:
+
+    /// Shared pointer for gsBlockILUTOp
+    typedef memory::shared_ptr<gsBlockILUTOp> Ptr;
+
+    /// Unique pointer for gsBlockILUTOp
+    typedef memory::unique_ptr<gsBlockILUTOp> uPtr;
+
+    /// Direct base class
+    typedef gsPreconditionerOp<T> Base;
+
+    /// Matrix type
+    typedef gsMatrix<T> Matrix;
+
+    /// Sparse matrix type
+    typedef gsSparseMatrix<T> SpMatrix;
+
+    /// Smart pointer to sparse matrix type
+    typedef memory::shared_ptr<SpMatrix> SpMatrixPtr;
+
+    /// @brief Constructor
+    ///
+    /// @param matrix       The system matrix
+    /// @param blocks       The indices of the unknowns for each of the blocks;
+    ///                     all unknowns which do not belong to any block are
+    ///                     the coupling unknowns
+    /// @param fillfactor   The fill factor of the incomplete LU factorizations
+    gsBlockILUTOp(
+        SpMatrixPtr matrix,
+        const std::vector< std::vector<index_t> >& blocks,
+        index_t fillfactor = 1
+    );
+
+    /// @brief Make function returning smart pointer
+    ///
+    /// @param matrix       The system matrix
+    /// @param blocks       The indices of the unknowns for each of the blocks
+    /// @param fillfactor   The fill factor of the incomplete LU factorizations
+    static uPtr make(
+        SpMatrixPtr matrix,
+        const std::vector< std::vector<index_t> >& blocks,
+        index_t fillfactor = 1
+    )
+    { return uPtr( new gsBlockILUTOp(give(matrix), blocks, fillfactor) ); }
+
+    /// @brief Make function returning smart pointer, where the blocks are
+    /// the patch-local unknowns
+    ///
+    /// @param matrix             The system matrix
+    /// @param mb                 The multipatch basis
+    /// @param bc                 The boundary conditions
+    /// @param assemblerOptions   A gsOptionList defining a "DirichletStrategy" and a "InterfaceStrategy"
+    /// @param fillfactor         The fill factor of the incomplete LU factorizations
+    static uPtr make(
+        SpMatrixPtr matrix,
+        const gsMultiBasis<T>& mb,
+        const gsBoundaryConditions<T>& bc,
+        const gsOptionList& assemblerOptions,
+        index_t fillfactor = 1
+    );
+
+    void step(const Matrix& rhs, Matrix& x) const override;
+
+    typename gsLinearOperator<T>::Ptr underlyingOp() const override
+    { return makeMatrixOp(m_A); }
+
+    index_t rows() const override { return m_A->rows(); }
+    index_t cols() const override { return m_A->cols(); }
+
+    /// Number of blocks, not counting the coupling unknowns
+    index_t numBlocks() const { return m_ilu.size(); }
+
+private:
+
+    /// Applies the approximate inverse, i.e., \f$ x = \tilde A^{-1} r \f$
+    void solve(const Matrix& r, Matrix& x) const;
+
+    SpMatrixPtr m_A;                                         ///< The system matrix
+    std::vector< std::vector<index_t> > m_idx;               ///< Unknowns of the blocks
+    std::vector<index_t> m_idxC;                             ///< Coupling unknowns
+    std::vector< std::vector<index_t> > m_cpl;               ///< Coupling unknowns adjacent to the blocks
+    std::vector< memory::shared_ptr< gsEigen::IncompleteLUT<T> > > m_ilu; ///< Factorizations of the blocks
+    std::vector<SpMatrix> m_B;                               ///< Rows of the coupling unknowns
+    std::vector<SpMatrix> m_C;                               ///< Columns of the coupling unknowns
+    gsEigen::IncompleteLUT<T> m_iluS;                        ///< Factorization of the Schur complement
+
+}; // class gsBlockILUTOp
+
+/** @brief
+ *  p-multigrid preconditioner
+ *
+ *  The grid hierarchy is obtained from the given (finest) basis by
+ *  reducing the spline degree (p-coarsening), by coarsening the grid
+ *  (h-coarsening) or by both (z-coarsening). By default, the degree is
+ *  reduced by one on each of the finer levels until degree one is reached;
+ *  the remaining levels are obtained by h-coarsening. The sequence can be
+ *  prescribed with the option "Coarsening", a string of the characters
+ *  'h', 'p' and 'z' describing the coarsening steps, starting with the
+ *  one between the coarsest and the second coarsest level.
+ *
+ *  Between grids with different degrees, the transfer is an
+ *  \f$ L_2 \f$-projection with lumped mass matrices; for h-coarsening,
+ *  the canonical embedding is used. The matrices on the coarser levels are
+ *  computed by the Galerkin principle \f$ A_c = P^T A P \f$.
+ *
+ *  On levels with degree one, Gauss-Seidel is used as smoother, on the
+ *  other levels the block ILUT smoother (gsBlockILUTOp, default), a
+ *  standard ILUT or Gauss-Seidel. The cycle is realized by a
+ *  gsMultiGridOp; its options (number of smoothing steps, ...) can be
+ *  passed with the options.
+ *
+ *  The system matrix is expected to be numbered according to
+ *  gsMultiBasis::getMapper with the options "DirichletStrategy" and
+ *  "InterfaceStrategy" (as done by the assemblers).
+ *
+ *  @ingroup Solver
+**/
+template<class T>
+class gsPMultiGridOp : public gsPreconditionerOp<T>
+{
+
+public:
+
+    /// Shared pointer for gsPMultiGridOp
+    typedef memory::shared_ptr<gsPMultiGridOp> Ptr;
+
+    /// Unique pointer for gsPMultiGridOp
+    typedef memory::unique_ptr<gsPMultiGridOp> uPtr;
+
+    /// Direct base class
+    typedef gsPreconditionerOp<T> Base;
+
+    /// Matrix type
+    typedef gsMatrix<T> Matrix;
+
+    /// Sparse matrix type
+    typedef gsSparseMatrix<T> SpMatrix;
+
+    /// Matrix type for transfers
+    typedef gsSparseMatrix<T, RowMajor> SpMatrixRowMajor;
+
+    /// @brief Constructor
+    ///
+    /// @param mp       The geometry
+    /// @param mb       The basis on the finest level
+    /// @param bc       The boundary conditions
+    /// @param matrix   The system matrix on the finest level
+    /// @param opt      Options for the setup and the cycle, see defaultOptions()
+    gsPMultiGridOp(
+        const gsMultiPatch<T>& mp,
+        const gsMultiBasis<T>& mb,
+        const gsBoundaryConditions<T>& bc,
+        const SpMatrix& matrix,
+        const gsOptionList& opt = defaultOptions()
+    );
+
+    /// @brief Make function returning smart pointer
+    ///
+    /// @param mp       The geometry
+    /// @param mb       The basis on the finest level
+    /// @param bc       The boundary conditions
+    /// @param matrix   The system matrix on the finest level
+    /// @param opt      Options for the setup and the cycle, see defaultOptions()
+    static uPtr make(
+        const gsMultiPatch<T>& mp,
+        const gsMultiBasis<T>& mb,
+        const gsBoundaryConditions<T>& bc,
+        const SpMatrix& matrix,
+        const gsOptionList& opt = defaultOptions()
+    )
+    { return uPtr( new gsPMultiGridOp(mp, mb, bc, matrix, opt) ); }
+
+    /// @brief Sets up the bases and the transfer matrices
+    ///
+    /// @param[in]  mp                 The geometry
+    /// @param[in]  mb                 The basis on the finest level
+    /// @param[in]  bc                 The boundary conditions
+    /// @param[in]  opt                Options, see defaultOptions()
+    /// @param[out] bases              The bases, starting with the coarsest one
+    /// @param[out] transferMatrices   The transfer matrices, starting with the coarsest one
+    /// @param[out] coarsening         The coarsening steps, starting with the coarsest one
+    static void buildHierarchy(
+        const gsMultiPatch<T>& mp,
+        const gsMultiBasis<T>& mb,
+        const gsBoundaryConditions<T>& bc,
+        const gsOptionList& opt,
+        std::vector< gsMultiBasis<T> >& bases,
+        std::vector<SpMatrixRowMajor>& transferMatrices,
+        std::string& coarsening
+    );
+
+    /// @brief Computes the prolongation by \f$ L_2 \f$-projection with lumped mass matrix
+    ///
+    /// @param mp                 The geometry
+    /// @param fine               The fine basis (also used for the integration)
+    /// @param coarse             The coarse basis
+    /// @param bc                 The boundary conditions
+    /// @param assemblerOptions   A gsOptionList defining a "DirichletStrategy"
+    static SpMatrixRowMajor lumpedProjection(
+        const gsMultiPatch<T>& mp,
+        const gsMultiBasis<T>& fine,
+        const gsMultiBasis<T>& coarse,
+        const gsBoundaryConditions<T>& bc,
+        const gsOptionList& assemblerOptions
+    );
+
+    void step(const Matrix& rhs, Matrix& x) const override
+    { m_mg->step(rhs, x); }
+
+    void stepT(const Matrix& rhs, Matrix& x) const override
+    { m_mg->stepT(rhs, x); }
+
+    typename gsLinearOperator<T>::Ptr underlyingOp() const override
+    { return m_mg->underlyingOp(); }
+
+    index_t rows() const override { return m_mg->rows(); }
+    index_t cols() const override { return m_mg->cols(); }
+
+    /// Number of levels in the multigrid construction
+    index_t numLevels() const { return m_mg->numLevels(); }
+
+    /// The bases on all levels, starting with the coarsest one
+    const std::vector< gsMultiBasis<T> >& bases() const { return m_bases; }
+
+    /// The coarsening steps, starting with the coarsest one
+    const std::string& coarsening() const { return m_coarsening; }
+
+    /// The underlying multigrid operator, e.g., to exchange smoothers or the coarse solver
+    const typename gsMultiGridOp<T>::Ptr & multiGridOp() const { return m_mg; }
+
+    /// Returns a list of default options
+    static gsOptionList defaultOptions();
+
+    /// Set the options of the cycle based on a gsOptionList
+    void setOptions(const gsOptionList& opt) override;
+
+private:
+
+    /// The multigrid operator realizing the cycle
+    typename gsMultiGridOp<T>::Ptr m_mg;
+
+    /// The bases on all levels
+    std::vector< gsMultiBasis<T> > m_bases;
+
+    /// The coarsening steps
+    std::string m_coarsening;
+
+}; // class gsPMultiGridOp
+
+}  // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsPMultiGrid.hpp)
+#endif
@@ -0,0 +1,424 @@
+/** @file gsPMultiGrid.hpp
+
+    @brief p-multigrid preconditioner and block ILUT smoother
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): R. Tielen, S. Takacs
+*/
+
+#include <gsSolver/gsMatrixOp.h>
+#include <gsSolver/gsSimplePreconditioners.h>
+#include <gsAssembler/gsExprAssembler.h>
+#include <gsParallel/gsOpenMP.h>
+
+namespace gismo
+{
+
+template<class T>
+gsBlockILUTOp<T>::gsBlockILUTOp(
+    SpMatrixPtr matrix,
+    const std::vector< std::vector<index_t> >& blocks,
+    index_t fillfactor
+)
+: m_A(give(matrix)), m_idx(blocks)
+{
+    GISMO_ASSERT( m_A->rows() == m_A->cols(), "gsBlockILUTOp needs quadratic matrices." );
+
+    const index_t n  = m_A->rows();
+    const index_t nb = m_idx.size();
+
+    // Block and local index of each unknown; block nb refers to the coupling unknowns
+    std::vector<index_t> blk(n, nb), loc(n);
+    for (index_t k = 0; k < nb; ++k)
+        for (size_t i = 0; i < m_idx[k].size(); ++i)
+        {
+            GISMO_ASSERT( blk[m_idx[k][i]] == nb, "gsBlockILUTOp: The blocks are not disjoint." );
+            blk[m_idx[k][i]] = k;
+            loc[m_idx[k][i]] = i;
+        }
+    for (index_t i = 0; i < n; ++i)
+        if (blk[i] == nb)
+        {
+            loc[i] = m_idxC.size();
+            m_idxC.push_back(i);
+        }
+    const index_t nc = m_idxC.size();
+
+    // Coupling unknowns adjacent to each block, numbered locally
+    m_cpl.resize(nb);
+    {
+        std::vector<index_t> mark(nc, -1);
+        for (index_t k = 0; k < nb; ++k)
+        {
+            for (size_t i = 0; i < m_idx[k].size(); ++i)
+                for (typename SpMatrix::InnerIterator it(*m_A, m_idx[k][i]); it; ++it)
+                {
+                    const index_t j = it.row();
+                    if (blk[j] == nb && mark[loc[j]] != k)
+                    {
+                        mark[loc[j]] = k;
+                        m_cpl[k].push_back(loc[j]);
+                    }
+                }
+            std::sort(m_cpl[k].begin(), m_cpl[k].end());
+        }
+    }
+
+    // Split the matrix into the blocks, the coupling parts and the coupling block
+    std::vector< gsSparseEntries<T> > eA(nb), eB(nb), eC(nb);
+    gsSparseEntries<T> eS;
+    {
+        // The position of a coupling unknown within m_cpl[k] is found by binary search
+        for (index_t j = 0; j < m_A->outerSize(); ++j)
+            for (typename SpMatrix::InnerIterator it(*m_A, j); it; ++it)
+            {
+                const index_t r = it.row(), c = it.col();
+                const index_t br = blk[r], bc = blk[c];
+                if (br == bc)
+                {
+                    if (br < nb) eA[br].add(loc[r], loc[c], it.value());
+                    else         eS.add(loc[r], loc[c], it.value());
+                }
+                else if (br == nb)
+                {
+                    const index_t p = std::lower_bound(m_cpl[bc].begin(), m_cpl[bc].end(), loc[r]) - m_cpl[bc].begin();
+                    eB[bc].add(p, loc[c], it.value());
+                }
+                else if (bc == nb)
+                {
+                    const index_t p = std::lower_bound(m_cpl[br].begin(), m_cpl[br].end(), loc[c]) - m_cpl[br].begin();
+                    eC[br].add(loc[r], p, it.value());
+                }
+                // Entries coupling two different blocks are dropped
+            }
+    }
+
+    m_ilu.resize(nb);
+    m_B.resize(nb);
+    m_C.resize(nb);
+
+#pragma omp parallel for schedule(dynamic)
+    for (index_t k = 0; k < nb; ++k)
+    {
+        const index_t sz = m_idx[k].size();
+        const index_t ck = m_cpl[k].size();
+        SpMatrix Ak(sz, sz);
+        Ak.setFrom(eA[k]);
+        m_B[k].resize(ck, sz);
+        m_B[k].setFrom(eB[k]);
+        m_C[k].resize(sz, ck);
+        m_C[k].setFrom(eC[k]);
+
+        if (sz == 0) continue;
+        m_ilu[k] = memory::make_shared( new gsEigen::IncompleteLUT<T>() );
+        m_ilu[k]->setFillfactor(fillfactor);
+        m_ilu[k]->compute(Ak);
+
+        // Contribution B_k A_k^{-1} C_k to the Schur complement, which only
+        // affects the coupling unknowns adjacent to the block
+        if (ck > 0)
+        {
+            const Matrix Ck = m_C[k];
+            const Matrix Sk = m_B[k] * Matrix(m_ilu[k]->solve(Ck));
+#pragma omp critical (gsBlockILUTOp_schur)
+            for (index_t j = 0; j < ck; ++j)
+                for (index_t i = 0; i < ck; ++i)
+                    eS.add(m_cpl[k][i], m_cpl[k][j], -Sk(i, j));
+        }
+    }
+
+    // If there is no coupling (for example if there is only one patch), the
+    // work is done.
+    if (nc > 0)
+    {
+        SpMatrix S(nc, nc);
+        S.setFrom(eS);
+        m_iluS.setFillfactor(fillfactor);
+        m_iluS.compute(S);
+    }
+}
+
+template<class T>
+typename gsBlockILUTOp<T>::uPtr gsBlockILUTOp<T>::make(
+    SpMatrixPtr matrix,
+    const gsMultiBasis<T>& mb,
+    const gsBoundaryConditions<T>& bc,
+    const gsOptionList& assemblerOptions,
+    index_t fillfactor
+)
+{
+    gsDofMapper dm;
+    mb.getMapper(
+       (dirichlet::strategy)assemblerOptions.askInt("DirichletStrategy",11),
+       (iFace    ::strategy)assemblerOptions.askInt("InterfaceStrategy", 1),
+       bc,
+       dm,
+       0
+    );
+
+    const index_t nPatches = mb.nPieces();
+    std::vector< std::vector<index_t> > blocks(nPatches);
+    for (index_t k = 0; k < nPatches; ++k)
+    {
+        const gsVector<index_t> local = dm.findFreeUncoupled(k);
+        blocks[k].resize(local.size());
+        for (index_t i = 0; i < local.size(); ++i)
+            blocks[k][i] = dm.index(local[i], k);
+    }
+    return make(give(matrix), blocks, fillfactor);
+}
+
+template<class T>
+void gsBlockILUTOp<T>::solve(const Matrix& r, Matrix& x) const
+{
+    const index_t nb = m_ilu.size();
+    const index_t nc = m_idxC.size();
+    const index_t m  = r.cols();
+
+    x.setZero(r.rows(), m);
+    std::vector<Matrix> y(nb);
+
+    // Forward substitution for the blocks
+#pragma omp parallel for schedule(dynamic)
+    for (index_t k = 0; k < nb; ++k)
+    {
+        if (m_idx[k].empty()) continue;
+        Matrix rk(m_idx[k].size(), m);
+        for (size_t i = 0; i < m_idx[k].size(); ++i)
+            rk.row(i) = r.row(m_idx[k][i]);
+        y[k] = m_ilu[k]->solve(rk);
+    }
+
+    if (nc > 0)
+    {
+        // Coupling unknowns
+        Matrix rc(nc, m);
+        for (index_t i = 0; i < nc; ++i)
+            rc.row(i) = r.row(m_idxC[i]);
+        for (index_t k = 0; k < nb; ++k)
+        {
+            if (m_idx[k].empty() || m_cpl[k].empty()) continue;
+            const Matrix bk = m_B[k] * y[k];
+            for (size_t i = 0; i < m_cpl[k].size(); ++i)
+                rc.row(m_cpl[k][i]) -= bk.row(i);
+        }
+        const Matrix xc = m_iluS.solve(rc);
+        for (index_t i = 0; i < nc; ++i)
+            x.row(m_idxC[i]) = xc.row(i);
+
+        // Backward substitution for the blocks
+#pragma omp parallel for schedule(dynamic)
+        for (index_t k = 0; k < nb; ++k)
+        {
+            if (m_idx[k].empty() || m_cpl[k].empty()) continue;
+            Matrix ck(m_cpl[k].size(), m);
+            for (size_t i = 0; i < m_cpl[k].size(); ++i)
+                ck.row(i) = xc.row(m_cpl[k][i]);
+            y[k] -= m_ilu[k]->solve( Matrix(m_C[k] * ck) );
+        }
+    }
+
+    for (index_t k = 0; k < nb; ++k)
+        for (size_t i = 0; i < m_idx[k].size(); ++i)
+            x.row(m_idx[k][i]) = y[k].row(i);
+}
+
+template<class T>
+void gsBlockILUTOp<T>::step(const Matrix& rhs, Matrix& x) const
+{
+    Matrix update;
+    solve( rhs - (*m_A) * x, update );
+    x += update;
+}
+
+template<class T>
+gsPMultiGridOp<T>::gsPMultiGridOp(
+    const gsMultiPatch<T>& mp,
+    const gsMultiBasis<T>& mb,
+    const gsBoundaryConditions<T>& bc,
+    const SpMatrix& matrix,
+    const gsOptionList& opt
+)
+{
+    std::vector<SpMatrixRowMajor> transferMatrices;
+    buildHierarchy(mp, mb, bc, opt, m_bases, transferMatrices, m_coarsening);
+
+    // The coarse matrices are computed by the Galerkin principle
+    m_mg = gsMultiGridOp<T>::make(matrix, give(transferMatrices));
+
+    const std::string smoother = opt.askString("Smoother", "BlockILUT");
+    const index_t fillfactor = opt.askInt("FillFactor", 1);
+    const index_t nLevels = m_mg->numLevels();
+    for (index_t i = 1; i < nLevels; ++i)
+    {
+        typename gsPreconditionerOp<T>::Ptr sm;
+        memory::shared_ptr<SpMatrix> A( new SpMatrix(m_mg->matrix(i)) );
+        if ( m_bases[i].maxCwiseDegree() == 1 || smoother == "GaussSeidel" || smoother == "gs" )
+            sm = makeGaussSeidelOp(A);
+        else if ( smoother == "ILUT" || smoother == "ilut" )
+            sm = gsIncompleteLUOp<SpMatrix>::make(A, fillfactor);
+        else if ( smoother == "BlockILUT" || smoother == "bilut" )
+            sm = gsBlockILUTOp<T>::make(A, m_bases[i], bc, opt, fillfactor);
+        else
+            GISMO_ERROR("gsPMultiGridOp: Unknown smoother \""<<smoother<<"\".");
+        m_mg->setSmoother(i, sm);
+    }
+
+    setOptions(opt);
+}
+
+template<class T>
+void gsPMultiGridOp<T>::buildHierarchy(
+    const gsMultiPatch<T>& mp,
+    const gsMultiBasis<T>& mb,
+    const gsBoundaryConditions<T>& bc,
+    const gsOptionList& opt,
+    std::vector< gsMultiBasis<T> >& bases,
+    std::vector<SpMatrixRowMajor>& transferMatrices,
+    std::string& coarsening
+)
+{
+    const index_t levels   = opt.askInt   ("Levels"        , 3    );
+    const bool    toLinear = opt.askSwitch("ReduceToLinear", false);
+    const index_t degree   = mb.minCwiseDegree();
+    coarsening             = opt.askString("Coarsening"    , ""   );
+
+    GISMO_ENSURE( levels > 0, "gsPMultiGridOp: The number of levels has to be positive." );
+
+    if (coarsening.empty())
+    {
+        // Reduce the degree on the finest levels until degree one is
+        // reached, the remainder is of type h
+        index_t nP = toLinear ? (degree > 1 ? 1 : 0) : degree - 1;
+        nP = math::min(nP, levels - 1);
+        coarsening = std::string(levels - 1 - nP, 'h') + std::string(nP, 'p');
+    }
+
+    GISMO_ENSURE( coarsening.size() == (size_t)(levels - 1),
+                  "gsPMultiGridOp: The option Coarsening should have length " << levels - 1 << "." );
+
+    bases.clear();
+    transferMatrices.clear();
+    bases.push_back(mb);
+
+    for (index_t i = levels - 2; i >= 0; --i)
+    {
+        const char type = coarsening[i];
+        const gsMultiBasis<T> & fine = bases.back();
+        gsMultiBasis<T> coarse(fine);
+        SpMatrixRowMajor transfer;
+
+        GISMO_ENSURE( type == 'h' || type == 'p' || type == 'z',
+                      "gsPMultiGridOp: Unknown coarsening type '" << type << "'." );
+
+        if (type == 'h')
+            coarse.uniformCoarsen_withTransfer(transfer, bc, opt);
+        else
+        {
+            const index_t p = coarse.minCwiseDegree();
+            GISMO_ENSURE( p > 1, "gsPMultiGridOp: The degree cannot be reduced below one." );
+            if (type == 'z')
+                coarse.uniformCoarsen();
+            // Keep the interior knots, cf. degreeIncrease
+            coarse.degreeDecrease(toLinear ? p - 1 : 1);
+            transfer = lumpedProjection(mp, fine, coarse, bc, opt);
+        }
+
+        bases.push_back(give(coarse));
+        transferMatrices.push_back(give(transfer));
+    }
+
+    std::reverse( bases.begin(), bases.end() );
+    std::reverse( transferMatrices.begin(), transferMatrices.end() );
+}
+
+template<class T>
+typename gsPMultiGridOp<T>::SpMatrixRowMajor gsPMultiGridOp<T>::lumpedProjection(
+    const gsMultiPatch<T>& mp,
+    const gsMultiBasis<T>& fine,
+    const gsMultiBasis<T>& coarse,
+    const gsBoundaryConditions<T>& bc,
+    const gsOptionList& assemblerOptions
+)
+{
+    typedef typename gsExprAssembler<T>::geometryMap geometryMap;
+    typedef typename gsExprAssembler<T>::space space;
+
+    const bool elim = (dirichlet::strategy)assemblerOptions.askInt("DirichletStrategy",11) == dirichlet::elimination;
+
+    gsExprAssembler<T> ex(1,1);
+    geometryMap G = ex.getMap(mp);
+    space u = ex.getSpace(fine, 1, 0);
+    space v = ex.getTestSpace(u, coarse);
+    if (elim)
+    {
+        u.setup(bc, dirichlet::interpolation, 0);
+        v.setup(bc, dirichlet::interpolation, 0);
+    }
+    else
+    {
+        u.setup(0);
+        v.setup(0);
+    }
+    ex.setIntegrationElements(fine);
+
+    // Mixed mass matrix (coarse x fine)
+    ex.initSystem();
+    ex.assemble(v * meas(G) * u.tr());
+    SpMatrixRowMajor result = ex.matrix().transpose();
+
+    // Lumped mass matrix of the fine basis, i.e., the row sums of the mass matrix
+    gsExprAssembler<T> ex2(1,1);
+    geometryMap G2 = ex2.getMap(mp);
+    space w = ex2.getSpace(fine, 1, 0);
+    if (elim)
+        w.setup(bc, dirichlet::interpolation, 0);
+    else
+        w.setup(0);
+    ex2.setIntegrationElements(fine);
+    ex2.initSystem();
+    ex2.assemble(w * meas(G2));
+    const Matrix lumped = ex2.rhs();
+
+    GISMO_ASSERT( lumped.rows() == result.rows(), "gsPMultiGridOp: Dimensions do not agree." );
+    for (index_t i = 0; i < result.outerSize(); ++i)
+        for (typename SpMatrixRowMajor::InnerIterator it(result, i); it; ++it)
+            it.valueRef() /= lumped(i, 0);
+    return result;
+}
+
+template<class T>
+gsOptionList gsPMultiGridOp<T>::defaultOptions()
+{
+    gsOptionList opt = gsMultiGridOp<T>::defaultOptions();
+    opt.addInt   ("DirichletStrategy", "Method for enforcement of Dirichlet BCs [11..14]", 11 );
+    opt.addInt   ("InterfaceStrategy", "Method of treatment of patch interfaces [0..3]", 1 );
+    opt.addInt   ("Levels"        , "Number of levels", 3 );
+    opt.addString("Coarsening"    , "Coarsening steps (h, p or z), starting with the coarsest one; empty for default", "" );
+    opt.addSwitch("ReduceToLinear", "If true, p and z coarsening reduce the degree to 1, otherwise by 1", false );
+    opt.addInt   ("NumCyclesP"    , "Number of cycles on levels with p or z coarsening", 1 );
+    opt.addString("Smoother"      , "Smoother: BlockILUT, ILUT or GaussSeidel (always GaussSeidel for degree 1)", "BlockILUT" );
+    opt.addInt   ("FillFactor"    , "Fill factor of the incomplete LU factorizations", 1 );
+    return opt;
+}
+
+template<class T>
+void gsPMultiGridOp<T>::setOptions(const gsOptionList & opt)
+{
+    Base::setOptions(opt);
+    m_mg->setOptions(opt);
+
+    // The direct solver on coarsest level is only invoked once
+    const index_t ncP = opt.askInt("NumCyclesP", -1);
+    if (ncP > -1)
+        for (index_t i = 1; i < m_mg->numLevels() - 1; ++i)
+            if (m_coarsening[i] != 'h')
+                m_mg->setNumCycles(i, ncP);
+}
+
+} // namespace gismo
@@ -0,0 +1,10 @@
+#include <gsMultiGrid/gsPMultiGrid.h>
+#include <gsMultiGrid/gsPMultiGrid.hpp>
+
+namespace gismo
+{
+
+CLASS_TEMPLATE_INST gsBlockILUTOp<real_t>;
+CLASS_TEMPLATE_INST gsPMultiGridOp<real_t>;
+
+}
@@ -67,6 +67,104 @@ namespace bspline
         }
     }
 
+    /// Maximal degree for which cardinalCoefs() is available
+    const int cardinalMaxDegree = 10;
+
+    /// Returns the polynomial coefficients of the uniform (cardinal)
+    /// B-splines of degree \a deg on one knot span. For knot spacing
+    /// \a h and \a u = \a t_s + \a t * \a h, \a t in [0,1), the j-th
+    /// active basis function is the sum of result(j,k) * t^k. The
+    /// coefficients are computed once for all degrees up to
+    /// cardinalMaxDegree.
+    template <class T>
+    const gsMatrix<T> & cardinalCoefs(int deg)
+    {
+        GISMO_ASSERT(deg >= 0 && deg <= cardinalMaxDegree, "Degree not supported.");
+        static const std::vector<gsMatrix<T> > coefs = []()
+        {
+            std::vector<gsMatrix<T> > result(cardinalMaxDegree + 1);
+            for (int p = 0; p <= cardinalMaxDegree; ++p)
+            {
+                // B-spline recursion on the knots 0,1,...,2p+1 for the
+                // span [p,p+1); row j holds the j-th active function
+                gsMatrix<T> & N = result[p];
+                N.setZero(p + 1, p + 1);
+                N(0,0) = (T)(1);
+                gsMatrix<T> M;
+                for (int k = 1; k <= p; ++k)
+                {
+                    M.setZero(p + 1, p + 1);
+                    for (int j = 0; j <= k; ++j)
+                    {
+                        if (j > 0) // ((k-j) + t) * N_{j-1}
+                        {
+                            M.row(j).head(k)      += (T)(k - j) * N.row(j-1).head(k);
+                            M.row(j).segment(1,k) += N.row(j-1).head(k);
+                        }
+                        if (j < k) // ((j+1) - t) * N_j
+                        {
+                            M.row(j).head(k)      += (T)(j + 1) * N.row(j).head(k);
+                            M.row(j).segment(1,k) -= N.row(j).head(k);
+                        }
+                    }
+                    N = M / (T)(k);
+                }
+            }
+            return result;
+        }();
+        return coefs[deg];
+    }
+
+    /// Evaluates the Bernstein polynomials of degree \a deg and their
+    /// derivatives up to order \a n at \a t in [0,1]. Column k of the
+    /// (deg+1) x (n+1) column-major array \a result holds the k-th
+    /// derivatives divided by deg!/(deg-k)!, ie. the k-th differences
+    /// of the Bernstein polynomials of degree deg-k.
+    template <class T>
+    void evalBernsteinDers(const T t, const int deg, const int n, T result[])
+    {
+        const int p1 = deg + 1;
+        for (int k = p1; k <= n; ++k)
+            std::fill(result + k * p1, result + (k+1) * p1, (T)(0));
+
+        // Column 0 holds the polynomials of the current degree
+        T * b = result;
+        const T s = (T)(1) - t;
+        b[0] = (T)(1);
+        for (int d = 0; d <= deg; ++d)
+        {
+            if (d > 0) // de Casteljau step from degree d-1 to d
+            {
+                b[d] = t * b[d-1];
+                for (int j = d - 1; j > 0; --j)
+                    b[j] = t * b[j-1] + s * b[j];
+                b[0] *= s;
+            }
+
+            const int k = deg - d; // derivative computed from degree d
+            if (k == 0 || k > n)
+                continue;
+            T * c = result + k * p1;
+            std::copy(b, b + d + 1, c);
+            for (int l = 1; l <= k; ++l) // difference of length d+l
+            {
+                c[d+l] = c[d+l-1];
+                for (int j = d + l - 1; j > 0; --j)
+                    c[j] = c[j-1] - c[j];
+                c[0] = -c[0];
+            }
+        }
+    }
+
+    /// Evaluates the Bernstein polynomials of degree \a deg and their
+    /// derivatives up to order \a n at \a t, cf. evalBernsteinDers
+    template <class T>
+    void evalBernsteinDers(const T t, const int deg, const int n, gsMatrix<T> & result)
+    {
+        result.resize(deg + 1, n + 1);
+        evalBernsteinDers(t, deg, n, result.data());
+    }
+
     /// Evaluation for degree 1 B-spline basis
     template <class T, typename KnotIterator, typename Derived>
     void evalDeg1Basis(  const T & u,
@@ -150,6 +150,8 @@ public:
         std::swap(m_p, other.m_p);
         std::swap(m_periodic, other.m_periodic);
         m_knots.swap(other.m_knots);
+        m_bezOps.swap(other.m_bezOps);
+        m_bezKnots.swap(other.m_bezKnots);
     }
 
 /* Virtual member functions required by the base class */
@@ -597,6 +599,21 @@ public:
     // Look at gsBasis class for a description
     void reverse() { m_knots.reverse(); }
 
+    /// @brief Enables (or disables) the evaluation by Bézier extraction.
+    ///
+    /// The extraction operators, which express the active basis
+    /// functions on each element in the Bernstein basis, are computed
+    /// once by this call. Afterwards, eval_into, deriv_into and
+    /// evalAllDers_into evaluate the Bernstein polynomials and multiply
+    /// them with the operator of the element. Elements whose knots
+    /// were changed after the call (e.g. by refinement) are evaluated
+    /// as usual; call this function again to update the operators.
+    void setBezierExtraction(bool on = true);
+
+    /// @brief Returns true if Bézier extraction operators are stored,
+    /// cf. setBezierExtraction
+    bool hasBezierExtraction() const { return 0 != m_bezOps.size(); }
+
     void matchWith(const boundaryInterface & bi,
                    const gsBasis<T> & other,
                    gsMatrix<index_t> & bndThis,
@@ -610,6 +627,21 @@ protected:
     /// @brief Adjusts endknots so that the knot vector can be made periodic.
     void _stretchEndKnots();
 
+    /// @brief Returns true if the knots of the basis functions which
+    /// are active on the knot span starting at knot \a span are
+    /// equally spaced, so that bspline::cardinalCoefs can be used.
+    bool _isUniformSpan(index_t span) const;
+
+    /// @brief Returns the index of the stored Bézier extraction
+    /// operator of the knot span starting at knot \a span, or -1 if
+    /// there is none or the knots have changed since it was computed.
+    index_t _bezierSpan(index_t span) const;
+
+    /// @brief Writes the product of the Bézier extraction operator \a
+    /// e with the values \a bern of the Bernstein polynomials, scaled
+    /// by \a scale, to \a out
+    void _bezierApply(index_t e, const T bern[], T scale, T out[]) const;
+
 public:
 
     /// @brief Helper function for evaluation with periodic basis.
@@ -667,6 +699,14 @@ protected:
     /// @brief Denotes whether the basis is periodic, ( 0 -- non-periodic, >0 -- number of ``crossing" functions)
     int m_periodic;
 
+    /// @brief Bézier extraction operators of the knot spans, one
+    /// block of m_p+1 columns per span (empty if not enabled)
+    gsMatrix<T> m_bezOps;
+
+    /// @brief The knots m_knots[span-m_p..span+m_p+1] for which the
+    /// operator of each span was computed, one column per span
+    gsMatrix<T> m_bezKnots;
+
     /*/// @brief Multiplicity of the p+1st knot from the beginning and from the end.
       int m_bordKnotMulti;*/
 
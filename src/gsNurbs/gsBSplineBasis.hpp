@@ -256,6 +256,92 @@ index_t gsTensorBSplineBasis<1,T>::twin(index_t i) const
     return i;
 }
 
+template <class T>
+bool gsTensorBSplineBasis<1,T>::_isUniformSpan(index_t span) const
+{
+    // The active functions are defined on the knots span-p,...,span+p+1
+    if ( span < m_p || span + m_p + 1 >= (index_t)m_knots.size() )
+        return false;
+    const T h = m_knots[span+1] - m_knots[span];
+    if ( h <= 0 )
+        return false;
+    for (index_t i = span - m_p; i <= span + m_p; ++i)
+        if ( math::abs(m_knots[i+1] - m_knots[i] - h) > 1e-10 * h )
+            return false;
+    return true;
+}
+
+template <class T>
+void gsTensorBSplineBasis<1,T>::setBezierExtraction(bool on)
+{
+    m_bezOps.resize(0,0);
+    m_bezKnots.resize(0,0);
+    const index_t nSpans = m_knots.size() - 2 * m_p - 1;
+    if ( !on || nSpans <= 0 )
+        return;
+
+    // The Bernstein coefficients of the active functions on a span are
+    // the blossoms at (a,..,a,b,..,b), computed by de Boor's algorithm
+    // with the unit vectors as coefficients
+    const index_t p1 = m_p + 1;
+    m_bezOps.setZero(p1, p1 * nSpans);
+    m_bezKnots.resize(2 * p1, nSpans);
+    gsMatrix<T> d;
+    for (index_t e = 0; e < nSpans; ++e)
+    {
+        const index_t span = e + m_p;
+        const typename KnotVectorType::const_iterator k = m_knots.begin() + (span - m_p);
+        for (index_t i = 0; i < 2 * p1; ++i)
+            m_bezKnots(i,e) = k[i];
+        if ( k[m_p+1] <= k[m_p] ) // empty span, never used
+        {
+            m_bezKnots(0,e) = std::numeric_limits<T>::quiet_NaN();
+            continue;
+        }
+
+        for (index_t j = 0; j <= m_p; ++j) // Bernstein polynomial j
+        {
+            d.setIdentity(p1, p1); // column i: coefficients of function i
+            for (index_t r = 1; r <= m_p; ++r)
+            {
+                const T x = ( r <= m_p - j ? k[m_p] : k[m_p+1] );
+                for (index_t i = m_p; i >= r; --i)
+                {
+                    const T alpha = (x - k[i]) / (k[i+1+m_p-r] - k[i]);
+                    d.row(i) = ((T)(1) - alpha) * d.row(i-1) + alpha * d.row(i);
+                }
+            }
+            m_bezOps.col(e * p1 + j) = d.row(m_p).transpose();
+        }
+    }
+}
+
+template <class T>
+void gsTensorBSplineBasis<1,T>::_bezierApply(index_t e, const T bern[], T scale, T out[]) const
+{
+    const index_t p1 = m_p + 1;
+    const T * op = m_bezOps.data() + e * p1 * p1;
+    for (index_t i = 0; i < p1; ++i, ++op)
+    {
+        T val = (T)(0);
+        for (index_t j = 0; j < p1; ++j)
+            val += op[j * p1] * bern[j];
+        out[i] = scale * val;
+    }
+}
+
+template <class T>
+index_t gsTensorBSplineBasis<1,T>::_bezierSpan(index_t span) const
+{
+    const index_t e = span - m_p;
+    if ( e < 0 || e >= m_bezKnots.cols() || m_bezKnots.rows() != 2 * m_p + 2 )
+        return -1;
+    for (index_t i = 0; i < 2 * m_p + 2; ++i)
+        if ( m_bezKnots(i,e) != m_knots[span - m_p + i] )
+            return -1;
+    return e;
+}
+
 template <class T>
 void gsTensorBSplineBasis<1,T>::eval_into(const gsMatrix<T> & u, gsMatrix<T>& result) const
 {
@@ -328,6 +414,14 @@ void gsTensorBSplineBasis<1,T>::eval_into(const gsMatrix<T> & u, gsMatrix<T>& re
     STACK_ARRAY(T, left, m_p + 1);
     STACK_ARRAY(T, right, m_p + 1);
 
+    // On spans with uniform knots, the polynomial pieces of the
+    // cardinal B-splines are evaluated instead
+    const gsMatrix<T> * cardinal = m_p <= bspline::cardinalMaxDegree ?
+        &bspline::cardinalCoefs<T>(m_p) : NULL;
+    index_t lastSpan = -1, bezSpan = -1;
+    bool uniformSpan = false;
+    STACK_ARRAY(T, bern, 2 * m_p + 2);
+
     for (index_t v = 0; v < u.cols(); ++v) // for all columns of u
     {
         // Check if the point is in the domain
@@ -340,8 +434,35 @@ void gsTensorBSplineBasis<1,T>::eval_into(const gsMatrix<T> & u, gsMatrix<T>& re
 
         // Run evaluation algorithm
 
-        // Get span of absissae
-        unsigned span = m_knots.iFind( u(0,v) ) - m_knots.begin() ;
+        // Get span of absissae; consecutive points often lie in the same span
+        unsigned span = ( -1 != lastSpan && m_knots[lastSpan] <= u(0,v) && u(0,v) < m_knots[lastSpan+1] ) ?
+            lastSpan : m_knots.iFind( u(0,v) ) - m_knots.begin() ;
+
+        if ( (index_t)span != lastSpan )
+        {
+            lastSpan = span;
+            uniformSpan = cardinal && _isUniformSpan(span);
+            bezSpan = hasBezierExtraction() ? _bezierSpan(span) : -1;
+        }
+        if ( uniformSpan )
+        {
+            const T t = (u(0,v) - m_knots[span]) / (m_knots[span+1] - m_knots[span]);
+            for (int j = 0; j <= m_p; ++j)
+            {
+                T val = (*cardinal)(j, m_p);
+                for (int k = m_p - 1; k >= 0; --k)
+                    val = val * t + (*cardinal)(j, k);
+                result(j,v) = val;
+            }
+            continue;
+        }
+        if ( -1 != bezSpan )
+        {
+            const T t = (u(0,v) - m_knots[span]) / (m_knots[span+1] - m_knots[span]);
+            bspline::evalBernsteinDers(t, m_p, 0, bern);
+            _bezierApply(bezSpan, bern, (T)(1), &result(0,v));
+            continue;
+        }
 
         //ndu[0]   = (T)(1);  // 0-th degree function value
         result(0,v)= (T)(1);  // 0-th degree function value
@@ -604,6 +725,14 @@ void gsTensorBSplineBasis<1,T>::deriv_into(const gsMatrix<T> & u, gsMatrix<T>& r
 
     result.resize( m_p + 1, u.cols() ) ;
 
+    // On spans with uniform knots, the polynomial pieces of the
+    // cardinal B-splines are differentiated instead
+    const gsMatrix<T> * cardinal = m_p <= bspline::cardinalMaxDegree ?
+        &bspline::cardinalCoefs<T>(m_p) : NULL;
+    index_t lastSpan = -1, bezSpan = -1;
+    bool uniformSpan = false;
+    STACK_ARRAY(T, bern, 2 * m_p + 2);
+
     for (index_t v = 0; v < u.cols(); ++v) // for all columns of u
     {
         // Check if the point is in the domain
@@ -616,8 +745,38 @@ void gsTensorBSplineBasis<1,T>::deriv_into(const gsMatrix<T> & u, gsMatrix<T>& r
 
         // Run evaluation algorithm and keep first derivative
 
-        // Get span of absissae
-        typename KnotVectorType::iterator span = m_knots.iFind( u(0,v) );
+        // Get span of absissae; consecutive points often lie in the same span
+        typename KnotVectorType::iterator span =
+            ( -1 != lastSpan && m_knots[lastSpan] <= u(0,v) && u(0,v) < m_knots[lastSpan+1] ) ?
+            m_knots.begin() + lastSpan : m_knots.iFind( u(0,v) );
+
+        if ( span - m_knots.begin() != lastSpan )
+        {
+            lastSpan = span - m_knots.begin();
+            uniformSpan = cardinal && _isUniformSpan(lastSpan);
+            bezSpan = hasBezierExtraction() ? _bezierSpan(lastSpan) : -1;
+        }
+        if ( uniformSpan )
+        {
+            // Derivatives of the polynomial pieces
+            const T h = *(span+1) - *span;
+            const T t = (u(0,v) - *span) / h;
+            for (int j = 0; j <= m_p; ++j)
+            {
+                T val = (T)(0);
+                for (int k = m_p; k >= 1; --k)
+                    val = val * t + (T)(k) * (*cardinal)(j, k);
+                result(j,v) = val / h;
+            }
+            continue;
+        }
+        if ( -1 != bezSpan )
+        {
+            const T h = *(span+1) - *span;
+            bspline::evalBernsteinDers((u(0,v) - *span) / h, m_p, 1, bern);
+            _bezierApply(bezSpan, bern + m_p + 1, (T)(m_p) / h, &result(0,v));
+            continue;
+        }
 
         ndu[0]  = (T)(1); // 0-th degree function value
         left[0] = 0;
@@ -960,6 +1119,9 @@ evalAllDers_into(const gsMatrix<T> & u, int n,
 
 #endif
 
+    index_t lastSpan = -1, bezSpan = -1;
+    STACK_ARRAY(T, bern, p1 * (n + 1));
+
     for (index_t v = 0; v < u.cols(); ++v) // for all columns of u
     {
         // Check if the point is in the domain
@@ -973,7 +1135,25 @@ evalAllDers_into(const gsMatrix<T> & u, int n,
         }
 
         // Run evaluation algorithm and keep the function values triangle & the knot differences
-        typename KnotVectorType::iterator span = m_knots.iFind( u(0,v) );
+        typename KnotVectorType::iterator span =
+            ( -1 != lastSpan && m_knots[lastSpan] <= u(0,v) && u(0,v) < m_knots[lastSpan+1] ) ?
+            m_knots.begin() + lastSpan : m_knots.iFind( u(0,v) );
+
+        if ( span - m_knots.begin() != lastSpan )
+        {
+            lastSpan = span - m_knots.begin();
+            bezSpan = hasBezierExtraction() ? _bezierSpan(lastSpan) : -1;
+        }
+        if ( -1 != bezSpan )
+        {
+            // The factor factorial(m_p)/factorial(m_p-k) is applied below
+            const T h = *(span+1) - *span;
+            bspline::evalBernsteinDers((u(0,v) - *span) / h, m_p, n, bern);
+            T hk = (T)(1);
+            for(int k=0; k<=n; k++, hk /= h)
+                _bezierApply(bezSpan, bern + k * p1, hk, &result[k](0,v));
+            continue;
+        }
 
         ndu[0] = (T)(1) ; // 0-th degree function value
         for(int j=1; j<= m_p; j++) // For all degrees ( ndu column)
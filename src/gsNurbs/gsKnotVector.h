@@ -293,7 +293,8 @@ public: // Findspan and value query
     /** \brief Returns the uiterator pointing to the knot at the
      * beginning of the _knot interval_ containing \a u.
      * Note that if `u == *domainUEnd()`, it returns the uiterator
-     * `domainUEnd() - 1`. Cf. \ref knotInterval "knot interval". */
+     * `domainUEnd() - 1`. Cf. \ref knotInterval "knot interval".
+     * For uniform knot vectors, the lookup takes constant time. */
     uiterator uFind( const T u ) const;
 
     /** \brief Returns an iterator to the last occurrence of the knot
@@ -358,6 +359,9 @@ public: // miscellaneous
     /// Returns a unique iterator pointing to the starting knot of the domain.
     uiterator domainUBegin() const
     {
+        // Open knot vectors start with the domain
+        if ( !m_multSum.empty() && m_multSum.front() > m_deg )
+            return ubegin();
         return domainSBegin().uIterator();
         // equivalent:
         //return ubegin() + domainSBegin().uIndex();
@@ -366,6 +370,9 @@ public: // miscellaneous
     /// Returns a unique iterator pointing to the ending knot of the domain.
     uiterator domainUEnd() const
     {
+        // Open knot vectors end with the domain
+        if ( m_multSum.size() > 1 && multLast() > m_deg )
+            return uend() - 1;
         return domainSEnd().uIterator();
         // equivalent:
         //return ubegin() + domainSEnd().uIndex();
@@ -866,7 +873,7 @@ public: // Deprecated functions required by gsCompactKnotVector.
     {
         const T df = *(ubegin() + 1) - *ubegin();
         for( uiterator uit = ubegin() + 1; uit != uend(); ++uit )
-            if( math::abs(*uit - (*uit-(T)(1)) - df) > tol )
+            if( math::abs(*uit - *(uit-1) - df) > tol )
                 return false;
         return true;
     }
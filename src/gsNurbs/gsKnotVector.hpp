@@ -745,8 +745,20 @@ gsKnotVector<T>::uFind( const T u ) const
 
     if (u==*dend) // knot at domain end ?
         return --dend;
-    else
-        return std::upper_bound( domainUBegin(), dend, u ) - 1;
+
+    // Guess the element assuming uniform knots; the guess is
+    // correct for uniform knot vectors, otherwise fall back to
+    // binary search
+    const uiterator dbeg = domainUBegin();
+    const index_t numEl = dend - dbeg;
+    const T pos = (u - *dbeg) * (T)(numEl) / (*dend - *dbeg);
+    if ( pos >= 0 && pos < (T)(numEl) )
+    {
+        const uiterator guess = dbeg + cast<T,index_t>(pos);
+        if ( *guess <= u && u < *(guess+1) )
+            return guess;
+    }
+    return std::upper_bound( dbeg, dend, u ) - 1;
 }
 
 template<typename T>
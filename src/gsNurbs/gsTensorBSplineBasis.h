@@ -265,6 +265,16 @@ public:
             Self_t::component(j).refine_h(i);
     }
 
+    /// \brief Enables (or disables) the evaluation by Bézier
+    /// extraction in all directions.
+    ///
+    /// \copydetails gsBSplineBasis::setBezierExtraction
+    void setBezierExtraction(bool on = true)
+    {
+        for (short_t j = 0; j < d; ++j)
+            Self_t::component(j).setBezierExtraction(on);
+    }
+
     /**
      * \brief Takes a vector of coordinate wise knot values and
      * inserts these values to the basis.  
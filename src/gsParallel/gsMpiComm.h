@@ -249,6 +249,15 @@ public:
         return request;
     }
 
+    /**
+       @brief Returns a pointer to the internal request object
+    */
+    MPI_Request* operator& ()
+    {
+        static MPI_Request req(0);
+        return &req;
+    }
+
     /**
        @brief Returns a constant pointer to the internal request object
     */
@@ -364,6 +373,15 @@ public:
         return 0;
     }
 
+    /** @brief Start the computation of the sum over all processes for
+        each component of an array, non-blocking version
+    */
+    template<typename T>
+    static int isum (T* inout, int len, MPI_Request* req)
+    {
+        return 0;
+    }
+
     /** @brief Compute the product of the argument over all processes
         and return the result in every process. Assumes that T has an
         operator*
@@ -44,6 +44,10 @@ namespace gismo
 ///
 /// but much faster.
 ///
+/// If OpenMP is enabled, the local operators \f$ A_i \f$ are applied in
+/// parallel. So, the same operator object should only be used for several
+/// subspaces if its apply function is thread-safe.
+///
 /// @ingroup Solvers
 
 template<class T>
@@ -22,14 +22,18 @@ void gsAdditiveOp<T>::apply(const gsMatrix<T>& input, gsMatrix<T>& x) const
     x.setZero( input.rows(), input.cols() );
 
     const index_t n = m_ops.size();
-    gsMatrix<T> res_local, corr_local;
+    std::vector< gsMatrix<T> > corr_local(n);
 
+    // The local problems are independent
+#   pragma omp parallel for schedule(dynamic)
     for (index_t i=0; i<n; ++i)
     {
-        res_local.noalias() = m_transfers[i]->transpose()*input;
-        m_ops[i]->apply(res_local, corr_local);
-        x.noalias() += *(m_transfers[i])*corr_local;
+        gsMatrix<T> res_local = m_transfers[i]->transpose()*input;
+        m_ops[i]->apply(res_local, corr_local[i]);
     }
+
+    for (index_t i=0; i<n; ++i)
+        x.noalias() += *(m_transfers[i])*corr_local[i];
 }
 
 } // namespace gismo
@@ -0,0 +1,122 @@
+/** @file gsBlockConjugateGradient.h
+
+    @brief Block conjugate gradient solver for multiple right-hand sides
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#pragma once
+
+#include <gsSolver/gsIterativeSolver.h>
+
+namespace gismo
+{
+
+/// @brief The block conjugate gradient method for multiple right-hand sides.
+///
+/// This is the (preconditioned) breakdown-free block conjugate gradient
+/// method by Ji and Li (Comput. Math. Appl. 73, 2017), a variant of the
+/// method by O'Leary (Linear Algebra Appl. 29, 1980). All columns of the
+/// right-hand side are treated at once: the operator and the
+/// preconditioner are applied to blocks of vectors (for sparse matrices,
+/// as one sparse matrix-matrix product), and each column profits from the
+/// search directions of the others. The block of search directions is
+/// orthonormalized in each step, where (numerically) dependent directions
+/// are dropped, so linearly dependent right-hand sides are admissible.
+///
+/// The convergence is checked for each column separately: a column whose
+/// relative residual is below the tolerance is removed from the block
+/// (deflation), so the remaining iterations only work on the active
+/// columns.
+///
+/// The error is the maximum of the relative residuals of the columns.
+///
+/// \ingroup Solver
+template<class T = real_t>
+class gsBlockConjugateGradient : public gsIterativeSolver<T>
+{
+public:
+    typedef gsIterativeSolver<T> Base;
+
+    typedef gsMatrix<T>  VectorType;
+
+    typedef typename Base::LinOpPtr LinOpPtr;
+
+    typedef memory::shared_ptr<gsBlockConjugateGradient> Ptr;
+    typedef memory::unique_ptr<gsBlockConjugateGradient> uPtr;
+
+    /// @brief Constructor using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    explicit gsBlockConjugateGradient( const OperatorType& mat,
+                                       const LinOpPtr& precond = LinOpPtr() )
+    : Base(mat, precond) {}
+
+    /// @brief Make function using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    static uPtr make( const OperatorType& mat, const LinOpPtr& precond = LinOpPtr() )
+    { return uPtr( new gsBlockConjugateGradient(mat, precond) ); }
+
+    bool initIteration( const VectorType& rhs, VectorType& x );
+    bool step( VectorType& x );
+    void finalizeIteration( VectorType& x );
+
+    /// The relative residual errors of the columns
+    const gsVector<T>& errors() const                          { return m_errors; }
+
+    /// The number of iterations after which the columns have converged
+    const gsVector<index_t>& columnIterations() const          { return m_colIter; }
+
+    /// Prints the object as a string.
+    std::ostream &print(std::ostream &os) const
+    {
+        os << "gsBlockConjugateGradient\n";
+        return os;
+    }
+
+private:
+
+    /// Keeps only the columns \a cols of \a mat
+    static void keepColumns(gsMatrix<T>& mat, const std::vector<index_t>& cols);
+
+    /// @brief Orthonormalizes the columns of \a W
+    ///
+    /// Uses the eigendecomposition of the Gram matrix (twice); directions
+    /// belonging to (numerically) vanishing eigenvalues are dropped.
+    void orthonormalize(gsMatrix<T>& W) const;
+
+private:
+    using Base::m_mat;
+    using Base::m_precond;
+    using Base::m_max_iters;
+    using Base::m_tol;
+    using Base::m_num_iter;
+    using Base::m_rhs_norm;
+    using Base::m_error;
+
+    VectorType m_res;                 ///< Residuals of the active columns
+    VectorType m_update;              ///< Preconditioned residuals
+    VectorType m_dir;                 ///< Orthonormal search directions
+    VectorType m_tmp;                 ///< Operator applied to the search directions
+    gsVector<T> m_rhsNorms;           ///< Norms of the columns of the right-hand side
+    gsVector<T> m_errors;             ///< Relative residual errors of the columns
+    gsVector<index_t> m_colIter;      ///< Iterations needed by the columns
+    std::vector<index_t> m_active;    ///< Columns which have not converged yet
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsBlockConjugateGradient.hpp)
+#endif
@@ -0,0 +1,180 @@
+/** @file gsBlockConjugateGradient.hpp
+
+    @brief Block conjugate gradient solver for multiple right-hand sides
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+namespace gismo
+{
+
+template<class T>
+void gsBlockConjugateGradient<T>::keepColumns(gsMatrix<T>& mat, const std::vector<index_t>& cols)
+{
+    gsMatrix<T> result(mat.rows(), cols.size());
+    for (size_t j = 0; j < cols.size(); ++j)
+        result.col(j) = mat.col(cols[j]);
+    mat.swap(result);
+}
+
+template<class T>
+void gsBlockConjugateGradient<T>::orthonormalize(gsMatrix<T>& W) const
+{
+    for (index_t pass = 0; pass < 2; ++pass)
+    {
+        gsMatrix<T> gram = W.transpose() * W;
+        this->sum(gram);
+        const gsEigen::SelfAdjointEigenSolver<typename gsMatrix<T>::Base> eig(gram);
+        const gsVector<T> ev = eig.eigenvalues();  // in increasing order
+        const index_t s = ev.size();
+        const T tol = s > 0 ? 100 * s * std::numeric_limits<T>::epsilon() * ev[s-1] : T(0);
+        index_t first = 0;
+        while (first < s && ev[first] <= tol)
+            ++first;
+
+        // W is replaced by W U D^{-1/2} for the kept eigenpairs (U,D)
+        const gsMatrix<T> trafo = eig.eigenvectors().rightCols(s-first)
+            * ev.tail(s-first).cwiseSqrt().cwiseInverse().asDiagonal();
+        W = W * trafo;
+    }
+}
+
+template<class T>
+bool gsBlockConjugateGradient<T>::initIteration( const typename gsBlockConjugateGradient<T>::VectorType& rhs,
+                                                 typename gsBlockConjugateGradient<T>::VectorType& x )
+{
+    GISMO_ASSERT( rhs.rows() == m_mat->rows(),
+                  "The right-hand side does not match the matrix: "
+                  << rhs.rows() <<"!="<< m_mat->rows() );
+    const index_t m = rhs.cols();
+    m_num_iter = 0;
+
+    gsMatrix<T> norms = rhs.colwise().squaredNorm();
+    this->sum(norms);
+    m_rhsNorms = norms.transpose().cwiseSqrt();
+    m_rhs_norm = m_rhsNorms.norm();
+
+    if ( 0 == x.size() ) // if no initial solution, start with zeros
+        x.setZero(rhs.rows(), m);
+    else
+    {
+        GISMO_ASSERT( x.cols() == m,
+                      "The initial guess does not match the right-hand side: "
+                      << x.cols() <<"!="<< m );
+        GISMO_ASSERT( x.rows() == m_mat->cols(),
+                      "The initial guess does not match the matrix: "
+                      << x.rows() <<"!="<< m_mat->cols() );
+    }
+    for (index_t j = 0; j < m; ++j)
+        if (0 == m_rhsNorms[j]) // for sure zero is a solution
+            x.col(j).setZero();
+
+    m_mat->apply(x, m_res);
+    m_res = rhs - m_res;
+    norms = m_res.colwise().squaredNorm();
+    this->sum(norms);
+
+    m_errors.setZero(m);
+    m_colIter.setZero(m);
+    m_active.clear();
+    for (index_t j = 0; j < m; ++j)
+    {
+        if (0 != m_rhsNorms[j])
+            m_errors[j] = math::sqrt(norms(0,j)) / m_rhsNorms[j];
+        if (m_errors[j] >= m_tol)
+            m_active.push_back(j);
+    }
+    m_error = m > 0 ? m_errors.maxCoeff() : T(0);
+    if (m_active.empty())
+        return true;
+
+    keepColumns(m_res, m_active);
+    m_precond->apply(m_res, m_update);
+    m_dir = m_update;
+    orthonormalize(m_dir);
+    return false;
+}
+
+template<class T>
+bool gsBlockConjugateGradient<T>::step( typename gsBlockConjugateGradient<T>::VectorType& x )
+{
+    const index_t p = m_dir.cols();
+    const index_t na = m_active.size();
+
+    m_mat->apply(m_dir, m_tmp);
+
+    // The inner products of the search directions with the operator
+    // applied to them and with the residuals are reduced at once
+    gsMatrix<T> pqr(p, p+na);
+    pqr.leftCols(p).noalias() = m_dir.transpose() * m_tmp;
+    pqr.rightCols(na).noalias() = m_dir.transpose() * m_res;
+    this->sum(pqr);
+    const gsEigen::LDLT<typename gsMatrix<T>::Base> pq(pqr.leftCols(p));
+    const gsMatrix<T> alpha = pq.solve(pqr.rightCols(na));
+
+    const gsMatrix<T> dx = m_dir * alpha;
+    for (index_t j = 0; j < na; ++j)
+        x.col(m_active[j]) += dx.col(j);
+    m_res.noalias() -= m_tmp * alpha;
+    m_precond->apply(m_res, m_update);
+
+    // The same for the inner products needed for the new search directions
+    // and the residual norms
+    gsMatrix<T> qz(p+1, na);
+    qz.topRows(p).noalias() = m_tmp.transpose() * m_update;
+    qz.row(p) = m_res.colwise().squaredNorm();
+    this->sum(qz);
+
+    // Deflation of the converged columns
+    std::vector<index_t> keep;
+    for (index_t j = 0; j < na; ++j)
+    {
+        const index_t c = m_active[j];
+        m_errors[c] = math::sqrt(qz(p,j)) / m_rhsNorms[c];
+        if (m_errors[c] < m_tol)
+            m_colIter[c] = m_num_iter;
+        else
+            keep.push_back(j);
+    }
+    m_error = m_errors.maxCoeff();
+    if (keep.empty())
+        return true;
+
+    if ((index_t)keep.size() < na)
+    {
+        keepColumns(m_res, keep);
+        keepColumns(m_update, keep);
+        keepColumns(qz, keep);
+        for (size_t j = 0; j < keep.size(); ++j)
+            m_active[j] = m_active[keep[j]];
+        m_active.resize(keep.size());
+    }
+
+    // The new search directions are A-orthogonal to the previous ones
+    const gsMatrix<T> beta = pq.solve(qz.topRows(p));
+    m_dir = m_update - m_dir * beta;
+    orthonormalize(m_dir);
+    return false;
+}
+
+template<class T>
+void gsBlockConjugateGradient<T>::finalizeIteration( typename gsBlockConjugateGradient<T>::VectorType& )
+{
+    for (size_t j = 0; j < m_active.size(); ++j)
+        if (m_errors[m_active[j]] >= m_tol)
+            m_colIter[m_active[j]] = m_num_iter;
+
+    // cleanup temporaries
+    m_res.clear();
+    m_update.clear();
+    m_dir.clear();
+    m_tmp.clear();
+}
+
+} // namespace gismo
@@ -0,0 +1,134 @@
+/** @file gsBlockGMRes.h
+
+    @brief Block generalized minimal residual method for multiple
+    right-hand sides
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#pragma once
+
+#include <gsSolver/gsIterativeSolver.h>
+
+namespace gismo
+{
+
+/// @brief The block generalized minimal residual (GMRES) method for
+/// multiple right-hand sides.
+///
+/// A block Krylov space is built from the (preconditioned) initial
+/// residuals of all columns: in each step, the operator and the
+/// preconditioner are applied to a block of basis vectors at once (for
+/// sparse matrices, as one sparse matrix-matrix product). The new block
+/// is orthogonalized by block classical Gram-Schmidt with
+/// reorthogonalization and a Cholesky QR factorization, as in
+/// gsSStepGMRes. If the block is (numerically) rank deficient, it is
+/// orthogonalized vector by vector: for linearly dependent initial
+/// residuals (e.g., dependent right-hand sides), the block size is
+/// reduced; later, dependent vectors are replaced by random ones.
+///
+/// As for gsGMRes, the method is left-preconditioned and the storage grows
+/// in chunks. The block Hessenberg matrix is transformed to upper
+/// triangular form by Givens rotations, which yields the residuals of all
+/// columns in each step. The convergence is checked for each column
+/// separately (see errors() and columnIterations()); the method stops
+/// when all columns have converged. One iteration is one block step.
+///
+/// \ingroup Solver
+template<class T = real_t>
+class gsBlockGMRes : public gsIterativeSolver<T>
+{
+public:
+    typedef gsIterativeSolver<T> Base;
+
+    typedef gsMatrix<T>  VectorType;
+
+    typedef typename Base::LinOpPtr LinOpPtr;
+
+    typedef memory::shared_ptr<gsBlockGMRes> Ptr;
+    typedef memory::unique_ptr<gsBlockGMRes> uPtr;
+
+    /// @brief Constructor using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    explicit gsBlockGMRes( const OperatorType& mat, const LinOpPtr& precond = LinOpPtr() )
+    : Base(mat, precond), m_p(0), m_dim(0) {}
+
+    /// @brief Make function using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    static uPtr make( const OperatorType& mat, const LinOpPtr& precond = LinOpPtr() )
+    { return uPtr( new gsBlockGMRes(mat, precond) ); }
+
+    bool initIteration( const VectorType& rhs, VectorType& x );
+    bool step( VectorType& x );
+    void finalizeIteration( VectorType& x );
+
+    /// The relative (preconditioned) residual errors of the columns
+    const gsVector<T>& errors() const                          { return m_errors; }
+
+    /// The number of iterations after which the columns have converged
+    const gsVector<index_t>& columnIterations() const          { return m_colIter; }
+
+    /// Prints the object as a string.
+    std::ostream &print(std::ostream &os) const
+    {
+        os << "gsBlockGMRes\n";
+        return os;
+    }
+
+private:
+
+    /// Makes sure that the storage suffices for \a n basis vectors
+    void reserve(index_t n);
+
+    /// @brief Orthonormalizes the columns of \a W against the first \a j
+    /// basis vectors and each other
+    ///
+    /// Returns R such that W = [V(:,0:j-1), Q] R, where Q overwrites W.
+    /// Columns which depend on the previous vectors are set to zero (if
+    /// \a drop is set) or replaced by random vectors; in both cases, the
+    /// corresponding diagonal entry of R is zero.
+    gsMatrix<T> orthonormalize(index_t j, gsMatrix<T>& W, bool drop = false) const;
+
+    /// Adds the column \a k of the Hessenberg matrix to the QR factorization
+    void rotate(index_t k);
+
+private:
+    using Base::m_mat;
+    using Base::m_precond;
+    using Base::m_max_iters;
+    using Base::m_tol;
+    using Base::m_num_iter;
+    using Base::m_rhs_norm;
+    using Base::m_error;
+
+    index_t m_p;                          ///< Block size
+    index_t m_dim;                        ///< Number of block steps
+    gsMatrix<T> tmp;
+    gsMatrix<T> V;                        ///< Orthonormal basis of the block Krylov space
+    gsMatrix<T> H;                        ///< Block Hessenberg matrix
+    gsMatrix<T> R;                        ///< Hessenberg matrix, transformed to upper triangular form
+    gsMatrix<T> G;                        ///< Transformed right-hand sides of the least squares problems
+    gsMatrix<T> cs, sn;                   ///< Givens rotations, one column per column of H
+    gsVector<T> m_rhsNorms;               ///< Norms of the columns of the right-hand side
+    gsVector<T> m_errors;                 ///< Relative residual errors of the columns
+    gsVector<index_t> m_colIter;          ///< Iterations needed by the columns
+    std::vector<index_t> m_active;        ///< Columns which are solved for
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsBlockGMRes.hpp)
+#endif
@@ -0,0 +1,290 @@
+/** @file gsBlockGMRes.hpp
+
+    @brief Block generalized minimal residual method for multiple
+    right-hand sides
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+namespace gismo
+{
+
+template<class T>
+void gsBlockGMRes<T>::reserve(index_t n)
+{
+    const index_t cap = V.cols();
+    if (n <= cap) return;
+    const index_t newCap = math::max(n, cap + 100);
+    V.conservativeResize(V.rows(), newCap);
+    H.conservativeResizeLike(gsMatrix<T>::Zero(newCap, newCap - m_p));
+    R.conservativeResizeLike(gsMatrix<T>::Zero(newCap, newCap - m_p));
+    G.conservativeResizeLike(gsMatrix<T>::Zero(newCap, G.cols()));
+    cs.conservativeResize(m_p, newCap - m_p);
+    sn.conservativeResize(m_p, newCap - m_p);
+}
+
+template<class T>
+bool gsBlockGMRes<T>::initIteration( const typename gsBlockGMRes<T>::VectorType& rhs,
+                                     typename gsBlockGMRes<T>::VectorType& x )
+{
+    GISMO_ASSERT( rhs.rows() == m_mat->rows(),
+                  "The right-hand side does not match the matrix: "
+                  << rhs.rows() <<"!="<< m_mat->rows() );
+    const index_t m = rhs.cols();
+    m_num_iter = 0;
+
+    gsMatrix<T> norms = rhs.colwise().squaredNorm();
+    this->sum(norms);
+    m_rhsNorms = norms.transpose().cwiseSqrt();
+    m_rhs_norm = m_rhsNorms.norm();
+
+    if ( 0 == x.size() ) // if no initial solution, start with zeros
+        x.setZero(rhs.rows(), m);
+    else
+    {
+        GISMO_ASSERT( x.cols() == m,
+                      "The initial guess does not match the right-hand side: "
+                      << x.cols() <<"!="<< m );
+        GISMO_ASSERT( x.rows() == m_mat->cols(),
+                      "The initial guess does not match the matrix: "
+                      << x.rows() <<"!="<< m_mat->cols() );
+    }
+    for (index_t j = 0; j < m; ++j)
+        if (0 == m_rhsNorms[j]) // for sure zero is a solution
+            x.col(j).setZero();
+
+    gsMatrix<T> residual;
+    m_mat->apply(x,tmp);
+    tmp = rhs - tmp;
+    m_precond->apply(tmp, residual);
+    norms = residual.colwise().squaredNorm();
+    this->sum(norms);
+
+    m_errors.setZero(m);
+    m_colIter.setZero(m);
+    m_active.clear();
+    for (index_t j = 0; j < m; ++j)
+    {
+        if (0 != m_rhsNorms[j])
+            m_errors[j] = math::sqrt(norms(0,j)) / m_rhsNorms[j];
+        if (m_errors[j] >= m_tol)
+            m_active.push_back(j);
+    }
+    m_error = m > 0 ? m_errors.maxCoeff() : T(0);
+    if (m_active.empty())
+        return true;
+
+    // The initial block consists of the residuals of the active columns;
+    // the block size is reduced if they are linearly dependent
+    const index_t na = m_active.size();
+    gsMatrix<T> W(residual.rows(), na);
+    for (index_t j = 0; j < na; ++j)
+        W.col(j) = residual.col(m_active[j]);
+    const gsMatrix<T> C = orthonormalize(0, W, true);
+    std::vector<index_t> keep;
+    for (index_t j = 0; j < na; ++j)
+        if (0 != C(j,j))
+            keep.push_back(j);
+    m_p = keep.size();
+
+    V.resize(W.rows(), 0);
+    H.resize(0, 0);
+    R.resize(0, 0);
+    G.resize(0, na);
+    cs.resize(m_p, 0);
+    sn.resize(m_p, 0);
+    reserve(math::min<index_t>(m_max_iters + 1, 101 / m_p + 1) * m_p);
+    for (index_t j = 0; j < m_p; ++j)
+    {
+        V.col(j) = W.col(keep[j]);
+        G.row(j) = C.row(keep[j]);
+    }
+    m_dim = 0;
+
+    return false;
+}
+
+template<class T>
+gsMatrix<T> gsBlockGMRes<T>::orthonormalize(index_t j, gsMatrix<T>& W, bool drop) const
+{
+    const index_t s = W.cols();
+    gsMatrix<T> result(j+s, s);
+
+    // Block classical Gram-Schmidt with reorthogonalization
+    if (j > 0)
+    {
+        const typename gsMatrix<T>::ConstColsBlockXpr Q = V.leftCols(j);
+        gsMatrix<T> C = Q.transpose() * W;
+        this->sum(C);
+        W.noalias() -= Q * C;
+        gsMatrix<T> C2 = Q.transpose() * W;
+        this->sum(C2);
+        W.noalias() -= Q * C2;
+        result.topRows(j) = C + C2;
+    }
+
+    // Cholesky QR, accepted if the block is not too ill-conditioned
+    gsMatrix<T> Gram = W.transpose() * W;
+    this->sum(Gram);
+    gsEigen::LLT<typename gsMatrix<T>::Base> llt(Gram);
+    if (llt.info() == gsEigen::Success)
+    {
+        const gsMatrix<T> U = llt.matrixU();
+        const gsVector<T> d = U.diagonal().cwiseAbs();
+        if (d.minCoeff() > math::sqrt(std::numeric_limits<T>::epsilon()) * d.maxCoeff())
+        {
+            W = U.template triangularView<gsEigen::Upper>().template solve<gsEigen::OnTheRight>(W);
+            result.bottomRows(s) = U;
+            return result;
+        }
+    }
+
+    // Fallback: modified Gram-Schmidt within the block
+    const T tol = 1000 * std::numeric_limits<T>::epsilon();
+    result.bottomRows(s).setZero();
+    for (index_t c = 0; c < s; ++c)
+    {
+        for (index_t i = 0; i < c; ++i)
+        {
+            const T coef = this->dot(W.col(i), W.col(c));
+            result(j+i, c) = coef;
+            W.col(c) -= coef * W.col(i);
+        }
+        const T nrm = this->norm(W.col(c));
+        if (nrm > tol * math::sqrt(result.col(c).head(j+c).squaredNorm() + nrm*nrm))
+        {
+            result(j+c, c) = nrm;
+            W.col(c) /= nrm;
+            continue;
+        }
+        if (drop)
+        {
+            W.col(c).setZero();
+            continue;
+        }
+
+        // The vector depends on the previous ones: it is replaced by a
+        // random vector orthogonal to them, which does not enter the
+        // Hessenberg matrix
+        W.col(c).setRandom();
+        for (index_t pass = 0; pass < 2; ++pass)
+        {
+            if (j > 0)
+            {
+                gsMatrix<T> coef = V.leftCols(j).transpose() * W.col(c);
+                this->sum(coef);
+                W.col(c) -= V.leftCols(j) * coef;
+            }
+            for (index_t i = 0; i < c; ++i)
+                W.col(c) -= this->dot(W.col(i), W.col(c)) * W.col(i);
+        }
+        W.col(c) /= this->norm(W.col(c));
+    }
+    return result;
+}
+
+template<class T>
+void gsBlockGMRes<T>::rotate(index_t k)
+{
+    const index_t p = m_p;
+    R.col(k).head(k+p+1) = H.col(k).head(k+p+1);
+
+    // Apply the previous rotations to the new column; the rotations of
+    // column c act on the rows (r-1,r) for r = c+p, ..., c+1
+    for (index_t c = 0; c < k; ++c)
+        for (index_t i = 0; i < p; ++i)
+        {
+            const index_t r = c+p-i;
+            const T tmp_r = cs(i,c)*R(r-1,k) + sn(i,c)*R(r,k);
+            R(r,k) = -sn(i,c)*R(r-1,k) + cs(i,c)*R(r,k);
+            R(r-1,k) = tmp_r;
+        }
+
+    // Eliminate the subdiagonal entries from the bottom, then rotate R and G
+    for (index_t i = 0; i < p; ++i)
+    {
+        const index_t r = k+p-i;
+        const T nrm = math::sqrt(R(r-1,k)*R(r-1,k) + R(r,k)*R(r,k));
+        if (0 == nrm)
+        {
+            cs(i,k) = 1;
+            sn(i,k) = 0;
+            continue;
+        }
+        cs(i,k) = R(r-1,k)/nrm;
+        sn(i,k) = R(r,  k)/nrm;
+        R(r-1,k) = nrm;
+        R(r,k) = 0;
+        const gsVector<T> g = G.row(r-1).transpose();
+        G.row(r-1) = cs(i,k)*g.transpose() + sn(i,k)*G.row(r);
+        G.row(r)   = -sn(i,k)*g.transpose() + cs(i,k)*G.row(r);
+    }
+}
+
+template<class T>
+bool gsBlockGMRes<T>::step( typename gsBlockGMRes<T>::VectorType& )
+{
+    // The iterate x is never updated! Use finalizeIteration to obtain x.
+    const index_t p = m_p;
+    const index_t k = m_dim*p;       // First column of the new block of H
+    const index_t j = k+p;           // Current dimension of the Krylov space
+    reserve(j+p);
+
+    // All vectors of the last block are treated at once
+    gsMatrix<T> W;
+    m_mat->apply(V.middleCols(k, p), tmp);
+    m_precond->apply(tmp, W);
+
+    H.block(0, k, j+p, p) = orthonormalize(j, W);
+    V.middleCols(j, p) = W;
+    for (index_t c = 0; c < p; ++c)
+        rotate(k+c);
+    ++m_dim;
+
+    // The residuals of the least squares problems are the last rows of G
+    const gsMatrix<T> res = G.middleRows(j, p).colwise().norm();
+    for (index_t l = 0; l < res.cols(); ++l)
+    {
+        const index_t col = m_active[l];
+        m_errors[col] = res(0,l) / m_rhsNorms[col];
+        if (0 == m_colIter[col] && m_errors[col] < m_tol)
+            m_colIter[col] = m_num_iter;
+    }
+    m_error = m_errors.maxCoeff();
+    return m_error < m_tol;
+}
+
+template<class T>
+void gsBlockGMRes<T>::finalizeIteration( typename gsBlockGMRes<T>::VectorType& x )
+{
+    for (size_t l = 0; l < m_active.size(); ++l)
+        if (0 == m_colIter[m_active[l]])
+            m_colIter[m_active[l]] = m_num_iter;
+
+    //Solve R*Y = G and update the solution
+    const index_t n = m_dim * m_p;
+    if (n > 0)
+    {
+        const gsMatrix<T> Y = R.topLeftCorner(n,n).template triangularView<gsEigen::Upper>().solve(G.topRows(n));
+        const gsMatrix<T> dx = V.leftCols(n) * Y;
+        for (size_t l = 0; l < m_active.size(); ++l)
+            x.col(m_active[l]) += dx.col(l);
+    }
+
+    // cleanup temporaries
+    tmp.clear();
+    V.clear();
+    H.clear();
+    R.clear();
+    G.clear();
+    cs.clear();
+    sn.clear();
+}
+
+} // namespace gismo
@@ -0,0 +1,159 @@
+/** @file gsDistributedMatrixOp.h
+
+    @brief Row-distributed sparse matrix for patch-wise distributed assembly
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#pragma once
+
+#include <gsSolver/gsLinearOperator.h>
+#include <gsParallel/gsMpi.h>
+#include <gsCore/gsDofMapper.h>
+
+namespace gismo
+{
+
+/** @brief
+ *  Row-distributed sparse matrix, obtained by assembling over the patches
+ *  owned by each process.
+ *
+ *  The patches are distributed over the processes of the communicator (see
+ *  partitionPatches). Each process assembles the contributions of its
+ *  patches into a matrix with the global numbering given by a gsDofMapper
+ *  and passes it to the constructor. A degree of freedom is owned by the
+ *  process with the smallest rank among the owners of the patches in whose
+ *  support it lies; the contributions to rows that are not owned (the
+ *  ones on interfaces between patches of different processes) are sent to
+ *  the owner.
+ *
+ *  Afterwards, each process stores its owned rows. The columns are
+ *  numbered locally: first the owned dofs, then the ghost dofs, i.e., the
+ *  dofs owned by other processes which are coupled to owned dofs. Vectors
+ *  are distributed in the same way: each process stores the entries of
+ *  its owned dofs (in the order of ownedDofs()). The operator applies the
+ *  matrix to such vectors, where the values of the ghost dofs are
+ *  exchanged before the local multiplication.
+ *
+ *  Iterative solvers operate on the distributed vectors if the
+ *  communicator is passed to them, see gsIterativeSolver::setCommunicator.
+ *
+ *  Without MPI (or for one process), all dofs are owned and no data is
+ *  exchanged.
+ *
+ *  \ingroup Solver
+ */
+template<class T>
+class gsDistributedMatrixOp : public gsLinearOperator<T>
+{
+public:
+
+    /// Shared pointer for gsDistributedMatrixOp
+    typedef memory::shared_ptr<gsDistributedMatrixOp> Ptr;
+
+    /// Unique pointer for gsDistributedMatrixOp
+    typedef memory::unique_ptr<gsDistributedMatrixOp> uPtr;
+
+    /// Local part of the matrix
+    typedef gsSparseMatrix<T, RowMajor> LocalMatrix;
+
+    /// @brief Constructor
+    ///
+    /// @param comm          The communicator
+    /// @param mapper        The dof mapper of the discretization (the same on all processes)
+    /// @param patchOwner    The rank of the owner of each patch, see partitionPatches
+    /// @param localMatrix   The contributions of the owned patches in global numbering,
+    ///                      i.e., a matrix of size mapper.freeSize()
+    gsDistributedMatrixOp(
+        const gsMpiComm& comm,
+        const gsDofMapper& mapper,
+        const std::vector<index_t>& patchOwner,
+        const gsSparseMatrix<T>& localMatrix
+    );
+
+    /// Make function returning a smart pointer, see constructor
+    static uPtr make(
+        const gsMpiComm& comm,
+        const gsDofMapper& mapper,
+        const std::vector<index_t>& patchOwner,
+        const gsSparseMatrix<T>& localMatrix
+    )
+    { return uPtr( new gsDistributedMatrixOp(comm, mapper, patchOwner, localMatrix) ); }
+
+    /// @brief Distributes the patches over \a nParts processes
+    ///
+    /// Consecutive patches are combined such that the number of elements is
+    /// balanced. Returns the rank of the owner for each patch.
+    static std::vector<index_t> partitionPatches( const gsMultiBasis<T>& mb, index_t nParts );
+
+    /// @brief Returns the patches owned by process \a rank
+    static std::vector<index_t> ownedPatches( const std::vector<index_t>& patchOwner, index_t rank );
+
+    /// Applies the operator to a distributed vector
+    void apply(const gsMatrix<T> & input, gsMatrix<T> & x) const override;
+
+    index_t rows() const override { return m_owned.size(); }
+    index_t cols() const override { return m_owned.size(); }
+
+    /// @brief Sums up the contributions of the owned patches to a vector
+    /// (like the right-hand side) and returns the distributed vector
+    ///
+    /// @param localVector   Contributions of the owned patches in global numbering
+    gsMatrix<T> distribute(const gsMatrix<T>& localVector) const;
+
+    /// @brief Returns the owned part of a vector given in global numbering
+    gsMatrix<T> restrict(const gsMatrix<T>& globalVector) const;
+
+    /// @brief Collects a distributed vector and returns it in global
+    /// numbering on all processes
+    gsMatrix<T> gather(const gsMatrix<T>& distributedVector) const;
+
+    /// @brief Writes the values of the ghost dofs after the owned values
+    ///
+    /// @param[in]  distributedVector   Values of the owned dofs
+    /// @param[out] localVector         Values of the owned dofs, followed by the ghost dofs
+    void exchange(const gsMatrix<T>& distributedVector, gsMatrix<T>& localVector) const;
+
+    /// The owned rows; the columns are the owned dofs followed by the ghost dofs
+    const LocalMatrix& localMatrix() const { return m_matrix; }
+
+    /// The global indices of the owned dofs
+    const std::vector<index_t>& ownedDofs() const { return m_owned; }
+
+    /// The global indices of the ghost dofs
+    const std::vector<index_t>& ghostDofs() const { return m_ghosts; }
+
+    /// The global number of dofs
+    index_t globalSize() const { return m_globalSize; }
+
+    /// The communicator
+    const gsMpiComm& comm() const { return m_comm; }
+
+private:
+
+    /// Gathers arrays of variable length from all processes
+    template<class U>
+    void allgatherv(std::vector<U>& in, std::vector<U>& out) const;
+
+    gsMpiComm m_comm;                       ///< Communicator
+    index_t m_globalSize;                   ///< Global number of dofs
+    std::vector<index_t> m_owner;           ///< Owner of each global dof
+    std::vector<index_t> m_owned;           ///< Global indices of the owned dofs
+    std::vector<index_t> m_ghosts;          ///< Global indices of the ghost dofs
+    LocalMatrix m_matrix;                   ///< Owned rows of the matrix
+    std::vector<index_t> m_shared;          ///< Local indices of owned dofs which are ghosts elsewhere
+    std::vector<index_t> m_ghostPos;        ///< Positions of the ghosts in the gathered shared values
+    std::vector<int> m_sharedCounts;        ///< Number of shared values per process
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsDistributedMatrixOp.hpp)
+#endif
@@ -0,0 +1,294 @@
+/** @file gsDistributedMatrixOp.hpp
+
+    @brief Row-distributed sparse matrix for patch-wise distributed assembly
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#include <gsCore/gsMultiBasis.h>
+
+namespace gismo
+{
+
+template<class T>
+gsDistributedMatrixOp<T>::gsDistributedMatrixOp(
+    const gsMpiComm& comm,
+    const gsDofMapper& mapper,
+    const std::vector<index_t>& patchOwner,
+    const gsSparseMatrix<T>& localMatrix
+)
+: m_comm(comm), m_globalSize(mapper.freeSize())
+{
+    GISMO_ASSERT( localMatrix.rows() == m_globalSize && localMatrix.cols() == m_globalSize,
+                  "gsDistributedMatrixOp: The matrix does not fit to the dof mapper." );
+    GISMO_ASSERT( patchOwner.size() == mapper.numPatches(),
+                  "gsDistributedMatrixOp: The owners of the patches are not given." );
+
+    const index_t rank = m_comm.rank();
+    const index_t nProc = m_comm.size();
+    const index_t N = m_globalSize;
+
+    // Owner of each dof: the smallest rank among the patches it belongs to
+    m_owner.assign(N, nProc);
+    for (size_t k = 0; k < patchOwner.size(); ++k)
+        for (size_t i = 0; i < mapper.patchSize(k); ++i)
+        {
+            const index_t g = mapper.index(i, k);
+            if (mapper.is_free_index(g) && patchOwner[k] < m_owner[g])
+                m_owner[g] = patchOwner[k];
+        }
+
+    std::vector<index_t> local(N, -1);
+    for (index_t g = 0; g < N; ++g)
+    {
+        GISMO_ASSERT( m_owner[g] < nProc, "gsDistributedMatrixOp: The dof "<<g<<" has no owner." );
+        if (m_owner[g] == rank)
+        {
+            local[g] = m_owned.size();
+            m_owned.push_back(g);
+        }
+    }
+    const index_t nOwned = m_owned.size();
+
+    // Keep the owned rows, send the others to their owners
+    std::vector<index_t> keepR, keepC, sendR, sendC;
+    std::vector<T> keepV, sendV;
+    for (index_t j = 0; j < localMatrix.outerSize(); ++j)
+        for (typename gsSparseMatrix<T>::InnerIterator it(localMatrix, j); it; ++it)
+        {
+            if (m_owner[it.row()] == rank)
+            {
+                keepR.push_back(it.row());
+                keepC.push_back(it.col());
+                keepV.push_back(it.value());
+            }
+            else
+            {
+                sendR.push_back(it.row());
+                sendC.push_back(it.col());
+                sendV.push_back(it.value());
+            }
+        }
+    if (nProc > 1)
+    {
+        std::vector<index_t> recvR, recvC;
+        std::vector<T> recvV;
+        allgatherv(sendR, recvR);
+        allgatherv(sendC, recvC);
+        allgatherv(sendV, recvV);
+        for (size_t i = 0; i < recvR.size(); ++i)
+            if (m_owner[recvR[i]] == rank)
+            {
+                keepR.push_back(recvR[i]);
+                keepC.push_back(recvC[i]);
+                keepV.push_back(recvV[i]);
+            }
+    }
+
+    // Ghosts: columns of owned rows which are not owned
+    for (size_t i = 0; i < keepC.size(); ++i)
+        if (m_owner[keepC[i]] != rank)
+            m_ghosts.push_back(keepC[i]);
+    std::sort(m_ghosts.begin(), m_ghosts.end());
+    m_ghosts.erase(std::unique(m_ghosts.begin(), m_ghosts.end()), m_ghosts.end());
+    for (size_t j = 0; j < m_ghosts.size(); ++j)
+        local[m_ghosts[j]] = nOwned + j;
+
+    gsSparseEntries<T> entries;
+    entries.reserve(keepR.size());
+    for (size_t i = 0; i < keepR.size(); ++i)
+        entries.add(local[keepR[i]], local[keepC[i]], keepV[i]);
+    m_matrix.resize(nOwned, nOwned + m_ghosts.size());
+    m_matrix.setFrom(entries);
+    m_matrix.makeCompressed();
+
+    // Communication pattern for the ghosts: the shared dofs (ghosts of
+    // any process) are gathered, ordered by their owners
+    m_sharedCounts.assign(nProc, 0);
+    m_ghostPos.resize(m_ghosts.size());
+    if (nProc > 1)
+    {
+        std::vector<index_t> ghosts(m_ghosts), allGhosts;
+        allgatherv(ghosts, allGhosts);
+        std::sort(allGhosts.begin(), allGhosts.end());
+        allGhosts.erase(std::unique(allGhosts.begin(), allGhosts.end()), allGhosts.end());
+
+        std::vector<index_t> pos(N, -1);
+        std::vector<index_t> offset(nProc + 1, 0);
+        for (size_t i = 0; i < allGhosts.size(); ++i)
+            ++m_sharedCounts[m_owner[allGhosts[i]]];
+        for (index_t q = 0; q < nProc; ++q)
+            offset[q+1] = offset[q] + m_sharedCounts[q];
+        for (size_t i = 0; i < allGhosts.size(); ++i)
+        {
+            const index_t g = allGhosts[i];
+            pos[g] = offset[m_owner[g]]++;
+            if (m_owner[g] == rank)
+                m_shared.push_back(local[g]);
+        }
+        for (size_t j = 0; j < m_ghosts.size(); ++j)
+            m_ghostPos[j] = pos[m_ghosts[j]];
+    }
+}
+
+template<class T>
+std::vector<index_t> gsDistributedMatrixOp<T>::partitionPatches( const gsMultiBasis<T>& mb, index_t nParts )
+{
+    const index_t np = mb.nBases();
+    std::vector<T> size(np);
+    T total = 0;
+    for (index_t k = 0; k < np; ++k)
+        total += ( size[k] = mb.basis(k).numElements() );
+
+    // Each patch goes to the part containing the midpoint of its range
+    std::vector<index_t> result(np);
+    T cum = 0;
+    for (index_t k = 0; k < np; ++k)
+    {
+        const index_t p = cast<T,index_t>( (cum + size[k]/2) / total * nParts );
+        result[k] = math::min(p, nParts - 1);
+        cum += size[k];
+    }
+    return result;
+}
+
+template<class T>
+std::vector<index_t> gsDistributedMatrixOp<T>::ownedPatches( const std::vector<index_t>& patchOwner, index_t rank )
+{
+    std::vector<index_t> result;
+    for (size_t k = 0; k < patchOwner.size(); ++k)
+        if (patchOwner[k] == rank)
+            result.push_back(k);
+    return result;
+}
+
+template<class T>
+void gsDistributedMatrixOp<T>::apply(const gsMatrix<T> & input, gsMatrix<T> & x) const
+{
+    gsMatrix<T> localInput;
+    exchange(input, localInput);
+    x.noalias() = m_matrix * localInput;
+}
+
+template<class T>
+void gsDistributedMatrixOp<T>::exchange(const gsMatrix<T>& distributedVector, gsMatrix<T>& localVector) const
+{
+    GISMO_ASSERT( distributedVector.rows() == (index_t)m_owned.size(), "gsDistributedMatrixOp: Dimensions do not agree." );
+    const index_t nOwned = m_owned.size();
+    const index_t m = distributedVector.cols();
+
+    localVector.resize(nOwned + m_ghosts.size(), m);
+    localVector.topRows(nOwned) = distributedVector;
+    if (m_comm.size() == 1) return;
+
+    std::vector<T> send(m_shared.size() * m), recv;
+    for (index_t c = 0; c < m; ++c)
+        for (size_t i = 0; i < m_shared.size(); ++i)
+            send[c * m_shared.size() + i] = distributedVector(m_shared[i], c);
+
+    std::vector<int> counts(m_sharedCounts), displs(counts.size() + 1, 0);
+    for (size_t q = 0; q < counts.size(); ++q)
+    {
+        counts[q] *= m;
+        displs[q+1] = displs[q] + counts[q];
+    }
+    recv.resize(displs.back());
+    m_comm.allgatherv(send.data(), (int)send.size(), recv.data(), counts.data(), displs.data());
+
+    // The values of each process are stored column by column
+    for (size_t j = 0; j < m_ghosts.size(); ++j)
+    {
+        const index_t q = m_owner[m_ghosts[j]];
+        const index_t p = m_ghostPos[j] - displs[q] / m;
+        for (index_t c = 0; c < m; ++c)
+            localVector(nOwned + j, c) = recv[displs[q] + c * m_sharedCounts[q] + p];
+    }
+}
+
+template<class T>
+gsMatrix<T> gsDistributedMatrixOp<T>::distribute(const gsMatrix<T>& localVector) const
+{
+    GISMO_ASSERT( localVector.rows() == m_globalSize, "gsDistributedMatrixOp: Dimensions do not agree." );
+    const index_t rank = m_comm.rank();
+    const index_t m = localVector.cols();
+
+    gsMatrix<T> result = restrict(localVector);
+    if (m_comm.size() == 1) return result;
+
+    std::vector<index_t> sendR, recvR, local(m_globalSize, -1);
+    std::vector<T> sendV, recvV;
+    for (index_t i = 0; i < m_globalSize; ++i)
+        if (m_owner[i] != rank && !localVector.row(i).isZero(0))
+        {
+            sendR.push_back(i);
+            for (index_t c = 0; c < m; ++c)
+                sendV.push_back(localVector(i, c));
+        }
+    allgatherv(sendR, recvR);
+    allgatherv(sendV, recvV);
+
+    for (size_t i = 0; i < m_owned.size(); ++i)
+        local[m_owned[i]] = i;
+    for (size_t i = 0; i < recvR.size(); ++i)
+        if (m_owner[recvR[i]] == rank)
+            for (index_t c = 0; c < m; ++c)
+                result(local[recvR[i]], c) += recvV[i * m + c];
+    return result;
+}
+
+template<class T>
+gsMatrix<T> gsDistributedMatrixOp<T>::restrict(const gsMatrix<T>& globalVector) const
+{
+    gsMatrix<T> result(m_owned.size(), globalVector.cols());
+    for (size_t i = 0; i < m_owned.size(); ++i)
+        result.row(i) = globalVector.row(m_owned[i]);
+    return result;
+}
+
+template<class T>
+gsMatrix<T> gsDistributedMatrixOp<T>::gather(const gsMatrix<T>& distributedVector) const
+{
+    GISMO_ASSERT( distributedVector.rows() == (index_t)m_owned.size(), "gsDistributedMatrixOp: Dimensions do not agree." );
+    const index_t m = distributedVector.cols();
+    gsMatrix<T> result(m_globalSize, m);
+    if (m_comm.size() == 1)
+    {
+        for (size_t i = 0; i < m_owned.size(); ++i)
+            result.row(m_owned[i]) = distributedVector.row(i);
+        return result;
+    }
+
+    std::vector<index_t> sendR(m_owned), recvR;
+    std::vector<T> sendV(m_owned.size() * m), recvV;
+    for (size_t i = 0; i < m_owned.size(); ++i)
+        for (index_t c = 0; c < m; ++c)
+            sendV[i * m + c] = distributedVector(i, c);
+    allgatherv(sendR, recvR);
+    allgatherv(sendV, recvV);
+    for (size_t i = 0; i < recvR.size(); ++i)
+        for (index_t c = 0; c < m; ++c)
+            result(recvR[i], c) = recvV[i * m + c];
+    return result;
+}
+
+template<class T>
+template<class U>
+void gsDistributedMatrixOp<T>::allgatherv(std::vector<U>& in, std::vector<U>& out) const
+{
+    const index_t nProc = m_comm.size();
+    int n = in.size();
+    std::vector<int> counts(nProc), displs(nProc + 1, 0);
+    m_comm.allgather(&n, 1, counts.data());
+    for (index_t q = 0; q < nProc; ++q)
+        displs[q+1] = displs[q] + counts[q];
+    out.resize(displs.back());
+    m_comm.allgatherv(in.data(), n, out.data(), counts.data(), displs.data());
+}
+
+} // namespace gismo
@@ -0,0 +1,9 @@
+#include <gsSolver/gsDistributedMatrixOp.h>
+#include <gsSolver/gsDistributedMatrixOp.hpp>
+
+namespace gismo
+{
+
+CLASS_TEMPLATE_INST gsDistributedMatrixOp<real_t>;
+
+}
@@ -55,12 +55,9 @@ public:
 
 private:
 
-    /// Solves the Upper triangular system Ry = gg
-    /// and stores the solution in the private member y.
-    void solveUpperTriangular(const VectorType& R, const VectorType& gg)
-    {
-       y = R.template triangularView<gsEigen::Upper>().solve(gg);
-    }
+    /// Makes sure that the storage suffices for \a n basis vectors;
+    /// the storage grows in chunks of 100 vectors
+    void reserve(index_t n);
 
     /// Prints the object as a string.
     std::ostream &print(std::ostream &os) const
@@ -78,11 +75,11 @@ private:
     using Base::m_rhs_norm;
     using Base::m_error;
 
-
-    gsMatrix<T> tmp, g, g_tmp, h_tmp, y, w;
-    gsMatrix<T> residual;
-    gsMatrix<T> H_prev, H, Omega, Omega_prev, Omega_tmp, Omega_prev_tmp;
-    std::vector< gsMatrix<T> > v;
+    gsMatrix<T> tmp, w, residual;
+    gsMatrix<T> V;                        ///< Orthonormal basis of the Krylov space
+    gsMatrix<T> H;                        ///< Hessenberg matrix, transformed to upper triangular form
+    gsVector<T> g;                        ///< Transformed right-hand side of the least squares problem
+    gsVector<T> cs, sn;                   ///< Givens rotations
     T beta;
 };
 
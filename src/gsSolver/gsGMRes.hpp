@@ -11,11 +11,22 @@
     Author(s): J. Sogn
 */
 
-// TODO: Fix matrices sizes such that we don't resize on every iteration! (default can be 100 + 100 +...)
-
 namespace gismo
 {
 
+template<class T>
+void gsGMRes<T>::reserve(index_t n)
+{
+    const index_t cap = V.cols();
+    if (n <= cap) return;
+    const index_t newCap = math::max(n, cap + 100);
+    V.conservativeResize(V.rows(), newCap);
+    H.conservativeResizeLike(gsMatrix<T>::Zero(newCap, newCap - 1));
+    g.conservativeResizeLike(gsVector<T>::Zero(newCap));
+    cs.conservativeResize(newCap - 1);
+    sn.conservativeResize(newCap - 1);
+}
+
 template<class T>
 bool gsGMRes<T>::initIteration( const typename gsGMRes<T>::VectorType& rhs,
                                 typename gsGMRes<T>::VectorType& x )
@@ -26,17 +37,18 @@ bool gsGMRes<T>::initIteration( const typename gsGMRes<T>::VectorType& rhs,
     m_mat->apply(x,tmp);
     tmp = rhs - tmp;
     m_precond->apply(tmp, residual);
-    beta = residual.norm(); // This is  ||r||
+    beta = this->norm(residual); // This is  ||r||
 
     m_error = beta/m_rhs_norm;
     if(m_error < m_tol)
         return true;
 
-    v.push_back(residual/beta);
-    g.setZero(2,1);
-    g(0,0) = beta;
-    Omega = gsMatrix<T>::Identity(2, 2);
-    Omega_prev = gsMatrix<T>::Identity(2, 2);
+    V.resize(residual.rows(), 0);
+    H.resize(0, 0);
+    g.resize(0);
+    reserve(math::min<index_t>(m_max_iters + 1, 101));
+    V.col(0) = residual/beta;
+    g(0) = beta;
 
     return false;
 }
@@ -44,39 +56,23 @@ bool gsGMRes<T>::initIteration( const typename gsGMRes<T>::VectorType& rhs,
 template<class T>
 void gsGMRes<T>::finalizeIteration( typename gsGMRes<T>::VectorType& x )
 {
-    //Remove last row of H and g
-    H.resize(m_num_iter,m_num_iter);
-    H = H_prev.block(0,0,m_num_iter,m_num_iter);
-    g_tmp.resize(m_num_iter,1);
-    g_tmp = g.block(0,0,m_num_iter,1);
-
-    //Solve H*y = g;
-    solveUpperTriangular(H, g_tmp);
-
-    //Create the matrix from the column matrix in v.
-    gsMatrix<T> V(m_mat->rows(),m_num_iter);
-    for (index_t k = 0; k< m_num_iter; ++k)
+    //Solve H*y = g and update the solution
+    const index_t k = m_num_iter;
+    if (k > 0)
     {
-        V.col(k) = v[k];
+        gsVector<T> y = H.topLeftCorner(k,k).template triangularView<gsEigen::Upper>().solve(g.head(k));
+        x.noalias() += V.leftCols(k) * y;
     }
-    //Update solution
-    x += V*y;
 
     // cleanup temporaries
     tmp.clear();
-    g.clear();
-    g_tmp.clear();
-    h_tmp.clear();
-    y.clear();
     w.clear();
     residual.clear();
-    H_prev.clear();
+    V.clear();
     H.clear();
-    Omega.clear();
-    Omega_prev.clear();
-    Omega_tmp.clear();
-    Omega_prev_tmp.clear();
-    v.clear();
+    g.resize(0);
+    cs.resize(0);
+    sn.resize(0);
 }
 
 template<class T>
@@ -84,65 +80,39 @@ bool gsGMRes<T>::step( typename gsGMRes<T>::VectorType& )
 {
     // The iterate x is never updated! Use finalizeIteration to obtain x.
     const index_t k = m_num_iter-1;
-    H.setZero(k+2,k+1);
-    h_tmp.setZero(k+2,1);
-
-    if (k != 0)
-    {
-        H.block(0,0,k+1,k) = H_prev;
-    }
+    reserve(k+2);
 
-    Omega = gsMatrix<T>::Identity(k+2, k+2);
-    m_mat->apply(v[k],tmp);
+    m_mat->apply(V.col(k),tmp);
     m_precond->apply(tmp, w);
 
+    // Arnoldi step (modified Gram-Schmidt)
     for (index_t i = 0; i< k+1; ++i)
     {
-        h_tmp(i,0) = (w.transpose()*v[i]).value(); //Typo h_l,k
-        w = w - h_tmp(i,0)*v[i];
+        H(i,k) = this->dot(w,V.col(i));
+        w.noalias() -= H(i,k)*V.col(i);
     }
-    h_tmp(k+1,0) = w.norm();
-
-  //  if (math::abs(h_tmp(k+1,0)) < 1e-16) //If exact solution
-  //      return true;
-
-    v.push_back(w/h_tmp(k+1,0));
-
-    h_tmp = Omega_prev*h_tmp;
-    H.block(0,k,k+2,1) = h_tmp;
-
-    //Find coef in rotation matrix
-    T sk = H(k+1,k)/(math::sqrt(H(k,k)*H(k,k) + H(k+1,k)*H(k+1,k)));
-    T ck = H(k,  k)/(math::sqrt(H(k,k)*H(k,k) + H(k+1,k)*H(k+1,k)));
-    Omega(k,k)   = ck; Omega(k,k+1)   = sk;
-    Omega(k+1,k) =-sk; Omega(k+1,k+1) = ck;
-
-    //Rotate H and g
-    H = Omega*H;
-    H_prev = H;
-    g_tmp.setZero(k+2,1);
-    if (k != 0)
-        g_tmp.block(0,0,k+1,1) = g;
-    else
-        g_tmp = g;
-    g.noalias() = Omega * g_tmp;
-
-    T residualNorm2 = g(k+1,0)*g(k+1,0);
-    m_error = math::sqrt(residualNorm2) / m_rhs_norm;
-    if(m_error < m_tol)
-        return true;
-
-    //Resize rotation product
-    Omega_prev_tmp.setZero(k+3,k+3);
-    Omega_prev_tmp.block(0,0,k+2,k+2) = Omega_prev;
-    Omega_prev_tmp(k+2,k+2) = 1;
+    H(k+1,k) = this->norm(w);
+    V.col(k+1) = w/H(k+1,k);
 
-    Omega_tmp.setZero(k+3,k+3);
-    Omega_tmp.block(0,0,k+2,k+2) = Omega;
-    Omega_tmp(k+2,k+2) = 1;
+    // Apply the previous rotations to the new column
+    for (index_t i = 0; i < k; ++i)
+    {
+        const T tmp_i = cs[i]*H(i,k) + sn[i]*H(i+1,k);
+        H(i+1,k) = -sn[i]*H(i,k) + cs[i]*H(i+1,k);
+        H(i,k) = tmp_i;
+    }
 
-    Omega_prev = Omega_tmp*Omega_prev_tmp;
-    return false;
+    // Find coef in rotation matrix, then rotate H and g
+    const T nrm = math::sqrt(H(k,k)*H(k,k) + H(k+1,k)*H(k+1,k));
+    cs[k] = H(k,  k)/nrm;
+    sn[k] = H(k+1,k)/nrm;
+    H(k,k) = nrm;
+    H(k+1,k) = 0;
+    g(k+1) = -sn[k]*g(k);
+    g(k)   =  cs[k]*g(k);
+
+    m_error = math::abs(g(k+1)) / m_rhs_norm;
+    return m_error < m_tol;
 }
 
 }
@@ -16,6 +16,7 @@
 #include <gsCore/gsLinearAlgebra.h>
 #include <gsSolver/gsMatrixOp.h>
 #include <gsIO/gsOptionList.h>
+#include <gsParallel/gsMpi.h>
 
 namespace gismo
 {
@@ -46,7 +47,8 @@ public:
       m_tol(1e-10),
       m_num_iter(-1),
       m_rhs_norm(-1),
-      m_error(-1)
+      m_error(-1),
+      m_distributed(false)
     {
         GISMO_ASSERT(m_mat->rows()     == m_mat->cols(),     "The matrix is not square."                     );
 
@@ -76,7 +78,8 @@ public:
       m_tol(1e-10),
       m_num_iter(-1),
       m_rhs_norm(-1),
-      m_error(-1)
+      m_error(-1),
+      m_distributed(false)
     {
         GISMO_ASSERT(m_mat->rows()     == m_mat->cols(),     "The matrix is not square."                     );
 
@@ -179,7 +182,7 @@ public:
 
         m_num_iter = 0;
 
-        m_rhs_norm = rhs.norm();
+        m_rhs_norm = this->norm(rhs);
 
         if (0 == m_rhs_norm) // special case of zero rhs
         {
@@ -216,6 +219,14 @@ public:
     /// Get the underlying matrix/operator to be solved for
     LinOpPtr underlying() const                                { return m_mat; }
 
+    /// @brief Set the communicator for distributed vectors
+    ///
+    /// Afterwards, the vectors are treated as distributed over the
+    /// processes of \a comm (see gsDistributedMatrixOp), i.e., all inner
+    /// products and norms are summed up over the processes. The operator
+    /// and the preconditioner have to act on the distributed vectors.
+    void setCommunicator(const gsMpiComm & comm)               { m_comm = comm; m_distributed = true; }
+
     /// Set the maximum number of iterations (default: 1000)
     void setMaxIterations(index_t max_iters)                   { m_max_iters = max_iters; }
 
@@ -248,6 +259,45 @@ public:
         return os.str();
     }
 
+protected:
+    /// Inner product of two (possibly distributed) vectors
+    template<class Derived1, class Derived2>
+    T dot(const gsEigen::MatrixBase<Derived1>& a, const gsEigen::MatrixBase<Derived2>& b) const
+    {
+        T result = a.col(0).dot(b.col(0));
+        return m_distributed ? m_comm.sum(result) : result;
+    }
+
+    /// Euclidean norm of a (possibly distributed) vector
+    template<class Derived>
+    T norm(const gsEigen::MatrixBase<Derived>& a) const
+    {
+        if (!m_distributed) return a.norm();
+        return math::sqrt(dot(a,a));
+    }
+
+    /// Sums up the local values (e.g., inner products of the local
+    /// parts of distributed vectors) over the processes
+    void sum(gsMatrix<T>& values) const
+    {
+        if (m_distributed) m_comm.sum(values.data(), values.size());
+    }
+
+    /// @brief Starts summing up the local values over the processes
+    ///
+    /// The operation is non-blocking, i.e., other work can be done until
+    /// finishSum is called. The values must not be accessed in between.
+    void startSum(gsMatrix<T>& values, gsMpiRequest& request) const
+    {
+        if (m_distributed) m_comm.isum(values.data(), values.size(), &request);
+    }
+
+    /// Waits until the summation started by startSum is finished
+    void finishSum(gsMpiRequest& request) const
+    {
+        if (m_distributed) request.wait();
+    }
+
 protected:
     const LinOpPtr     m_mat;             ///< The matrix/operator to be solved for
     LinOpPtr           m_precond;         ///< The preconditioner
@@ -256,6 +306,8 @@ protected:
     index_t            m_num_iter;        ///< The number of iterations performed
     T                  m_rhs_norm;        ///< The norm of the right-hand-side
     T                  m_error;           ///< The relative error as absolute_error/m_rhs_norm
+    gsMpiComm          m_comm;            ///< The communicator for distributed vectors
+    bool               m_distributed;     ///< Whether the vectors are distributed
 };
 
 /// \brief Print (as string) operator for iterative solvers
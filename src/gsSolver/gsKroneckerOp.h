@@ -13,6 +13,7 @@
 #pragma once
 
 #include <gsSolver/gsLinearOperator.h>
+#include <gsSolver/gsMatrixOp.h>
 
 namespace gismo
 {
@@ -23,11 +24,17 @@ namespace gismo
 ///
 /// where \f$ A \otimes B = ( a_{11} B \  a_{12} B \ ... ;  a_{21} B \  a_{22} B \ ... ; ... ) \f$.
 ///
+/// If all factors are dense matrices (or transposes of dense matrices),
+/// wrapped as gsMatrixOp, the operator is applied as a sequence of tensor
+/// mode products, each of which is realized by matrix-matrix products
+/// without transposing the intermediate results.
+///
 /// \ingroup Solver
 template <class T>
 class gsKroneckerOp GISMO_FINAL : public gsLinearOperator<T>
 {
     typedef typename gsLinearOperator<T>::Ptr BasePtr;
+    typedef typename gsMatrix<T>::Base DenseMatrix;
 public:
 
     /// Shared pointer for gsKroneckerOp
@@ -82,6 +89,11 @@ public:
     static void apply(const std::vector<BasePtr> & ops, const gsMatrix<T> & input, gsMatrix<T> & x);
 
 private:
+    /// Applies the Kronecker product of dense matrices as a sequence of
+    /// mode products; the factor i is used transposed if \a trans[i] is set
+    static void applyDense(const std::vector<const DenseMatrix*> & mats, const std::vector<bool> & trans,
+                           const gsMatrix<T> & input, gsMatrix<T> & x);
+
     std::vector<BasePtr> m_ops;
 };
 
@@ -27,6 +27,33 @@ void gsKroneckerOp<T>::apply(const std::vector<typename gsLinearOperator<T>::Ptr
         return;
     }
 
+    // Dense factors are applied directly as mode products
+    std::vector<const DenseMatrix*> mats(nrOps);
+    std::vector<bool> trans(nrOps);
+    bool dense = true;
+    for (index_t i = 0; i < nrOps && dense; ++i)
+    {
+        typedef gsMatrixOp< gsMatrix<T> > DenseOp;
+        typedef gsMatrixOp< gsEigen::Transpose<const DenseMatrix> > TransposedDenseOp;
+        if (const DenseOp * op = dynamic_cast<const DenseOp*>(ops[i].get()))
+        {
+            mats[i] = &op->matrix();
+            trans[i] = false;
+        }
+        else if (const TransposedDenseOp * opT = dynamic_cast<const TransposedDenseOp*>(ops[i].get()))
+        {
+            mats[i] = &opT->matrix().nestedExpression();
+            trans[i] = true;
+        }
+        else
+            dense = false;
+    }
+    if (dense)
+    {
+        applyDense(mats, trans, input, x);
+        return;
+    }
+
     //index_t rows = 1; // we don't compute rows as we do not need it
     index_t sz = 1;
 
@@ -80,6 +107,71 @@ void gsKroneckerOp<T>::apply(const std::vector<typename gsLinearOperator<T>::Ptr
     q0.resize(sz, n);
     x.swap( q0 );
 }
+
+template <typename T>
+void gsKroneckerOp<T>::applyDense(const std::vector<const DenseMatrix*> & mats, const std::vector<bool> & trans,
+                                  const gsMatrix<T> & input, gsMatrix<T> & x)
+{
+    const index_t nrOps = mats.size();
+    const index_t n = input.cols();
+
+    // The input is a tensor of order nrOps+1, where the last factor
+    // corresponds to the fastest index and the columns to the slowest one.
+    // Mode i is contracted with factor i; the modes which are already done
+    // (of total size L) come first, the remaining ones (of total size R)
+    // last, so no transposes are needed:
+    //   Y(:,:,r) = X(:,:,r) * A^T    for every r < R
+    index_t sz = 1;
+    for (index_t i = 0; i < nrOps; ++i)
+        sz *= trans[i] ? mats[i]->rows() : mats[i]->cols();
+    GISMO_ASSERT (sz == input.rows(), "The input matrix has wrong size.");
+    sz *= n;
+    index_t L = 1;
+
+    gsMatrix<T> q[2];
+    const T * src = input.data();
+    for (index_t i = nrOps - 1; i >= 0; --i)
+    {
+        const DenseMatrix & A = *mats[i];
+        const bool t = trans[i];
+        const index_t rows_i = t ? A.cols() : A.rows();
+        const index_t cols_i = t ? A.rows() : A.cols();
+        const index_t R = sz / (L * cols_i);
+        gsMatrix<T> & dst = q[i % 2];
+
+        if (L == 1)   // the first mode product is a single GEMM
+        {
+            dst.resize(rows_i, R);
+            gsAsConstMatrix<T> X(src, cols_i, R);
+            if (t)
+                dst.noalias() = A.transpose() * X;
+            else
+                dst.noalias() = A * X;
+        }
+        else          // batch of GEMMs, one for each index of the remaining modes
+        {
+            dst.resize(L * rows_i, R);
+            T * dstData = dst.data();
+#           pragma omp parallel for
+            for (index_t r = 0; r < R; ++r)
+            {
+                gsAsConstMatrix<T> X(src + r * L * cols_i, L, cols_i);
+                gsAsMatrix<T> Y(dstData + r * L * rows_i, L, rows_i);
+                if (t)
+                    Y.noalias() = X * A;
+                else
+                    Y.noalias() = X * A.transpose();
+            }
+        }
+        L *= rows_i;
+        sz = L * R;
+        src = dst.data();
+    }
+
+    gsMatrix<T> & result = q[0];
+    result.resize(L, n);
+    x.swap(result);
+}
 /// @endcond
 
 template <typename T>
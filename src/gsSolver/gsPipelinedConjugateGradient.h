@@ -0,0 +1,127 @@
+/** @file gsPipelinedConjugateGradient.h
+
+    @brief Pipelined conjugate gradient solver
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#pragma once
+
+#include <gsSolver/gsIterativeSolver.h>
+
+namespace gismo
+{
+
+/// @brief The pipelined preconditioned conjugate gradient method.
+///
+/// This is the pipelined variant of the conjugate gradient method by
+/// Ghysels and Vanroose (Parallel Computing 40, 2014). All inner products
+/// of one iteration are combined into a single reduction, which is done
+/// in a non-blocking way while the preconditioner and the operator are
+/// applied. So, for distributed vectors (see
+/// gsIterativeSolver::setCommunicator), there is only one synchronization
+/// per iteration and its latency is hidden.
+///
+/// In exact arithmetic, the iterates coincide with the ones of
+/// gsConjugateGradient. The price are four additional vectors and
+/// additional vector updates. Since the recurrences accumulate rounding
+/// errors faster, the residual and the auxiliary vectors are recomputed
+/// from their definitions every "ReplacementInterval" iterations (residual
+/// replacement, which costs three additional applications of the operator
+/// and one of the preconditioner). The residual is checked at the
+/// beginning of each iteration, so the error reported after a step belongs
+/// to the iterate before that step.
+///
+/// \ingroup Solver
+template<class T = real_t>
+class gsPipelinedConjugateGradient : public gsIterativeSolver<T>
+{
+public:
+    typedef gsIterativeSolver<T> Base;
+
+    typedef gsMatrix<T>  VectorType;
+
+    typedef typename Base::LinOpPtr LinOpPtr;
+
+    typedef memory::shared_ptr<gsPipelinedConjugateGradient> Ptr;
+    typedef memory::unique_ptr<gsPipelinedConjugateGradient> uPtr;
+
+    /// @brief Constructor using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    explicit gsPipelinedConjugateGradient( const OperatorType& mat,
+                                           const LinOpPtr& precond = LinOpPtr() )
+    : Base(mat, precond), m_replacement(50) {}
+
+    /// @brief Make function using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    static uPtr make( const OperatorType& mat, const LinOpPtr& precond = LinOpPtr() )
+    { return uPtr( new gsPipelinedConjugateGradient(mat, precond) ); }
+
+    /// @brief Returns a list of default options
+    static gsOptionList defaultOptions()
+    {
+        gsOptionList opt = Base::defaultOptions();
+        opt.addInt("ReplacementInterval", "Number of iterations after which the residual is "
+                   "recomputed from its definition (0 means never)", 50);
+        return opt;
+    }
+
+    /// @brief Set the options based on a gsOptionList
+    gsPipelinedConjugateGradient& setOptions(const gsOptionList& opt)
+    {
+        Base::setOptions(opt);
+        m_replacement = opt.askInt("ReplacementInterval", m_replacement);
+        return *this;
+    }
+
+    /// Set the number of iterations after which the residual is recomputed (default: 50)
+    void setReplacementInterval(index_t n)                     { m_replacement = n; }
+
+    bool initIteration( const VectorType& rhs, VectorType& x );
+    bool step( VectorType& x );
+    void finalizeIteration( VectorType& x );
+
+    /// Prints the object as a string.
+    std::ostream &print(std::ostream &os) const
+    {
+        os << "gsPipelinedConjugateGradient\n";
+        return os;
+    }
+
+private:
+    using Base::m_mat;
+    using Base::m_precond;
+    using Base::m_max_iters;
+    using Base::m_tol;
+    using Base::m_num_iter;
+    using Base::m_rhs_norm;
+    using Base::m_error;
+
+    index_t m_replacement;  ///< Interval for the residual replacement
+    VectorType m_rhs;       ///< Right-hand side
+    VectorType m_r;         ///< Residual
+    VectorType m_u;         ///< Preconditioned residual
+    VectorType m_w;         ///< Operator applied to m_u
+    VectorType m_m, m_n;    ///< Preconditioner applied to m_w and operator applied to m_m
+    VectorType m_p, m_s, m_q, m_z; ///< Search direction and its images
+    gsMatrix<T> m_dots;     ///< Inner products to be reduced
+    T m_gamma, m_alpha;     ///< Coefficients of the previous iteration
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsPipelinedConjugateGradient.hpp)
+#endif
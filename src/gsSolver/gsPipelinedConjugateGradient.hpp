@@ -0,0 +1,113 @@
+/** @file gsPipelinedConjugateGradient.hpp
+
+    @brief Pipelined conjugate gradient solver
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+namespace gismo
+{
+
+template<class T>
+bool gsPipelinedConjugateGradient<T>::initIteration( const typename gsPipelinedConjugateGradient<T>::VectorType& rhs,
+                                                     typename gsPipelinedConjugateGradient<T>::VectorType& x )
+{
+    if (Base::initIteration(rhs,x))
+        return true;
+
+    const index_t n = m_mat->cols();
+    m_rhs = rhs;
+    m_mat->apply(x,m_r);
+    m_r = rhs - m_r;
+
+    m_error = this->norm(m_r) / m_rhs_norm;
+    if (m_error < m_tol)
+        return true;
+
+    m_precond->apply(m_r,m_u);
+    m_mat->apply(m_u,m_w);
+
+    m_p.setZero(n,1);
+    m_s.setZero(n,1);
+    m_q.setZero(n,1);
+    m_z.setZero(n,1);
+    m_dots.resize(3,1);
+    m_gamma = m_alpha = 0;
+    return false;
+}
+
+template<class T>
+bool gsPipelinedConjugateGradient<T>::step( typename gsPipelinedConjugateGradient<T>::VectorType& x )
+{
+    // All inner products of the iteration are reduced at once; the
+    // communication is overlapped with the preconditioner and the operator
+    m_dots(0,0) = m_r.col(0).dot(m_u.col(0));
+    m_dots(1,0) = m_w.col(0).dot(m_u.col(0));
+    m_dots(2,0) = m_r.col(0).dot(m_r.col(0));
+    gsMpiRequest request;
+    this->startSum(m_dots, request);
+
+    m_precond->apply(m_w,m_m);
+    m_mat->apply(m_m,m_n);
+
+    this->finishSum(request);
+    const T gamma = m_dots(0,0);
+    const T delta = m_dots(1,0);
+
+    m_error = math::sqrt(m_dots(2,0)) / m_rhs_norm;
+    if (m_error < m_tol)
+        return true;
+
+    T alpha, beta;
+    if (m_num_iter == 1)
+    {
+        beta  = 0;
+        alpha = gamma / delta;
+    }
+    else
+    {
+        beta  = gamma / m_gamma;
+        alpha = gamma / (delta - beta * gamma / m_alpha);
+    }
+    m_gamma = gamma;
+    m_alpha = alpha;
+
+    m_z = m_n + beta * m_z;
+    m_q = m_m + beta * m_q;
+    m_s = m_w + beta * m_s;
+    m_p = m_u + beta * m_p;
+
+    x.noalias()   += alpha * m_p;
+    m_r.noalias() -= alpha * m_s;
+    m_u.noalias() -= alpha * m_q;
+    m_w.noalias() -= alpha * m_z;
+
+    // Residual replacement
+    if (m_replacement > 0 && m_num_iter % m_replacement == 0)
+    {
+        m_mat->apply(x,m_r);
+        m_r = m_rhs - m_r;
+        m_precond->apply(m_r,m_u);
+        m_mat->apply(m_u,m_w);
+        m_mat->apply(m_p,m_s);
+        m_precond->apply(m_s,m_q);
+        m_mat->apply(m_q,m_z);
+    }
+    return false;
+}
+
+template<class T>
+void gsPipelinedConjugateGradient<T>::finalizeIteration( typename gsPipelinedConjugateGradient<T>::VectorType& )
+{
+    // cleanup temporaries
+    m_rhs.clear(); m_r.clear(); m_u.clear(); m_w.clear(); m_m.clear(); m_n.clear();
+    m_p.clear(); m_s.clear(); m_q.clear(); m_z.clear();
+}
+
+} // namespace gismo
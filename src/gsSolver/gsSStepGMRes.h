@@ -0,0 +1,138 @@
+/** @file gsSStepGMRes.h
+
+    @brief Preconditioned iterative solver using the s-step variant of the
+    generalized minimal residual method.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+#pragma once
+
+#include <gsSolver/gsIterativeSolver.h>
+
+namespace gismo
+{
+
+/// @brief The s-step (communication-avoiding) variant of the generalized
+/// minimal residual (GMRES) method.
+///
+/// In each step, \a s new basis vectors are generated by applying the
+/// (preconditioned) operator \a s times to the last basis vector (scaled
+/// monomial basis). The block is orthogonalized against the previous
+/// basis by block classical Gram-Schmidt with reorthogonalization, and
+/// orthonormalized by a Cholesky QR factorization. So, for distributed
+/// vectors (see gsIterativeSolver::setCommunicator), there are three
+/// reductions for \a s iterations (instead of about \a s*k reductions in the
+/// k-th step of gsGMRes). The Hessenberg matrix is recovered from the
+/// change of basis. If the Cholesky factorization fails, the block is
+/// orthogonalized vector by vector.
+///
+/// As gsGMRes, the method is left-preconditioned and the storage of the
+/// basis grows in chunks. The number of iterations is the dimension of the
+/// Krylov space, so it grows by \a s in each step.
+///
+/// \ingroup Solver
+template<class T = real_t>
+class gsSStepGMRes : public gsIterativeSolver<T>
+{
+public:
+    typedef gsIterativeSolver<T> Base;
+
+    typedef gsMatrix<T>  VectorType;
+
+    typedef typename Base::LinOpPtr LinOpPtr;
+
+    typedef memory::shared_ptr<gsSStepGMRes> Ptr;
+    typedef memory::unique_ptr<gsSStepGMRes> uPtr;
+
+    /// @brief Constructor using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    explicit gsSStepGMRes( const OperatorType& mat, const LinOpPtr& precond = LinOpPtr() )
+    : Base(mat, precond), m_s(4) {}
+
+    /// @brief Make function using a matrix (operator) and optionally a preconditionner
+    ///
+    /// @param mat     The operator to be solved for, see gsIterativeSolver for details
+    /// @param precond The preconditioner, defaulted to the identity
+    template< typename OperatorType >
+    static uPtr make( const OperatorType& mat, const LinOpPtr& precond = LinOpPtr() )
+    { return uPtr( new gsSStepGMRes(mat, precond) ); }
+
+    /// @brief Returns a list of default options
+    static gsOptionList defaultOptions()
+    {
+        gsOptionList opt = Base::defaultOptions();
+        opt.addInt("StepSize", "Number of basis vectors generated at once (s)", 4);
+        return opt;
+    }
+
+    /// @brief Set the options based on a gsOptionList
+    gsSStepGMRes& setOptions(const gsOptionList& opt)
+    {
+        Base::setOptions(opt);
+        m_s = opt.askInt("StepSize", m_s);
+        return *this;
+    }
+
+    /// Set the number of basis vectors generated at once (default: 4)
+    void setStepSize(index_t s)                                { m_s = s; }
+
+    bool initIteration( const VectorType& rhs, VectorType& x );
+    bool step( VectorType& x );
+    void finalizeIteration( VectorType& x );
+
+    /// Prints the object as a string.
+    std::ostream &print(std::ostream &os) const
+    {
+        os << "gsSStepGMRes (s=" << m_s << ")\n";
+        return os;
+    }
+
+private:
+
+    /// Makes sure that the storage suffices for \a n basis vectors
+    void reserve(index_t n);
+
+    /// @brief Orthonormalizes the columns of \a W against the first \a j
+    /// basis vectors and each other
+    ///
+    /// Returns R such that W = [V(:,0:j-1), Q] R, where Q overwrites W.
+    gsMatrix<T> orthonormalize(index_t j, gsMatrix<T>& W) const;
+
+    /// Adds the column \a k of the Hessenberg matrix to the QR factorization
+    bool rotate(index_t k);
+
+private:
+    using Base::m_mat;
+    using Base::m_precond;
+    using Base::m_max_iters;
+    using Base::m_tol;
+    using Base::m_num_iter;
+    using Base::m_rhs_norm;
+    using Base::m_error;
+
+    index_t m_s;                          ///< Number of basis vectors generated at once
+    T m_sigma;                            ///< Scaling of the monomial basis
+    index_t m_dim;                        ///< Dimension of the Krylov space
+    gsMatrix<T> tmp;
+    gsMatrix<T> V;                        ///< Orthonormal basis of the Krylov space
+    gsMatrix<T> H;                        ///< Hessenberg matrix
+    gsMatrix<T> R;                        ///< Hessenberg matrix, transformed to upper triangular form
+    gsVector<T> g;                        ///< Transformed right-hand side of the least squares problem
+    gsVector<T> cs, sn;                   ///< Givens rotations
+};
+
+} // namespace gismo
+
+#ifndef GISMO_BUILD_LIB
+#include GISMO_HPP_HEADER(gsSStepGMRes.hpp)
+#endif
@@ -0,0 +1,215 @@
+/** @file gsSStepGMRes.hpp
+
+    @brief Preconditioned iterative solver using the s-step variant of the
+    generalized minimal residual method.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): C. Hofer, S. Takacs
+*/
+
+namespace gismo
+{
+
+template<class T>
+void gsSStepGMRes<T>::reserve(index_t n)
+{
+    const index_t cap = V.cols();
+    if (n <= cap) return;
+    const index_t newCap = math::max(n, cap + 100);
+    V.conservativeResize(V.rows(), newCap);
+    H.conservativeResizeLike(gsMatrix<T>::Zero(newCap, newCap - 1));
+    R.conservativeResizeLike(gsMatrix<T>::Zero(newCap, newCap - 1));
+    g.conservativeResizeLike(gsVector<T>::Zero(newCap));
+    cs.conservativeResize(newCap - 1);
+    sn.conservativeResize(newCap - 1);
+}
+
+template<class T>
+bool gsSStepGMRes<T>::initIteration( const typename gsSStepGMRes<T>::VectorType& rhs,
+                                     typename gsSStepGMRes<T>::VectorType& x )
+{
+    GISMO_ASSERT( m_s > 0, "gsSStepGMRes: The step size must be positive." );
+    if (Base::initIteration(rhs,x))
+        return true;
+
+    gsMatrix<T> residual;
+    m_mat->apply(x,tmp);
+    tmp = rhs - tmp;
+    m_precond->apply(tmp, residual);
+    const T beta = this->norm(residual);
+
+    m_error = beta/m_rhs_norm;
+    if(m_error < m_tol)
+        return true;
+
+    V.resize(residual.rows(), 0);
+    H.resize(0, 0);
+    R.resize(0, 0);
+    g.resize(0);
+    reserve(math::min<index_t>(m_max_iters + 1, 101));
+    V.col(0) = residual/beta;
+    g(0) = beta;
+    m_dim = 0;
+    m_sigma = 1;
+
+    return false;
+}
+
+template<class T>
+gsMatrix<T> gsSStepGMRes<T>::orthonormalize(index_t j, gsMatrix<T>& W) const
+{
+    const index_t s = W.cols();
+    gsMatrix<T> result(j+s, s);
+
+    // Block classical Gram-Schmidt with reorthogonalization
+    const typename gsMatrix<T>::ConstColsBlockXpr Q = V.leftCols(j);
+    gsMatrix<T> C = Q.transpose() * W;
+    this->sum(C);
+    W.noalias() -= Q * C;
+    gsMatrix<T> C2 = Q.transpose() * W;
+    this->sum(C2);
+    W.noalias() -= Q * C2;
+    result.topRows(j) = C + C2;
+
+    // Cholesky QR, accepted if the block is not too ill-conditioned
+    gsMatrix<T> G = W.transpose() * W;
+    this->sum(G);
+    gsEigen::LLT<typename gsMatrix<T>::Base> llt(G);
+    if (llt.info() == gsEigen::Success)
+    {
+        const gsMatrix<T> U = llt.matrixU();
+        const gsVector<T> d = U.diagonal().cwiseAbs();
+        if (d.minCoeff() > math::sqrt(std::numeric_limits<T>::epsilon()) * d.maxCoeff())
+        {
+            W = U.template triangularView<gsEigen::Upper>().template solve<gsEigen::OnTheRight>(W);
+            result.bottomRows(s) = U;
+            return result;
+        }
+    }
+
+    // Fallback: modified Gram-Schmidt within the block
+    result.bottomRows(s).setZero();
+    for (index_t c = 0; c < s; ++c)
+    {
+        for (index_t i = 0; i < c; ++i)
+        {
+            const T coef = this->dot(W.col(i), W.col(c));
+            result(j+i, c) = coef;
+            W.col(c) -= coef * W.col(i);
+        }
+        result(j+c, c) = this->norm(W.col(c));
+        W.col(c) /= result(j+c, c);
+    }
+    return result;
+}
+
+template<class T>
+bool gsSStepGMRes<T>::rotate(index_t k)
+{
+    R.col(k).head(k+2) = H.col(k).head(k+2);
+
+    // Apply the previous rotations to the new column
+    for (index_t i = 0; i < k; ++i)
+    {
+        const T tmp_i = cs[i]*R(i,k) + sn[i]*R(i+1,k);
+        R(i+1,k) = -sn[i]*R(i,k) + cs[i]*R(i+1,k);
+        R(i,k) = tmp_i;
+    }
+
+    // Find coef in rotation matrix, then rotate R and g
+    const T nrm = math::sqrt(R(k,k)*R(k,k) + R(k+1,k)*R(k+1,k));
+    cs[k] = R(k,  k)/nrm;
+    sn[k] = R(k+1,k)/nrm;
+    R(k,k) = nrm;
+    R(k+1,k) = 0;
+    g(k+1) = -sn[k]*g(k);
+    g(k)   =  cs[k]*g(k);
+
+    m_error = math::abs(g(k+1)) / m_rhs_norm;
+    return m_error < m_tol;
+}
+
+template<class T>
+bool gsSStepGMRes<T>::step( typename gsSStepGMRes<T>::VectorType& )
+{
+    // The iterate x is never updated! Use finalizeIteration to obtain x.
+    const index_t j = m_dim;
+    const index_t s = math::min(m_s, m_max_iters - j);
+    reserve(j+s+1);
+
+    // Scaled monomial basis: W(:,c) = (M A / sigma)^(c+1) V(:,j)
+    gsMatrix<T> W(V.rows(), s), w;
+    for (index_t c = 0; c < s; ++c)
+    {
+        m_mat->apply(c == 0 ? V.col(j) : W.col(c-1), tmp);
+        m_precond->apply(tmp, w);
+        W.col(c) = w / m_sigma;
+    }
+
+    // [V(:,j), W] = V(:,0:j+s) * B, where B(:,0) is the unit vector e_j
+    gsMatrix<T> B = gsMatrix<T>::Zero(j+s+1, s+1);
+    B(j,0) = 1;
+    B.rightCols(s) = orthonormalize(j+1, W);
+    V.middleCols(j+1, s) = W;
+
+    // From M A [V(:,j), W(:,0:s-2)] = sigma W, we obtain the new columns
+    // of the Hessenberg matrix as (sigma B(:,1:s) - H_old B_old) B_new^{-1}
+    gsMatrix<T> Y = m_sigma * B.rightCols(s);
+    if (j > 0)
+        Y.topRows(j+1).noalias() -= H.topLeftCorner(j+1, j) * B.topLeftCorner(j, s);
+    const gsMatrix<T> Bnew = B.block(j, 0, s, s);
+    Y = Bnew.template triangularView<gsEigen::Upper>().template solve<gsEigen::OnTheRight>(Y);
+    for (index_t c = 0; c < s; ++c)
+    {
+        H.col(j+c).head(j+c+2) = Y.col(c).head(j+c+2);
+        H.col(j+c).segment(j+c+2, s-c-1).setZero();
+    }
+
+    // Adapt the scaling to the growth of the basis vectors
+    if (s > 1)
+    {
+        const T growth = math::pow(math::abs(Bnew(s-1,s-1)), (T)(1)/(s-1));
+        if (growth > 0 && growth < std::numeric_limits<T>::infinity())
+            m_sigma *= growth;
+    }
+
+    for (index_t c = 0; c < s; ++c)
+    {
+        m_dim = j+c+1;
+        if (rotate(j+c))
+        {
+            m_num_iter = m_dim;
+            return true;
+        }
+    }
+    m_num_iter = m_dim;
+    return false;
+}
+
+template<class T>
+void gsSStepGMRes<T>::finalizeIteration( typename gsSStepGMRes<T>::VectorType& x )
+{
+    //Solve R*y = g and update the solution
+    const index_t k = m_dim;
+    if (k > 0)
+    {
+        gsVector<T> y = R.topLeftCorner(k,k).template triangularView<gsEigen::Upper>().solve(g.head(k));
+        x.noalias() += V.leftCols(k) * y;
+    }
+
+    // cleanup temporaries
+    tmp.clear();
+    V.clear();
+    H.clear();
+    R.clear();
+    g.resize(0);
+    cs.resize(0);
+    sn.resize(0);
+}
+
+} // namespace gismo
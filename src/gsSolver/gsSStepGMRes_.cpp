@@ -0,0 +1,9 @@
+#include <gsSolver/gsSStepGMRes.h>
+#include <gsSolver/gsSStepGMRes.hpp>
+
+namespace gismo
+{
+
+CLASS_TEMPLATE_INST gsSStepGMRes<real_t>;
+
+} // namespace gismo
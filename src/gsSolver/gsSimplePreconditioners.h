@@ -24,6 +24,20 @@ template<typename T>
 void gaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f);
 template<typename T>
 void reverseGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f);
+template<typename T>
+void gaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector<index_t>& idx);
+template<typename T>
+void reverseGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector<index_t>& idx);
+template<typename T>
+std::vector< std::vector<index_t> > greedyColoring(const gsSparseMatrix<T> & A);
+template<typename T>
+void multicolorGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector< std::vector<index_t> >& colors);
+template<typename T>
+void reverseMulticolorGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector< std::vector<index_t> >& colors);
+template<typename T>
+T estimateJacobiMaxEigenvalue(const gsSparseMatrix<T> & A, index_t steps);
+template<typename T>
+void chebyshevSweep(const gsSparseMatrix<T> & A, const gsVector<T>& diagInv, gsMatrix<T>& x, const gsMatrix<T>& f, index_t degree, T lmin, T lmax);
 } // namespace internal
 
 /// @brief Richardson preconditioner
@@ -180,9 +194,7 @@ public:
         GISMO_ASSERT( m_expr.rows() == rhs.rows() && m_expr.cols() == m_expr.rows(),
                       "Dimensions do not match.");
 
-        GISMO_ASSERT( rhs.cols() == 1, "This operator is only implemented for a single right-hand side." );
-
-        x.array() += m_tau * ( rhs - m_expr * x ).array() / m_expr.diagonal().array();
+        x.array() += m_tau * ( ( rhs - m_expr * x ).array().colwise() / m_expr.diagonal().array() );
     }
 
     // We use our own apply implementation as we can save one multiplication. This is important if the number
@@ -192,13 +204,11 @@ public:
         GISMO_ASSERT( m_expr.rows() == input.rows() && m_expr.cols() == m_expr.rows(),
                       "Dimensions do not match.");
 
-        GISMO_ASSERT( input.cols() == 1, "This operator is only implemented for a single right-hand side." );
-
         // For the first sweep, we do not need to multiply with the matrix
-        x.array() = m_tau * input.array() / m_expr.diagonal().array();
+        x.array() = m_tau * ( input.array().colwise() / m_expr.diagonal().array() );
 
         for (index_t k = 1; k < m_num_of_sweeps; ++k)
-            x.array() += m_tau * ( input - m_expr * x ).array() / m_expr.diagonal().array();
+            x.array() += m_tau * ( ( input - m_expr * x ).array().colwise() / m_expr.diagonal().array() );
     }
 
     index_t rows() const {return m_expr.rows();}
@@ -388,6 +398,335 @@ template <class Derived>
 typename gsGaussSeidelOp<Derived,gsGaussSeidel::symmetric>::uPtr makeSymmetricGaussSeidelOp(const memory::shared_ptr<Derived>& mat)
 { return gsGaussSeidelOp<Derived,gsGaussSeidel::symmetric>::make(mat); }
 
+/// @brief Local Gauss-Seidel preconditioner
+///
+/// Performs Gauss-Seidel sweeps only over the given subset of the
+/// unknowns, the other unknowns are not modified. For multigrid on
+/// locally refined grids (see gsGridHierarchy::buildByHierarchy), this
+/// restricts the smoothing to the dofs affected by the refinement
+/// (gsGridHierarchy::changedDofs), which keeps the cost of a cycle
+/// proportional to the size of the refined regions.
+///
+/// The transposed step sweeps in reverse order, so the preconditioner
+/// can be used within a symmetric multigrid cycle.
+///
+/// \ingroup Solver
+template <typename MatrixType>
+class gsLocalGaussSeidelOp GISMO_FINAL : public gsPreconditionerOp<typename MatrixType::Scalar>
+{
+    typedef memory::shared_ptr<MatrixType>          MatrixPtr;
+    typedef typename MatrixType::Nested             NestedMatrix;
+
+public:
+    /// Scalar type
+    typedef typename MatrixType::Scalar T;
+
+    /// Shared pointer for gsLocalGaussSeidelOp
+    typedef memory::shared_ptr< gsLocalGaussSeidelOp > Ptr;
+
+    /// Unique pointer for gsLocalGaussSeidelOp
+    typedef memory::unique_ptr< gsLocalGaussSeidelOp > uPtr;
+
+    /// Base class
+    typedef gsPreconditionerOp<T> Base;
+
+    /// Constructor with given matrix and indices of the unknowns to be smoothed
+    gsLocalGaussSeidelOp(const MatrixType& mat, std::vector<index_t> idx)
+    : m_mat(), m_expr(mat.derived()), m_idx(give(idx)) {}
+
+    /// Constructor with shared pointer to matrix and indices of the unknowns to be smoothed
+    gsLocalGaussSeidelOp(const MatrixPtr& mat, std::vector<index_t> idx)
+    : m_mat(mat), m_expr(m_mat->derived()), m_idx(give(idx)) { }
+
+    static uPtr make(const MatrixType& mat, std::vector<index_t> idx)
+    { return memory::make_unique( new gsLocalGaussSeidelOp(mat, give(idx)) ); }
+
+    static uPtr make(const MatrixPtr& mat, std::vector<index_t> idx)
+    { return memory::make_unique( new gsLocalGaussSeidelOp(mat, give(idx)) ); }
+
+    void step(const gsMatrix<T> & rhs, gsMatrix<T> & x) const
+    { internal::gaussSeidelSweep<T>(m_expr,x,rhs,m_idx); }
+
+    void stepT(const gsMatrix<T> & rhs, gsMatrix<T> & x) const
+    { internal::reverseGaussSeidelSweep<T>(m_expr,x,rhs,m_idx); }
+
+    index_t rows() const {return m_expr.rows();}
+    index_t cols() const {return m_expr.cols();}
+
+    /// Returns the indices of the unknowns which are smoothed
+    const std::vector<index_t> & indices() const { return m_idx; }
+
+    /// Returns the matrix
+    NestedMatrix matrix() const { return m_expr; }
+
+    /// Returns a shared pinter to the matrix
+    MatrixPtr    matrixPtr() const {
+        GISMO_ENSURE( m_mat, "A shared pointer is only available if it was provided to gsLocalGaussSeidelOp." );
+        return m_mat;
+    }
+
+    typename gsLinearOperator<T>::Ptr underlyingOp() const { return makeMatrixOp(m_mat); }
+
+private:
+    const MatrixPtr m_mat;  ///< Shared pointer to matrix (if needed)
+    NestedMatrix    m_expr; ///< Nested Eigen expression
+    std::vector<index_t> m_idx; ///< Indices of the unknowns to be smoothed
+};
+
+/// @brief Returns a smart pointer to a local Gauss-Seidel operator referring on \a mat
+/// \relates gsLocalGaussSeidelOp
+template <class Derived>
+typename gsLocalGaussSeidelOp<Derived>::uPtr makeLocalGaussSeidelOp(const gsEigen::EigenBase<Derived>& mat, std::vector<index_t> idx)
+{ return gsLocalGaussSeidelOp<Derived>::make(mat.derived(), give(idx)); }
+
+/// @brief Returns a smart pointer to a local Gauss-Seidel operator referring on \a mat
+/// \relates gsLocalGaussSeidelOp
+template <class Derived>
+typename gsLocalGaussSeidelOp<Derived>::uPtr makeLocalGaussSeidelOp(const memory::shared_ptr<Derived>& mat, std::vector<index_t> idx)
+{ return gsLocalGaussSeidelOp<Derived>::make(mat, give(idx)); }
+
+/// @brief Multicolor Gauss-Seidel preconditioner
+///
+/// The unknowns are colored (greedily) such that unknowns of the same
+/// color are not coupled by the matrix. A sweep visits the colors one
+/// after the other; within a color, the updates are independent and are
+/// computed in parallel (OpenMP). The result depends on the coloring,
+/// but the smoothing properties are comparable to gsGaussSeidelOp.
+///
+/// `ordering` can be `gsGaussSeidel::forward`, `gsGaussSeidel::reverse` or
+/// `gsGaussSeidel::symmetric`, where reverse refers to the order of the
+/// colors.
+///
+/// \ingroup Solver
+template <typename MatrixType, gsGaussSeidel::ordering ordering = gsGaussSeidel::forward>
+class gsMulticolorGaussSeidelOp GISMO_FINAL : public gsPreconditionerOp<typename MatrixType::Scalar>
+{
+    typedef memory::shared_ptr<MatrixType>          MatrixPtr;
+    typedef typename MatrixType::Nested             NestedMatrix;
+
+public:
+    /// Scalar type
+    typedef typename MatrixType::Scalar T;
+
+    /// Shared pointer for gsMulticolorGaussSeidelOp
+    typedef memory::shared_ptr< gsMulticolorGaussSeidelOp > Ptr;
+
+    /// Unique pointer for gsMulticolorGaussSeidelOp
+    typedef memory::unique_ptr< gsMulticolorGaussSeidelOp > uPtr;
+
+    /// Base class
+    typedef gsPreconditionerOp<T> Base;
+
+    /// Constructor with given matrix
+    explicit gsMulticolorGaussSeidelOp(const MatrixType& mat)
+    : m_mat(), m_expr(mat.derived()), m_colors(internal::greedyColoring<T>(m_expr)) {}
+
+    /// Constructor with shared pointer to matrix
+    explicit gsMulticolorGaussSeidelOp(const MatrixPtr& mat)
+    : m_mat(mat), m_expr(m_mat->derived()), m_colors(internal::greedyColoring<T>(m_expr)) { }
+
+    static uPtr make(const MatrixType& mat)
+    { return memory::make_unique( new gsMulticolorGaussSeidelOp(mat) ); }
+
+    static uPtr make(const MatrixPtr& mat)
+    { return memory::make_unique( new gsMulticolorGaussSeidelOp(mat) ); }
+
+    void step(const gsMatrix<T> & rhs, gsMatrix<T> & x) const
+    {
+        if ( ordering == gsGaussSeidel::forward )
+            internal::multicolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+        if ( ordering == gsGaussSeidel::reverse )
+            internal::reverseMulticolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+        if ( ordering == gsGaussSeidel::symmetric )
+        {
+            internal::multicolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+            internal::reverseMulticolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+        }
+    }
+
+    void stepT(const gsMatrix<T> & rhs, gsMatrix<T> & x) const
+    {
+        if ( ordering == gsGaussSeidel::forward )
+            internal::reverseMulticolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+        if ( ordering == gsGaussSeidel::reverse )
+            internal::multicolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+        if ( ordering == gsGaussSeidel::symmetric )
+        {
+            internal::multicolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+            internal::reverseMulticolorGaussSeidelSweep<T>(m_expr,x,rhs,m_colors);
+        }
+    }
+
+    index_t rows() const {return m_expr.rows();}
+    index_t cols() const {return m_expr.cols();}
+
+    /// Returns the number of colors
+    index_t numColors() const { return m_colors.size(); }
+
+    /// Returns the indices of the unknowns of each color
+    const std::vector< std::vector<index_t> > & colors() const { return m_colors; }
+
+    /// Returns the matrix
+    NestedMatrix matrix() const { return m_expr; }
+
+    /// Returns a shared pinter to the matrix
+    MatrixPtr    matrixPtr() const {
+        GISMO_ENSURE( m_mat, "A shared pointer is only available if it was provided to gsMulticolorGaussSeidelOp." );
+        return m_mat;
+    }
+
+    typename gsLinearOperator<T>::Ptr underlyingOp() const { return makeMatrixOp(m_mat); }
+
+private:
+    const MatrixPtr m_mat;  ///< Shared pointer to matrix (if needed)
+    NestedMatrix    m_expr; ///< Nested Eigen expression
+    std::vector< std::vector<index_t> > m_colors; ///< Indices of the unknowns of each color
+};
+
+/// @brief Returns a smart pointer to a multicolor Gauss-Seidel operator referring on \a mat
+/// \relates gsMulticolorGaussSeidelOp
+template <class Derived>
+typename gsMulticolorGaussSeidelOp<Derived>::uPtr makeMulticolorGaussSeidelOp(const gsEigen::EigenBase<Derived>& mat)
+{ return gsMulticolorGaussSeidelOp<Derived>::make(mat.derived()); }
+
+/// @brief Returns a smart pointer to a multicolor Gauss-Seidel operator referring on \a mat
+/// \relates gsMulticolorGaussSeidelOp
+template <class Derived>
+typename gsMulticolorGaussSeidelOp<Derived>::uPtr makeMulticolorGaussSeidelOp(const memory::shared_ptr<Derived>& mat)
+{ return gsMulticolorGaussSeidelOp<Derived>::make(mat); }
+
+/// @brief Returns a smart pointer to a symmetric multicolor Gauss-Seidel operator referring on \a mat
+/// \relates gsMulticolorGaussSeidelOp
+template <class Derived>
+typename gsMulticolorGaussSeidelOp<Derived,gsGaussSeidel::symmetric>::uPtr makeSymmetricMulticolorGaussSeidelOp(const gsEigen::EigenBase<Derived>& mat)
+{ return gsMulticolorGaussSeidelOp<Derived,gsGaussSeidel::symmetric>::make(mat.derived()); }
+
+/// @brief Returns a smart pointer to a symmetric multicolor Gauss-Seidel operator referring on \a mat
+/// \relates gsMulticolorGaussSeidelOp
+template <class Derived>
+typename gsMulticolorGaussSeidelOp<Derived,gsGaussSeidel::symmetric>::uPtr makeSymmetricMulticolorGaussSeidelOp(const memory::shared_ptr<Derived>& mat)
+{ return gsMulticolorGaussSeidelOp<Derived,gsGaussSeidel::symmetric>::make(mat); }
+
+/// @brief Chebyshev polynomial smoother
+///
+/// One step applies the Chebyshev polynomial of the given degree in the
+/// Jacobi preconditioned matrix \f$ D^{-1}A \f$, which damps the part of
+/// the spectrum within \f$ [\lambda_{max}/r, \lambda_{max}] \f$, where
+/// \f$ r \f$ is the eigenvalue ratio. The largest eigenvalue is estimated
+/// with a few Lanczos steps (see gsLanczosMatrix) and enlarged by 10
+/// percent. The smoother only needs matrix-vector products, which are
+/// computed in parallel (OpenMP). The matrix is supposed to be symmetric
+/// and positive definite.
+///
+/// \ingroup Solver
+template <typename MatrixType>
+class gsChebyshevOp GISMO_FINAL : public gsPreconditionerOp<typename MatrixType::Scalar>
+{
+    typedef memory::shared_ptr<MatrixType>          MatrixPtr;
+    typedef typename MatrixType::Nested             NestedMatrix;
+
+public:
+    /// Scalar type
+    typedef typename MatrixType::Scalar T;
+
+    /// Shared pointer for gsChebyshevOp
+    typedef memory::shared_ptr< gsChebyshevOp > Ptr;
+
+    /// Unique pointer for gsChebyshevOp
+    typedef memory::unique_ptr< gsChebyshevOp > uPtr;
+
+    /// Base class
+    typedef gsPreconditionerOp<T> Base;
+
+    /// Constructor with given matrix
+    explicit gsChebyshevOp(const MatrixType& mat, index_t degree = 2)
+    : m_mat(), m_expr(mat.derived()), m_degree(degree), m_ratio(30)
+    { init(); }
+
+    /// Constructor with shared pointer to matrix
+    explicit gsChebyshevOp(const MatrixPtr& mat, index_t degree = 2)
+    : m_mat(mat), m_expr(m_mat->derived()), m_degree(degree), m_ratio(30)
+    { init(); }
+
+    static uPtr make(const MatrixType& mat, index_t degree = 2)
+    { return memory::make_unique( new gsChebyshevOp(mat, degree) ); }
+
+    static uPtr make(const MatrixPtr& mat, index_t degree = 2)
+    { return memory::make_unique( new gsChebyshevOp(mat, degree) ); }
+
+    void step(const gsMatrix<T> & rhs, gsMatrix<T> & x) const
+    { internal::chebyshevSweep<T>(m_expr, m_diagInv, x, rhs, m_degree, m_lmax/m_ratio, m_lmax); }
+
+    index_t rows() const {return m_expr.rows();}
+    index_t cols() const {return m_expr.cols();}
+
+    /// Set the degree of the Chebyshev polynomial
+    void setDegree(index_t degree) { m_degree = degree; }
+
+    /// Set the ratio of the largest and the smallest eigenvalue to be damped
+    void setEigenvalueRatio(T ratio) { m_ratio = ratio; }
+
+    /// Set the upper bound of the spectrum (instead of the Lanczos estimate)
+    void setMaxEigenvalue(T lmax) { m_lmax = lmax; }
+
+    /// Returns the upper bound of the spectrum
+    T maxEigenvalue() const { return m_lmax; }
+
+    /// Get the default options as gsOptionList object
+    static gsOptionList defaultOptions()
+    {
+        gsOptionList opt = Base::defaultOptions();
+        opt.addInt ( "Degree", "Degree of the Chebyshev polynomial", 2 );
+        opt.addReal( "EigenvalueRatio", "Ratio of the largest and the smallest eigenvalue to be damped", 30 );
+        return opt;
+    }
+
+    /// Set options based on a gsOptionList object
+    virtual void setOptions(const gsOptionList & opt)
+    {
+        Base::setOptions(opt);
+        m_degree = opt.askInt ( "Degree", m_degree );
+        m_ratio  = opt.askReal( "EigenvalueRatio", m_ratio );
+    }
+
+    /// Returns the matrix
+    NestedMatrix matrix() const { return m_expr; }
+
+    /// Returns a shared pinter to the matrix
+    MatrixPtr    matrixPtr() const {
+        GISMO_ENSURE( m_mat, "A shared pointer is only available if it was provided to gsChebyshevOp." );
+        return m_mat;
+    }
+
+    typename gsLinearOperator<T>::Ptr underlyingOp() const { return makeMatrixOp(m_mat); }
+
+private:
+    void init()
+    {
+        m_diagInv = m_expr.diagonal().cwiseInverse();
+        m_lmax = (T)(1.1) * internal::estimateJacobiMaxEigenvalue<T>(m_expr, 10);
+    }
+
+    const MatrixPtr m_mat;  ///< Shared pointer to matrix (if needed)
+    NestedMatrix    m_expr; ///< Nested Eigen expression
+    gsVector<T> m_diagInv;  ///< Inverse of the diagonal
+    index_t m_degree;       ///< Degree of the Chebyshev polynomial
+    T m_ratio;              ///< Ratio of the largest and the smallest eigenvalue to be damped
+    T m_lmax;               ///< Upper bound of the spectrum of the Jacobi preconditioned matrix
+};
+
+/// @brief Returns a smart pointer to a Chebyshev smoother referring on \a mat
+/// \relates gsChebyshevOp
+template <class Derived>
+typename gsChebyshevOp<Derived>::uPtr makeChebyshevOp(const gsEigen::EigenBase<Derived>& mat, index_t degree = 2)
+{ return gsChebyshevOp<Derived>::make(mat.derived(), degree); }
+
+/// @brief Returns a smart pointer to a Chebyshev smoother referring on \a mat
+/// \relates gsChebyshevOp
+template <class Derived>
+typename gsChebyshevOp<Derived>::uPtr makeChebyshevOp(const memory::shared_ptr<Derived>& mat, index_t degree = 2)
+{ return gsChebyshevOp<Derived>::make(mat, degree); }
+
 /// @brief  Incomplete LU with thresholding preconditioner
 ///
 /// \ingroup Solvers
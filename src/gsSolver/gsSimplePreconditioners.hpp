@@ -11,6 +11,8 @@
     Author(s): C. Hofreither
 */
 
+#include <gsSolver/gsLanczosMatrix.h>
+
 namespace gismo
 {
 
@@ -67,6 +69,221 @@ void reverseGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const
     }
 }
 
+template<typename T>
+void gaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector<index_t>& idx)
+{
+    GISMO_ASSERT( A.rows() == x.rows() && x.rows() == f.rows() && A.cols() == A.rows() && x.cols() == f.cols(),
+        "Dimensions do not match.");
+
+    GISMO_ASSERT( f.cols() == 1, "This operator is only implemented for a single right-hand side." );
+
+    // A is supposed to be symmetric, so it doesn't matter if it's stored in row- or column-major order
+    for (size_t k = 0; k < idx.size(); ++k)
+    {
+        const index_t i = idx[k];
+        T diag = 0;
+        T sum  = 0;
+
+        for (typename gsSparseMatrix<T>::InnerIterator it(A,i); it; ++it)
+        {
+            sum += it.value() * x( it.index() );        // compute A.x
+            if (it.index() == i)
+                diag = it.value();
+        }
+
+        x(i) += (f(i) - sum) / diag;
+    }
+}
+
+template<typename T>
+void reverseGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector<index_t>& idx)
+{
+    GISMO_ASSERT( A.rows() == x.rows() && x.rows() == f.rows() && A.cols() == A.rows() && x.cols() == f.cols(),
+        "Dimensions do not match.");
+
+    GISMO_ASSERT( f.cols() == 1, "This operator is only implemented for a single right-hand side." );
+
+    // A is supposed to be symmetric, so it doesn't matter if it's stored in row- or column-major order
+    for (size_t k = idx.size(); k-- > 0; )
+    {
+        const index_t i = idx[k];
+        T diag = 0;
+        T sum  = 0;
+
+        for (typename gsSparseMatrix<T>::InnerIterator it(A,i); it; ++it)
+        {
+            sum += it.value() * x( it.index() );        // compute A.x
+            if (it.index() == i)
+                diag = it.value();
+        }
+
+        x(i) += (f(i) - sum) / diag;
+    }
+}
+
+template<typename T>
+std::vector< std::vector<index_t> > greedyColoring(const gsSparseMatrix<T> & A)
+{
+    GISMO_ASSERT( A.cols() == A.rows(), "The matrix is not square." );
+
+    // A is supposed to be symmetric, so it doesn't matter if it's stored in row- or column-major order
+    const index_t n = A.outerSize();
+    std::vector<index_t> color(n, -1);
+    std::vector<index_t> usedBy;  // usedBy[c] == i if color c is taken by a neighbor of i
+    std::vector< std::vector<index_t> > result;
+    for (index_t i = 0; i < n; ++i)
+    {
+        for (typename gsSparseMatrix<T>::InnerIterator it(A,i); it; ++it)
+            if (color[it.index()] >= 0)
+                usedBy[color[it.index()]] = i;
+
+        index_t c = 0;
+        while (c < (index_t)usedBy.size() && usedBy[c] == i)
+            ++c;
+        if (c == (index_t)usedBy.size())
+        {
+            usedBy.push_back(-1);
+            result.push_back(std::vector<index_t>());
+        }
+        color[i] = c;
+        result[c].push_back(i);
+    }
+    return result;
+}
+
+template<typename T>
+void multicolorGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector< std::vector<index_t> >& colors)
+{
+    GISMO_ASSERT( A.rows() == x.rows() && x.rows() == f.rows() && A.cols() == A.rows() && x.cols() == f.cols(),
+        "Dimensions do not match.");
+
+    GISMO_ASSERT( f.cols() == 1, "This operator is only implemented for a single right-hand side." );
+
+    // The unknowns of one color are not coupled, so they are updated in parallel
+    for (size_t c = 0; c < colors.size(); ++c)
+    {
+        const std::vector<index_t> & idx = colors[c];
+        const index_t nc = idx.size();
+#       pragma omp parallel for
+        for (index_t k = 0; k < nc; ++k)
+        {
+            const index_t i = idx[k];
+            T diag = 0;
+            T sum  = 0;
+
+            for (typename gsSparseMatrix<T>::InnerIterator it(A,i); it; ++it)
+            {
+                sum += it.value() * x( it.index() );        // compute A.x
+                if (it.index() == i)
+                    diag = it.value();
+            }
+
+            x(i) += (f(i) - sum) / diag;
+        }
+    }
+}
+
+template<typename T>
+void reverseMulticolorGaussSeidelSweep(const gsSparseMatrix<T> & A, gsMatrix<T>& x, const gsMatrix<T>& f, const std::vector< std::vector<index_t> >& colors)
+{
+    GISMO_ASSERT( A.rows() == x.rows() && x.rows() == f.rows() && A.cols() == A.rows() && x.cols() == f.cols(),
+        "Dimensions do not match.");
+
+    GISMO_ASSERT( f.cols() == 1, "This operator is only implemented for a single right-hand side." );
+
+    for (size_t c = colors.size(); c-- > 0; )
+    {
+        const std::vector<index_t> & idx = colors[c];
+        const index_t nc = idx.size();
+#       pragma omp parallel for
+        for (index_t k = 0; k < nc; ++k)
+        {
+            const index_t i = idx[k];
+            T diag = 0;
+            T sum  = 0;
+
+            for (typename gsSparseMatrix<T>::InnerIterator it(A,i); it; ++it)
+            {
+                sum += it.value() * x( it.index() );        // compute A.x
+                if (it.index() == i)
+                    diag = it.value();
+            }
+
+            x(i) += (f(i) - sum) / diag;
+        }
+    }
+}
+
+template<typename T>
+T estimateJacobiMaxEigenvalue(const gsSparseMatrix<T> & A, index_t steps)
+{
+    GISMO_ASSERT( A.cols() == A.rows(), "The matrix is not square." );
+
+    // Lanczos iteration for D^{-1}A, which is self-adjoint with respect
+    // to the scalar product induced by D
+    const gsVector<T> diag = A.diagonal();
+    std::vector<T> delta, gamma;
+    gsVector<T> v(A.rows()), vOld, w;
+    v.setRandom();
+    v /= math::sqrt( v.dot(diag.cwiseProduct(v)) );
+    vOld.setZero(A.rows());
+    T beta = 0;
+    const index_t numSteps = math::min(steps, (index_t)A.rows());
+    for (index_t k = 0; k < numSteps; ++k)
+    {
+        w.noalias() = A * v;
+        const T alpha = v.dot(w);
+        w = w.cwiseQuotient(diag) - alpha * v - beta * vOld;
+        delta.push_back(alpha);
+        beta = math::sqrt( w.dot(diag.cwiseProduct(w)) );
+        if (k == numSteps-1 || beta == 0)
+            break;
+        gamma.push_back(beta);
+        vOld.swap(v);
+        v = w / beta;
+    }
+    return gsLanczosMatrix<T>(gamma, delta).maxEigenvalue();
+}
+
+template<typename T>
+void chebyshevSweep(const gsSparseMatrix<T> & A, const gsVector<T>& diagInv, gsMatrix<T>& x, const gsMatrix<T>& f, index_t degree, T lmin, T lmax)
+{
+    GISMO_ASSERT( A.rows() == x.rows() && x.rows() == f.rows() && A.cols() == A.rows() && x.cols() == f.cols(),
+        "Dimensions do not match.");
+
+    GISMO_ASSERT( f.cols() == 1, "This operator is only implemented for a single right-hand side." );
+
+    const index_t n = A.outerSize();
+    const T theta = (lmax + lmin) / 2;
+    const T delta = (lmax - lmin) / 2;
+    const T sigma = theta / delta;
+    T rho = 1 / sigma;
+
+    // The update d is initialized with the scaled Jacobi correction, then
+    // the three-term recurrence of the Chebyshev polynomials is applied
+    gsMatrix<T> d(n, 1);
+    T a = 0, b = 1 / theta;
+    for (index_t k = 0; k < degree; ++k)
+    {
+        // A is supposed to be symmetric, so it doesn't matter if it's stored in row- or column-major order
+#       pragma omp parallel for
+        for (index_t i = 0; i < n; ++i)
+        {
+            T sum = 0;
+            for (typename gsSparseMatrix<T>::InnerIterator it(A,i); it; ++it)
+                sum += it.value() * x( it.index() );        // compute A.x
+            const T r = diagInv(i) * (f(i) - sum);
+            d(i) = (k == 0 ? b * r : a * d(i) + b * r);
+        }
+        x += d;
+
+        const T rhoNew = 1 / (2 * sigma - rho);
+        a = rhoNew * rho;
+        b = 2 * rhoNew / delta;
+        rho = rhoNew;
+    }
+}
+
 } // namespace internal
 
 } // namespace gismo
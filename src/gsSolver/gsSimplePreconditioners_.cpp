@@ -9,6 +9,13 @@ namespace internal
 
 TEMPLATE_INST void gaussSeidelSweep(const gsSparseMatrix<real_t> & A, gsMatrix<real_t>& x, const gsMatrix<real_t>& f);
 TEMPLATE_INST void reverseGaussSeidelSweep(const gsSparseMatrix<real_t> & A, gsMatrix<real_t>& x, const gsMatrix<real_t>& f);
+TEMPLATE_INST void gaussSeidelSweep(const gsSparseMatrix<real_t> & A, gsMatrix<real_t>& x, const gsMatrix<real_t>& f, const std::vector<index_t>& idx);
+TEMPLATE_INST void reverseGaussSeidelSweep(const gsSparseMatrix<real_t> & A, gsMatrix<real_t>& x, const gsMatrix<real_t>& f, const std::vector<index_t>& idx);
+TEMPLATE_INST std::vector< std::vector<index_t> > greedyColoring(const gsSparseMatrix<real_t> & A);
+TEMPLATE_INST void multicolorGaussSeidelSweep(const gsSparseMatrix<real_t> & A, gsMatrix<real_t>& x, const gsMatrix<real_t>& f, const std::vector< std::vector<index_t> >& colors);
+TEMPLATE_INST void reverseMulticolorGaussSeidelSweep(const gsSparseMatrix<real_t> & A, gsMatrix<real_t>& x, const gsMatrix<real_t>& f, const std::vector< std::vector<index_t> >& colors);
+TEMPLATE_INST real_t estimateJacobiMaxEigenvalue(const gsSparseMatrix<real_t> & A, index_t steps);
+TEMPLATE_INST void chebyshevSweep(const gsSparseMatrix<real_t> & A, const gsVector<real_t>& diagInv, gsMatrix<real_t>& x, const gsMatrix<real_t>& f, index_t degree, real_t lmin, real_t lmax);
 
 } // namespace internal
 
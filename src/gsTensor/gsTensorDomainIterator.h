@@ -122,6 +122,7 @@ public:
     {
         curElement = meshStart;
         m_isGood = ( meshEnd.array() != meshStart.array() ).all() ;
+        m_id = 0;
         if (m_isGood)
             update();
     }
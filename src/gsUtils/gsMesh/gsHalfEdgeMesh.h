@@ -15,6 +15,7 @@
 
 #include <gsUtils/gsMesh/gsMesh.h>
 #include <queue>
+#include <unordered_map>
 
 namespace gismo
 {
@@ -782,6 +783,7 @@ private:
 
     std::vector<index_t> m_inverseSorting; ///< vector of indices s. t. m_inverseSorting[internVertexIndex] = vertexIndex
     std::vector<index_t> m_sorting; ///< vector that stores the internVertexIndices s. t. m_sorting[vertexIndex-1] = internVertexIndex
+    std::vector<std::vector<size_t> > m_vertexTriangles; ///< indices of the triangles adjacent to each vertex (by intern vertex index)
     T m_precision;
 
 
@@ -51,6 +51,11 @@ gsHalfEdgeMesh<T>::gsHalfEdgeMesh(const gsMesh<T> &mesh, T precision, bool perio
     m_boundary = Boundary(m_halfedges);
     m_n = this->m_vertex.size() - m_boundary.getNumberOfVertices();
     sortVertices();
+
+    m_vertexTriangles.resize(this->m_vertex.size());
+    for (size_t i = 0; i < this->m_face.size(); i++)
+        for (size_t j = 0; j < 3; j++)
+            m_vertexTriangles[this->m_face[i]->vertices[j]->getId()].push_back(i);
 }
 
 template<class T>
@@ -202,8 +207,10 @@ gsHalfEdgeMesh<T>::getOppositeHalfedges(const size_t vertexIndex, const bool inn
     }
 
     size_t v1, v2, v3;
-    for (size_t i = 0; i < getNumberOfTriangles(); i++)
+    const std::vector<size_t> & triangles = m_vertexTriangles[m_sorting[vertexIndex - 1]];
+    for (std::vector<size_t>::const_iterator it = triangles.begin(); it != triangles.end(); ++it)
     {
+        const size_t i = *it;
         switch (isTriangleVertex(vertexIndex, i))
         {
             case 1:
@@ -308,9 +315,14 @@ void gsHalfEdgeMesh<T>::sortVertices()
     m_sorting.resize(this->m_vertex.size(), 0);
     m_inverseSorting.resize(this->m_vertex.size(), 0);
 
+    std::list<size_t> boundaryVertices = m_boundary.getVertexIndices();
+    std::vector<bool> isBoundary(this->m_vertex.size(), false);
+    for (std::list<size_t>::const_iterator it = boundaryVertices.begin(); it != boundaryVertices.end(); ++it)
+        isBoundary[*it] = true;
+
     for (size_t i = 0; i != this->m_vertex.size(); ++i)
     {
-        if (!isBoundaryVertex(i))
+        if (!isBoundary[i])
         {
             numberOfInnerVerticesFound++;
             m_sorting[numberOfInnerVerticesFound - 1] = i;
@@ -318,7 +330,6 @@ void gsHalfEdgeMesh<T>::sortVertices()
         }
     }
 
-    std::list<size_t> boundaryVertices = m_boundary.getVertexIndices();
     for (size_t i = 0; i < getNumberOfBoundaryVertices(); i++)
     {
         m_sorting[m_n + i] = boundaryVertices.front();
@@ -386,65 +397,32 @@ gsHalfEdgeMesh<T>::Boundary::Boundary(const std::vector<typename gsHalfEdgeMesh<
 template<class T>
 const std::list<typename gsHalfEdgeMesh<T>::Halfedge> gsHalfEdgeMesh<T>::Boundary::findNonTwinHalfedges(const std::vector<typename gsHalfEdgeMesh<T>::Halfedge> &allHalfedges)
 {
-    std::queue<Halfedge> queue0;
-    std::queue<Halfedge> queue1;
-    bool actualQueue = 0;
-    std::list<Halfedge> nonTwinHalfedges;
+    size_t numVertices = 0;
+    for (size_t i = 0; i < allHalfedges.size(); ++i)
+        numVertices = std::max(numVertices, std::max(allHalfedges[i].getOrigin(), allHalfedges[i].getEnd()) + 1);
+
+    // Each halfedge is matched with the first unmatched twin preceding it;
+    // the halfedges are hashed by (origin, end).
+    std::vector<bool> hasTwin(allHalfedges.size(), false);
+    std::unordered_map<size_t, std::vector<size_t> > unmatched;
     for (size_t i = 0; i < allHalfedges.size(); ++i)
     {
-        queue0.push(allHalfedges[i]);
-    }
-    while (!(queue0.empty() && queue1.empty()))
-    {
-        if (actualQueue == 0)
+        const size_t twinKey = allHalfedges[i].getEnd() * numVertices + allHalfedges[i].getOrigin();
+        typename std::unordered_map<size_t, std::vector<size_t> >::iterator it = unmatched.find(twinKey);
+        if (it != unmatched.end() && !it->second.empty())
         {
-            nonTwinHalfedges.push_back(queue0.front());
-            queue0.pop();
-            while (!queue0.empty())
-            {
-                if (nonTwinHalfedges.back().isTwin(queue0.front()))
-                {
-                    queue0.pop();
-                    nonTwinHalfedges.pop_back();
-                    while (!queue0.empty())
-                    {
-                        queue1.push(queue0.front());
-                        queue0.pop();
-                    }
-                }
-                else
-                {
-                    queue1.push(queue0.front());
-                    queue0.pop();
-                }
-            }
-            actualQueue = 1;
-        }
-        else if (actualQueue == 1)
-        {
-            nonTwinHalfedges.push_back(queue1.front());
-            queue1.pop();
-            while (!queue1.empty())
-            {
-                if (nonTwinHalfedges.back().isTwin(queue1.front()))
-                {
-                    queue1.pop();
-                    nonTwinHalfedges.pop_back();
-                    while (!queue1.empty())
-                    {
-                        queue0.push(queue1.front());
-                        queue1.pop();
-                    }
-                }
-                else
-                {
-                    queue0.push(queue1.front());
-                    queue1.pop();
-                }
-            }
-            actualQueue = 0;
+            hasTwin[it->second.front()] = true;
+            hasTwin[i] = true;
+            it->second.erase(it->second.begin());
         }
+        else
+            unmatched[allHalfedges[i].getOrigin() * numVertices + allHalfedges[i].getEnd()].push_back(i);
     }
+
+    std::list<Halfedge> nonTwinHalfedges;
+    for (size_t i = 0; i < allHalfedges.size(); ++i)
+        if (!hasTwin[i])
+            nonTwinHalfedges.push_back(allHalfedges[i]);
     return nonTwinHalfedges;
 }
 
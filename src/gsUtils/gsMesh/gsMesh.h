@@ -17,6 +17,7 @@
 #include <gsUtils/gsMesh/gsVertex.h>
 #include <gsUtils/gsMesh/gsFace.h>
 #include <gsUtils/gsMesh/gsEdge.h>
+#include <gsUtils/gsMesh/gsMeshPool.h>
 #include <gsUtils/gsSortedVector.h>
 
 
@@ -56,11 +57,16 @@ public:
     {
         if (this!=&other)
         {
-            // Assert a already cleared gsMesh (getId)
-            cloneAll(other.m_vertex, m_vertex);  // fine, new pointers for all vertices
+            clear();
+            reserve(other.numVertices(), other.numFaces(), other.numEdges());
+
+            // new vertices and faces are created in the pools of this
+            // mesh, their handles are then mapped through the ids
+            for (size_t i = 0; i != other.m_vertex.size(); ++i)
+                m_vertex.push_back( m_vertexPool.create(*other.m_vertex[i]) );
+            for (size_t i = 0; i != other.m_face.size(); ++i)
+                m_face.push_back( m_facePool.create(*other.m_face[i]) );
 
-            // copy all pointers to it's original counterpart in face
-            cloneAll(other.m_face, m_face);
             for (size_t i = 0; i < other.m_face.size(); ++i)
             {
                 for (size_t j = 0; j != other.m_face[i]->vertices.size(); ++j)
@@ -70,6 +76,12 @@ public:
                 }
             }
 
+            for (size_t i = 0; i != m_vertex.size(); ++i)
+            {
+                remapHandles(m_vertex[i]->faces    , other.m_face  , m_face  );
+                remapHandles(m_vertex[i]->nVertices, other.m_vertex, m_vertex);
+            }
+
             // iterate over all edges and make them new
             m_edge = other.m_edge;
             for (size_t i = 0; i != other.m_edge.size(); ++i)
@@ -182,8 +194,13 @@ public:
      */
     gsMesh& cleanMesh();
 
+    /// Reserves memory for the given number of vertices, faces and
+    /// edges. The vertices and the faces reserved are stored contiguously.
     gsMesh& reserve(size_t vertex, size_t face, size_t edge);
 
+    /// Removes all vertices, faces and edges of the mesh
+    void clear();
+
     size_t numVertices() const { return m_vertex.size(); }
     size_t numEdges()    const { return m_edge.size(); }
     size_t numFaces()    const { return m_face.size(); }
@@ -210,21 +227,45 @@ public:
     {
         const FaceHandle & f = face(i);
         gsVector<index_t> res(f->vertices.size());
-        typename std::vector<VertexHandle >::const_iterator v;
         for (size_t j = 0; j!=f->vertices.size(); ++j)
         {
-            v = std::find(m_vertex.begin(), m_vertex.end(), f->vertices[j] );
-            //
-            res[j] = std::distance(m_vertex.begin(),v);
+            GISMO_ASSERT(m_vertex[f->vertices[j]->getId()]==f->vertices[j],
+                         "Vertex id does not match its position in the mesh.");
+            res[j] = f->vertices[j]->getId();
         }
         return res;
     }
 
+private:
+
+    // Replaces handles to elements of \a from by the handles at the
+    // same position in \a to; handles not found in \a from are kept
+    template <class H>
+    static void remapHandles(std::vector<H> & handles,
+                             const std::vector<H> & from,
+                             const std::vector<H> & to)
+    {
+        for (typename std::vector<H>::iterator it = handles.begin();
+             it != handles.end(); ++it)
+        {
+            const size_t k = (*it)->getId();
+            if ( k < from.size() && from[k] == *it )
+                *it = to[k];
+        }
+    }
+
 public: //protected: -- todo
 
     std::vector<VertexHandle > m_vertex;
     std::vector<FaceHandle >  m_face;
     gsSortedVector<Edge> m_edge;
+
+private:
+
+    // storage of the vertices and faces, the vectors above contain
+    // handles to the elements of these pools
+    gsMeshPool<Vertex>     m_vertexPool;
+    gsMeshPool<gsFace<T> > m_facePool;
 };
 
 
@@ -24,8 +24,17 @@ template<class T>
 gsMesh<T>::~gsMesh()
 {
     //gsInfo << "delete gsMesh\n";
-    freeAll(m_vertex);
-    freeAll(m_face);
+    // the elements are destroyed by the pools
+}
+
+template<class T>
+void gsMesh<T>::clear()
+{
+    m_vertex.clear();
+    m_face.clear();
+    m_edge.clear();
+    m_vertexPool.clear();
+    m_facePool.clear();
 }
 
 template<class T>
@@ -122,7 +131,7 @@ gsMesh<T>::gsMesh(const gsBasis<T> & basis, int midPts)
 template<class T>
 typename gsMesh<T>::VertexHandle gsMesh<T>::addVertex(scalar_t const& x, scalar_t const& y, scalar_t const& z)
 {
-    VertexHandle v = this->makeVertex(x,y,z);
+    VertexHandle v = m_vertexPool.create(x,y,z);
     v->setId(m_vertex.size());
     m_vertex.push_back(v );
     return v;
@@ -132,7 +141,7 @@ typename gsMesh<T>::VertexHandle gsMesh<T>::addVertex(scalar_t const& x, scalar_
 template<class T>
 typename gsMesh<T>::VertexHandle gsMesh<T>::addVertex(gsVector<T> const & u)
 {
-    VertexHandle v = this->makeVertex(u);
+    VertexHandle v = m_vertexPool.create(u);
     v->setId(m_vertex.size());
     m_vertex.push_back(v);
     return v;
@@ -169,7 +178,7 @@ void gsMesh<T>::addEdge(gsVector<T> const & u0,
 template<class T>
 typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(std::vector<VertexHandle> const & vert)
 {
-    FaceHandle f = this->makeFace( vert );
+    FaceHandle f = m_facePool.create( vert );
     f->setId(m_face.size());
     m_face.push_back(f);
     return f;
@@ -180,7 +189,7 @@ template<class T>
 typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(VertexHandle const & v0, VertexHandle const & v1,
                    VertexHandle const & v2)
 {
-    FaceHandle f = this->makeFace( v0, v1, v2 );
+    FaceHandle f = m_facePool.create( v0, v1, v2 );
     f->setId(m_face.size());
     m_face.push_back(f);
     return f;
@@ -191,7 +200,7 @@ template<class T>
 typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(VertexHandle const & v0, VertexHandle const & v1,
                    VertexHandle const & v2,  VertexHandle const & v3)
 {
-    FaceHandle f = this->makeFace( v0,v1,v2,v3 );
+    FaceHandle f = m_facePool.create( v0,v1,v2,v3 );
     f->setId(m_face.size());
     m_face.push_back(f);
     return f;
@@ -207,7 +216,7 @@ typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(std::vector<int> const & vert)
           it!= vert.end(); ++it )
         pvert.push_back( m_vertex[*it] );
 
-    FaceHandle f = this->makeFace( pvert );
+    FaceHandle f = m_facePool.create( pvert );
     f->setId(m_face.size());
     m_face.push_back(f);
     return f;
@@ -217,7 +226,7 @@ typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(std::vector<int> const & vert)
 template<class T>
 typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(const int v0, const int v1, const int v2)
 {
-    FaceHandle f = this->makeFace( m_vertex[v0],m_vertex[v1],m_vertex[v2] );
+    FaceHandle f = m_facePool.create( m_vertex[v0],m_vertex[v1],m_vertex[v2] );
     f->setId(m_face.size());
     m_face.push_back(f);
     return f;
@@ -227,7 +236,7 @@ typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(const int v0, const int v1, co
 template<class T>
 typename gsMesh<T>::FaceHandle gsMesh<T>::addFace(const int v0, const int v1, const int v2, const int v3)
 {
-    FaceHandle f = this->makeFace( m_vertex[v0],m_vertex[v1],m_vertex[v2],m_vertex[v3] );
+    FaceHandle f = m_facePool.create( m_vertex[v0],m_vertex[v1],m_vertex[v2],m_vertex[v3] );
     f->setId(m_face.size());
     m_face.push_back(f);
     return f;
@@ -246,6 +255,18 @@ std::ostream &gsMesh<T>::print(std::ostream &os) const
 }
 
 
+// Lexicographic comparison of vertices given by their index
+template<class T>
+struct lexCompareIndex
+{
+    explicit lexCompareIndex(const std::vector<gsVertex<T>*> & vert) : m_vert(vert) { }
+
+    bool operator() (size_t lhs, size_t rhs) const
+    { return lexCompareVHandle<T>()(m_vert[lhs], m_vert[rhs]); }
+
+    const std::vector<gsVertex<T>*> & m_vert;
+};
+
 template <class T>
 gsMesh<T>& gsMesh<T>::cleanMesh()
 {
@@ -264,21 +285,23 @@ gsMesh<T>& gsMesh<T>::cleanMesh()
     }
     gsDebug << "----------------------------------------\n";*/
 
-    // build up the unique map
-    std::vector<size_t> uniquemap;
-    uniquemap.reserve(m_vertex.size());
-    for(size_t i = 0; i < m_vertex.size(); i++)
+    // build up the unique map: sort the vertices by their
+    // coordinates, every vertex is mapped to the vertex with the
+    // smallest index having the same coordinates
+    std::vector<size_t> order(m_vertex.size());
+    for(size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), lexCompareIndex<T>(m_vertex)); // O(n*log(n))
+
+    std::vector<size_t> uniquemap(m_vertex.size());
+    for(size_t k = 0; k < order.size(); )
     {
-        size_t buddy = i;
-        for(size_t j = 0; j < i; j++)
-        {
-            if(*(m_vertex[i]) == *(m_vertex[j])) // overload compares coords
-            {
-                buddy = j;
-                break;
-            }
-        }
-        uniquemap.push_back(buddy);
+        size_t l = k + 1;
+        while ( l < order.size() && *m_vertex[order[l]] == *m_vertex[order[k]] ) // overload compares coords
+            ++l;
+        for (size_t r = k; r < l; ++r) // order[k] is the smallest index (stable sort)
+            uniquemap[order[r]] = order[k];
+        k = l;
     }
 
     for(size_t i = 0; i != m_face.size(); i++)
@@ -295,22 +318,17 @@ gsMesh<T>& gsMesh<T>::cleanMesh()
         m_edge[i].target = m_vertex[uniquemap[m_edge[i].target->getId()]];
     }
 
-    std::set<size_t> uniqueset(uniquemap.begin(), uniquemap.end());    // O(n*log(n))
     std::vector<VertexHandle> uvertex;
-    uvertex.reserve(uniqueset.size());
+    uvertex.reserve(m_vertex.size());
     for(size_t i = 0; i < uniquemap.size(); i++) {     // O(n)
-        if(uniqueset.find(i) != uniqueset.end())    // O(log(m)), n >> m
+        if(uniquemap[i] == i)
         {
             // re-number vertices id by new sequence - should we not do?
             m_vertex[i]->setId(uvertex.size());
             uvertex.push_back(m_vertex[i]);
         }
-        else
-        {
-            delete m_vertex[i];
-            m_vertex[i] = nullptr;
-        }
-    }   // O(n*log(n)+O(n)*O(log(m)) ==> O(n*log(n))
+        // else: the duplicate stays in the pool until the mesh is destroyed
+    }
     m_vertex.swap(uvertex);
 
     return *this;
@@ -321,6 +339,8 @@ gsMesh<T>& gsMesh<T>::reserve(size_t vertex, size_t face, size_t edge)
 {
     m_vertex.reserve(vertex);
     m_face.reserve(face);
+    m_vertexPool.reserve(vertex);
+    m_facePool.reserve(face);
     m_edge.reserve(edge);
     return *this;
 }
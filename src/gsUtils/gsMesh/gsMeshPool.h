@@ -0,0 +1,107 @@
+/** @file gsMeshPool.h
+
+    @brief Provides the block storage used for the elements of gsMesh.
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace gismo {
+
+/**
+   \brief Block storage for mesh elements.
+
+   Elements are constructed in place inside contiguous blocks of
+   increasing size, instead of being allocated one by one. An element
+   never moves once it has been created, therefore pointers to it
+   (handles) remain valid until the pool is cleared or destroyed.
+
+   Elements are destroyed only by clear() or by the destructor of the
+   pool; they must not be deleted through their handles.
+
+   \ingroup Utils
+*/
+template <class E>
+class gsMeshPool
+{
+public:
+    gsMeshPool() : m_used(0), m_size(0) { }
+
+    ~gsMeshPool() { clear(); }
+
+    /// Creates a new element in the pool and returns a pointer to it
+    template <class... Args>
+    E * create(Args&&... args)
+    {
+        if ( m_blocks.empty() || m_used == m_blocks.back().second )
+            grow(0);
+        E * e = m_blocks.back().first + m_used;
+        ::new (static_cast<void*>(e)) E(std::forward<Args>(args)...);
+        ++m_used;
+        ++m_size;
+        return e;
+    }
+
+    /// Makes sure that the next \a n elements are created inside
+    /// one contiguous block
+    void reserve(size_t n)
+    {
+        if ( m_blocks.empty() || m_blocks.back().second - m_used < n )
+            grow(n);
+    }
+
+    /// Destroys all elements and releases the memory
+    void clear()
+    {
+        std::allocator<E> alloc;
+        for (size_t b = 0; b != m_blocks.size(); ++b)
+        {
+            const size_t n = (b+1 == m_blocks.size() ? m_used : m_filled[b]);
+            for (size_t i = 0; i != n; ++i)
+                m_blocks[b].first[i].~E();
+            alloc.deallocate(m_blocks[b].first, m_blocks[b].second);
+        }
+        m_blocks.clear();
+        m_filled.clear();
+        m_used = m_size = 0;
+    }
+
+    /// Number of elements created since the last clear()
+    size_t size() const { return m_size; }
+
+private:
+
+    void grow(size_t n)
+    {
+        const size_t last = m_blocks.empty() ? 0 : m_blocks.back().second;
+        const size_t cap  = std::max(n, std::max<size_t>(2*last, 64));
+        if ( !m_blocks.empty() )
+            m_filled.push_back(m_used);
+        m_blocks.push_back( std::make_pair(std::allocator<E>().allocate(cap), cap) );
+        m_used = 0;
+    }
+
+    // disable copying, the handles refer to the elements of this pool
+    gsMeshPool(const gsMeshPool &);
+    gsMeshPool & operator=(const gsMeshPool &);
+
+private:
+    std::vector<std::pair<E*,size_t> > m_blocks; // begin and capacity
+    std::vector<size_t> m_filled; // number of elements in the full blocks
+    size_t m_used; // number of elements in the last block
+    size_t m_size;
+};
+
+} // namespace gismo
@@ -97,4 +97,121 @@ SUITE(gsExprAssembler_test)
         //
         CHECK(math::abs(ev.integral(el.area(G))-2*EIGEN_PI/32) < 1e-10);
     }
+
+    TEST(BatchedEvaluation)
+    {
+        gsMultiPatch<> mp( *gsNurbsCreator<>::NurbsQuarterAnnulus() );
+        gsMultiBasis<> mb(mp);
+        mb.degreeElevate(1);
+        mb.uniformRefine(2);
+
+        gsExprAssembler<> A(1,1);
+        A.setIntegrationElements(mb);
+        gsExprAssembler<>::geometryMap G = A.getMap(mp);
+        gsExprAssembler<>::space u = A.getSpace(mb);
+        u.setup(-1);
+
+        // Batched and pointwise evaluation must give the same matrices
+        gsSparseMatrix<> K[2], M[2];
+        for (index_t i = 0; i != 2; ++i)
+        {
+            A.options().setSwitch("batchedEval", 0==i);
+            A.initSystem();
+            A.assemble( igrad(u, G) * igrad(u, G).tr() * meas(G) );
+            K[i] = A.matrix();
+            A.initSystem();
+            A.assemble( 2.0 * (u * u.tr()) );
+            M[i] = A.matrix();
+        }
+        CHECK( (K[0]-K[1]).norm() < 1e-10 * K[1].norm() );
+        CHECK( (M[0]-M[1]).norm() < 1e-10 * M[1].norm() );
+        CHECK( K[1].norm() > 0 && M[1].norm() > 0 );
+    }
+
+    TEST(SharedSubexpressions)
+    {
+        gsMultiPatch<> mp( *gsNurbsCreator<>::NurbsQuarterAnnulus() );
+        gsMultiBasis<> mb(mp);
+        mb.degreeElevate(1);
+        mb.uniformRefine(2);
+
+        gsExprAssembler<> A(1,1);
+        A.setIntegrationElements(mb);
+        gsExprAssembler<>::geometryMap G = A.getMap(mp);
+        gsExprAssembler<>::space u = A.getSpace(mb);
+        u.setup(-1);
+
+        // Several terms using igrad(u,G), with and without a shared cache
+        gsSparseMatrix<> K[2];
+        for (index_t i = 0; i != 2; ++i)
+        {
+            A.options().setSwitch("shareSubexpressions", 0==i);
+            A.initSystem();
+            A.assemble( igrad(u, G) * igrad(u, G).tr() * meas(G),
+                        igrad(u, G) * igrad(u, G).tr(),
+                        u * u.tr() * meas(G) );
+            K[i] = A.matrix();
+        }
+        CHECK( (K[0]-K[1]).norm() < 1e-10 * K[1].norm() );
+        CHECK( K[1].norm() > 0 );
+    }
+
+    TEST(ElementCache)
+    {
+        gsMultiPatch<> mp( *gsNurbsCreator<>::NurbsQuarterAnnulus() );
+        gsMultiBasis<> mb(mp);
+        mb.uniformRefine(2);
+
+        gsExprAssembler<> A(1,1);
+        A.setIntegrationElements(mb);
+        gsExprAssembler<>::geometryMap G = A.getMap(mp);
+        gsExprAssembler<>::space u = A.getSpace(mb);
+        u.setup(-1);
+        A.initSystem();
+
+        gsMatrix<> x;
+        gsExprAssembler<>::solution s = A.getSolution(u, x);
+
+        // Repeated assemblies with changing coefficients, with and
+        // without re-using the data of G and u
+        gsSparseMatrix<> K[2][2];
+        for (index_t i = 0; i != 2; ++i)
+        {
+            A.options().setInt("elementCache", 0==i ? 16 : 0);
+            for (index_t j = 0; j != 2; ++j)
+            {
+                x.setConstant(A.numDofs(), 1, 1.0 + j);
+                A.initSystem();
+                A.assemble( igrad(u, G) * igrad(u, G).tr() * (s.val() * s.val()) * meas(G) );
+                K[i][j] = A.matrix();
+            }
+            if (0==i)
+            {
+                CHECK( A.exprData()->elementCacheHits() > 0 );
+                CHECK( A.exprData()->elementCacheBytes() > 0 );
+            }
+        }
+        CHECK( 0 == A.exprData()->elementCacheBytes() );
+        CHECK( (K[0][0]-K[1][0]).norm() < 1e-10 * K[1][0].norm() );
+        CHECK( (K[0][1]-K[1][1]).norm() < 1e-10 * K[1][1].norm() );
+        CHECK( (K[0][1]-4*K[0][0]).norm() < 1e-10 * K[0][1].norm() );
+    }
+
+    TEST(SmallMatrixExpressions)
+    {
+        gsMultiPatch<> mp( *gsNurbsCreator<>::NurbsQuarterAnnulus() );
+        gsMultiBasis<> mb(mp);
+        gsExprEvaluator<> ev;
+        ev.setIntegrationElements(mb);
+        ev.options().setInt("quB", 3);
+        gsExprEvaluator<>::geometryMap G = ev.getMap(mp);
+
+        // Area of the quarter annulus with radii 1 and 2
+        CHECK( math::abs(ev.integral(abs(jac(G).det())) - 0.75*EIGEN_PI) < 1e-6 );
+        CHECK( math::abs(ev.integral(meas(G)) - ev.integral(abs(jac(G).det()))) < 1e-10 );
+
+        // Closed-form inverses agree with the precomputed ones
+        CHECK( ev.max( (jac(G).tr().inv() - jac(G).inv().tr()).sqNorm() ) < 1e-20 );
+        CHECK( ev.max( ((jac(G).tr()*jac(G)).inv() * jac(G).tr() - jac(G).ginv()).sqNorm() ) < 1e-20 );
+    }
 }
@@ -199,6 +199,31 @@ SUITE(gsIterativeSolvers_test)
         CHECK( (mat*x-rhs).norm()/rhs.norm() <= tol );
     }
 
+    TEST(SStepGMRes_test)
+    {
+        index_t          N = 100;
+        real_t           tol = std::pow(10.0, - REAL_DIG * 0.75);
+
+        gsSparseMatrix<> mat;
+        gsMatrix<>       rhs;
+        gsMatrix<>       x;
+
+        poissonDiscretization(mat, rhs, N);
+
+        gsOptionList opt = gsSStepGMRes<>::defaultOptions();
+        opt.setInt ("MaxIterations", N  );
+        opt.setReal("Tolerance"    , tol);
+        opt.setInt ("StepSize"     , 3  );
+
+        gsSStepGMRes<> solver(mat);
+        solver.setOptions(opt);
+
+        x.setZero(N,1);
+        solver.solve(rhs,x);
+
+        CHECK( (mat*x-rhs).norm()/rhs.norm() <= tol );
+    }
+
     TEST(CG_Jacobi_test)
     {
         index_t          N = 100;
@@ -224,6 +249,98 @@ SUITE(gsIterativeSolvers_test)
         CHECK( (mat*x-rhs).norm()/rhs.norm() <= tol );
     }
 
+    TEST(PipelinedCG_Jacobi_test)
+    {
+        index_t          N = 100;
+        real_t           tol = std::pow(10.0, - REAL_DIG * 0.5);
+
+        gsSparseMatrix<> mat;
+        gsMatrix<>       rhs;
+        gsMatrix<>       x;
+
+        poissonDiscretization(mat, rhs, N);
+
+        gsOptionList opt = gsPipelinedConjugateGradient<>::defaultOptions();
+        opt.setInt ("MaxIterations", 2*N);
+        opt.setReal("Tolerance"    , tol);
+
+        gsLinearOperator<>::Ptr preConMat = makeJacobiOp(mat);
+        gsPipelinedConjugateGradient<> solver(mat,preConMat);
+        solver.setOptions(opt);
+
+        x.setZero(N,1);
+        solver.solve(rhs,x);
+
+        CHECK( (mat*x-rhs).norm()/rhs.norm() <= tol );
+    }
+
+    TEST(BlockCG_Jacobi_test)
+    {
+        index_t          N = 100;
+        real_t           tol = std::pow(10.0, - REAL_DIG * 0.75);
+
+        gsSparseMatrix<> mat;
+        gsMatrix<>       rhs;
+        gsMatrix<>       x;
+
+        poissonDiscretization(mat, rhs, N);
+
+        // Several right-hand sides, including a dependent and a zero one
+        gsMatrix<> rhs4(N,4);
+        rhs4.col(0) = rhs;
+        rhs4.col(1).setRandom();
+        rhs4.col(2) = rhs4.col(0) - 2*rhs4.col(1);
+        rhs4.col(3).setZero();
+
+        gsOptionList opt = gsBlockConjugateGradient<>::defaultOptions();
+        opt.setInt ("MaxIterations", 2*N);
+        opt.setReal("Tolerance"    , tol);
+
+        gsLinearOperator<>::Ptr preConMat = makeJacobiOp(mat);
+        gsBlockConjugateGradient<> solver(mat,preConMat);
+        solver.setOptions(opt);
+
+        x.setZero(N,4);
+        solver.solve(rhs4,x);
+
+        for (index_t j = 0; j < 3; ++j)
+            CHECK( (mat*x.col(j)-rhs4.col(j)).norm()/rhs4.col(j).norm() <= 10*tol );
+        CHECK( x.col(3).isZero() );
+        CHECK( solver.columnIterations()[3] == 0 );
+    }
+
+    TEST(BlockGMRes_test)
+    {
+        index_t          N = 100;
+        real_t           tol = std::pow(10.0, - REAL_DIG * 0.75);
+
+        gsSparseMatrix<> mat;
+        gsMatrix<>       rhs;
+        gsMatrix<>       x;
+
+        poissonDiscretization(mat, rhs, N);
+
+        gsMatrix<> rhs4(N,4);
+        rhs4.col(0) = rhs;
+        rhs4.col(1).setRandom();
+        rhs4.col(2) = rhs4.col(0) - 2*rhs4.col(1);
+        rhs4.col(3).setRandom();
+
+        gsOptionList opt = gsBlockGMRes<>::defaultOptions();
+        opt.setInt ("MaxIterations", N  );
+        opt.setReal("Tolerance"    , tol);
+
+        gsBlockGMRes<> solver(mat);
+        solver.setOptions(opt);
+
+        x.setZero(N,4);
+        solver.solve(rhs4,x);
+
+        for (index_t j = 0; j < 4; ++j)
+            CHECK( (mat*x.col(j)-rhs4.col(j)).norm()/rhs4.col(j).norm() <= 10*tol );
+        CHECK( solver.iterations() < N/2 );
+    }
+
     TEST(CG_SGS_test)
     {
         index_t          N = 100;
@@ -180,6 +180,34 @@ SUITE(gsKnotVectors_test)
         CHECK( (corrUppRigh.array() == compUppRigh.array()).all() );
     }
 
+    TEST(gsBasis_bezierExtraction)
+    {
+        // Non-uniform knots with a double knot
+        real_t data[]={0,0,0,0,0.1,0.35,0.5,0.5,0.8,1,1,1,1};
+        std::vector<real_t> v(data,data+sizeof(data)/sizeof(real_t));
+        gsKnotVector<real_t> kv(3,v.begin(),v.end());
+        gsBSplineBasis<real_t> basis(kv), bezier(kv);
+        bezier.setBezierExtraction();
+        CHECK( bezier.hasBezierExtraction() );
+
+        gsMatrix<real_t> u = gsMatrix<real_t>::Random(1,50);
+        u.array() = (u.array() + 1) / 2;
+        u(0,0) = 0; u(0,1) = 0.5; u(0,2) = 1;
+
+        std::vector<gsMatrix<real_t> > ders, bezierDers;
+        basis.evalAllDers_into(u, 3, ders);
+        bezier.evalAllDers_into(u, 3, bezierDers);
+        for (int k = 0; k <= 3; ++k)
+            CHECK( (ders[k] - bezierDers[k]).norm() <= 1e-8 * ders[k].norm() );
+        CHECK( (basis.eval(u) - bezier.eval(u)).norm() <= 1e-12 );
+        CHECK( (basis.deriv(u) - bezier.deriv(u)).norm() <= 1e-10 * basis.deriv(u).norm() );
+
+        // Elements with changed knots are evaluated without the operators
+        basis.insertKnot(0.2);
+        bezier.insertKnot(0.2);
+        CHECK( (basis.eval(u) - bezier.eval(u)).norm() <= 1e-12 );
+    }
+
     template <typename KV>
     void testFindSpan (const KV &knots)
     {
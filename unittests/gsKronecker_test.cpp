@@ -61,6 +61,27 @@ SUITE(gsKronecker_test)
         CHECK_EQUAL ( y, KP * x );
     }
 
+    TEST(gsKroneckerOpDenseFactors)
+    {
+        // Rectangular and transposed dense factors, several columns;
+        // compare with the same operator for sparse factors
+        gsMatrix<> C = A.leftCols(2);
+        gsSparseMatrix<> sA = A.sparseView(), sB = B.sparseView(), sC = C.sparseView();
+        gsKroneckerOp<> dense ( makeMatrixOp(A),  makeMatrixOp(C.transpose()),  makeMatrixOp(B) );
+        gsKroneckerOp<> sparse( makeMatrixOp(sA), makeMatrixOp(sC.transpose()), makeMatrixOp(sB) );
+        CHECK_EQUAL( 18, dense.rows() );
+        CHECK_EQUAL( 27, dense.cols() );
+        gsMatrix<> x(27,2), y1, y2;
+        for (index_t i = 0; i < 27; ++i)
+        {
+            x(i,0) = i;
+            x(i,1) = 1 - i%5;
+        }
+        dense.apply(x, y1);
+        sparse.apply(x, y2);
+        CHECK( (y1 - y2).norm() < 1e-10 * y2.norm() );
+    }
+
     TEST(DenseKronecker)
     {        
         gsMatrix<> C = A.kron(B);
@@ -0,0 +1,48 @@
+/** @file gsLinearTimeIntegrator_test.cpp
+
+    @brief Tests the adaptive time integration of linear ODE systems
+
+    This file is part of the G+Smo library.
+
+    This Source Code Form is subject to the terms of the Mozilla Public
+    License, v. 2.0. If a copy of the MPL was not distributed with this
+    file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+    Author(s): A. Mantzaflaris
+ **/
+
+#include "gismo_unittest.h"
+
+SUITE(gsLinearTimeIntegrator_test)
+{
+    TEST(scalarDecay)
+    {
+        // u1' = 1 - u1, u2' = -50 u2, with u(0) = (0,1)
+        gsSparseMatrix<> M(2,2), K(2,2);
+        M.setIdentity();
+        K.insert(0,0) = 1;
+        K.insert(1,1) = 50;
+        K.makeCompressed();
+        gsMatrix<> f(2,1);
+        f << 1, 0;
+
+        for (index_t m = 0; m != 2; ++m)
+        {
+            gsLinearTimeIntegrator<real_t> integrator(M, K, f);
+            integrator.options().setInt ("Method", m);
+            integrator.options().setReal("RelTol", 1e-5);
+            integrator.options().setReal("AbsTol", 1e-7);
+            gsMatrix<> u(2,1);
+            u << 0, 1;
+            integrator.integrate(u, 0, 1);
+
+            CHECK_CLOSE( 1 - math::exp(-1.0), u(0,0), 1e-4 );
+            CHECK( math::abs(u(1,0)) < 1e-4 );
+            // The stiff transient needs small steps, later steps are larger
+            CHECK( *std::max_element(integrator.stepSizes().begin(), integrator.stepSizes().end())
+                   > 10 * integrator.stepSizes().front() );
+            // Factorizations are re-used for steps of equal size
+            CHECK( integrator.numFactorizations() < integrator.numSteps() );
+        }
+    }
+}
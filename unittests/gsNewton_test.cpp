@@ -60,4 +60,32 @@ SUITE(gsNewton_test)
         CHECK( res <= 1e-5 );
     }
 
+    TEST(locate)
+    {
+        gsMultiPatch<> mp(*gsNurbsCreator<>::NurbsQuarterAnnulus());
+        mp = mp.uniformSplit();
+        mp.uniformRefine();
+
+        // Images of the centers of the parameter domains of the patches
+        gsMatrix<> points(2, mp.nPatches() + 1), supp;
+        for (size_t k = 0; k < mp.nPatches(); ++k)
+        {
+            supp = mp.patch(k).support();
+            points.col(k) = mp.patch(k).eval( ( supp.col(0) + supp.col(1) ) / 2 );
+        }
+        points.col(mp.nPatches()) = gsVector<>::vec(0.1, 0.1); // outside
+
+        gsVector<index_t> pids;
+        gsMatrix<> params;
+        mp.locate(points, pids, params);
+
+        CHECK_EQUAL( -1, pids[mp.nPatches()] );
+        for (size_t k = 0; k < mp.nPatches(); ++k)
+        {
+            CHECK_EQUAL( (index_t)k, pids[k] );
+            const real_t res = (mp.patch(pids[k]).eval(params.col(k)) - points.col(k)).norm();
+            CHECK( res <= 1e-5 );
+        }
+    }
+
 }
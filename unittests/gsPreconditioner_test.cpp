@@ -87,6 +87,39 @@ void runPreconditionerTest( index_t testcase )
         solver.solve(rhs,sol);
         CHECK ( solver.error() <= solver.tolerance() );
     }
+    else if (testcase==4)
+    {
+        gsOptionList amgOpt = gsAlgebraicMultiGridOp<>::defaultOptions();
+        amgOpt.setInt("CoarseSize", 20);
+        gsAlgebraicMultiGridOp<>::Ptr amg = gsAlgebraicMultiGridOp<>::make(mat, amgOpt);
+        CHECK ( amg->numLevels() > 1 );
+        gsConjugateGradient<> solver(mat, amg);
+        solver.setTolerance( 1.e-8 );
+        solver.setMaxIterations( 25 );
+        solver.solve(rhs,sol);
+        CHECK ( solver.error() <= solver.tolerance() );
+    }
+    else if (testcase==5)
+    {
+        typedef gsMulticolorGaussSeidelOp<gsSparseMatrix<>,gsGaussSeidel::symmetric> SmootherType;
+        SmootherType::Ptr sgs = SmootherType::make(mat);
+        CHECK ( sgs->numColors() > 1 );
+        gsConjugateGradient<> solver(mat, sgs);
+        solver.setTolerance( 1.e-8 );
+        solver.setMaxIterations( 50 );
+        solver.solve(rhs,sol);
+        CHECK ( solver.error() <= solver.tolerance() );
+    }
+    else if (testcase==6)
+    {
+        gsChebyshevOp< gsSparseMatrix<> >::Ptr cheb = gsChebyshevOp< gsSparseMatrix<> >::make(mat, 3);
+        CHECK ( cheb->maxEigenvalue() > 1 );
+        gsConjugateGradient<> solver(mat, cheb);
+        solver.setTolerance( 1.e-8 );
+        solver.setMaxIterations( 50 );
+        solver.solve(rhs,sol);
+        CHECK ( solver.error() <= solver.tolerance() );
+    }
 }
 
 
@@ -109,6 +142,62 @@ SUITE(gsPreconditioner_test)
     {
         runPreconditionerTest(3);
     }
+    TEST(gsAlgebraicMultiGridPreconditioner_test)
+    {
+        runPreconditionerTest(4);
+    }
+    TEST(gsMulticolorGaussSeidelPreconditioner_test)
+    {
+        runPreconditionerTest(5);
+    }
+    TEST(gsChebyshevPreconditioner_test)
+    {
+        runPreconditionerTest(6);
+    }
+
+    TEST(gsPMultiGridPreconditioner_test)
+    {
+        // Multipatch domain to have coupling dofs for the block ILUT smoother
+        gsMultiPatch<> mp( *gsNurbsCreator<>::BSplineSquare() );
+        mp = mp.uniformSplit();
+
+        gsMultiBasis<> mb(mp);
+        mb.setDegree(3);
+        mb.uniformRefine();
+        mb.uniformRefine();
+
+        gsConstantFunction<> one(1,mp.geoDim());
+        gsBoundaryConditions<> bc;
+        for (gsMultiPatch<>::const_biterator it = mp.bBegin(); it != mp.bEnd(); ++it)
+            bc.addCondition( *it, condition_type::dirichlet, &one );
+
+        gsOptionList opt = gsPMultiGridOp<>::defaultOptions();
+        gsPoissonAssembler<> assembler(
+            mp,
+            mb,
+            bc,
+            one,
+            (dirichlet::strategy) opt.getInt("DirichletStrategy"),
+            (iFace::strategy) opt.getInt("InterfaceStrategy")
+            );
+        assembler.assemble();
+        gsSparseMatrix<> mat = assembler.matrix();
+        gsMatrix<> rhs = assembler.rhs();
+        gsMatrix<> sol;
+        sol.setZero(rhs.rows(), rhs.cols());
+
+        // Degree 3 -> 2 -> 1
+        gsPMultiGridOp<>::Ptr pmg = gsPMultiGridOp<>::make(mp, mb, bc, mat, opt);
+        CHECK ( pmg->numLevels() == 3 );
+        CHECK ( pmg->coarsening() == "pp" );
+        CHECK ( pmg->bases()[0].maxCwiseDegree() == 1 );
+
+        gsBiCgStab<> solver(mat, pmg);
+        solver.setTolerance( 1.e-8 );
+        solver.setMaxIterations( 20 );
+        solver.solve(rhs,sol);
+        CHECK ( solver.error() <= solver.tolerance() );
+    }
 
     TEST(gsPatchPreconditioner_stiff_test)
     {
@@ -86,6 +86,29 @@ TEST(Obj_ref_not_in_file)
     CHECK((basis.size() == 0));
 }
 
+TEST(Indexed_getId)
+{
+    const std::string fmp = "domain2d/yeti_mp2.xml";
+    gsFileData<> fd;
+    CHECK( fd.readIndexed(fmp, false) );
+    CHECK_EQUAL(22, fd.numTags());
+    CHECK_EQUAL(0, fd.numParsed());
+
+    gsGeometry<>::uPtr g = fd.getId< gsGeometry<> >(5);
+    CHECK( g );
+    CHECK_EQUAL(1, fd.numParsed());
+
+    // the patches are parsed together with the multipatch
+    gsMultiPatch<> mp, mp_ref;
+    CHECK( fd.getFirst(mp) );
+    CHECK_EQUAL(22, fd.numParsed());
+
+    gsReadFile<>(fmp, mp_ref);
+    CHECK_EQUAL(mp_ref.nPatches(), mp.nPatches());
+    CHECK( (mp_ref.patch(5).coefs() - g->coefs()).norm() < EPSILON );
+    CHECK( (mp_ref.patch(20).coefs() - mp.patch(20).coefs()).norm() < EPSILON );
+}
+
 // Tests for the constructors that take use of casts
 /*TEST(Obj_uPtr)
 {